@@ -0,0 +1,74 @@
+// 네이티브 커널 마이크로벤치마크
+//
+// 사용법: bench_kernels [반복 횟수]
+// 파이썬 바인딩 비용 없이 커널 자체의 처리량(메가픽셀/초)을 측정합니다.
+
+#include <airphoto/kernels.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace {
+
+template <class F>
+double best_seconds(int repeat, F&& body) {
+    double best = 1e30;
+    for (int r = 0; r < repeat; ++r) {
+        const auto start = std::chrono::steady_clock::now();
+        body();
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        best = std::min(best, elapsed.count());
+    }
+    return best;
+}
+
+template <class T>
+std::vector<T> random_pixels(std::size_t count, unsigned max_value) {
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<unsigned> dist(0, max_value);
+    std::vector<T> out(count);
+    for (auto& v : out) {
+        v = static_cast<T>(dist(rng));
+    }
+    return out;
+}
+
+template <class T>
+void bench_resize(const char* name, int w, int h, int channels, int repeat) {
+    const auto src = random_pixels<T>(static_cast<std::size_t>(w) * h * channels, 4095);
+    const int dw = (w + 1) / 2, dh = (h + 1) / 2;
+    std::vector<T> dst(static_cast<std::size_t>(dw) * dh * channels);
+    const double seconds = best_seconds(repeat, [&] {
+        airphoto::area_resize(src.data(), w, h, dst.data(), dw, dh, channels);
+    });
+    std::printf("area_resize %-8s %dx%dx%d -> 1/2: %7.2f ms, %7.1f MP/s\n", name, w, h,
+                channels, seconds * 1e3, w * static_cast<double>(h) / seconds / 1e6);
+}
+
+void bench_lut(int w, int h, int channels, int repeat) {
+    const std::size_t pixels = static_cast<std::size_t>(w) * h;
+    const auto src = random_pixels<std::uint16_t>(pixels * channels, 65535);
+    const auto lut = random_pixels<std::uint16_t>(65536 * static_cast<std::size_t>(channels), 65535);
+    std::vector<std::uint16_t> dst(src.size());
+    const double seconds = best_seconds(repeat, [&] {
+        airphoto::apply_lut(src.data(), dst.data(), pixels, channels, lut.data(), 65536);
+    });
+    std::printf("apply_lut   uint16   %dx%dx%d:       %7.2f ms, %7.1f MP/s\n", w, h, channels,
+                seconds * 1e3, pixels / seconds / 1e6);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const int repeat = argc > 1 ? std::max(1, std::atoi(argv[1])) : 5;
+    bench_resize<std::uint8_t>("uint8", 4000, 3000, 3, repeat);
+    bench_resize<std::uint16_t>("uint16", 4000, 3000, 8, repeat);
+    bench_resize<float>("float32", 2000, 1500, 8, repeat);
+    bench_lut(4000, 3000, 1, repeat);
+    bench_lut(4000, 3000, 3, repeat);
+    return 0;
+}
@@ -0,0 +1,168 @@
+// 항공사진 뷰어 네이티브 커널
+//
+// 파이썬 바인딩(module.cpp)과 분리된 순수 C++17 구현입니다. 모든 함수는
+// 호출자가 할당한 C 연속 버퍼를 읽고 쓰며, 파이썬 객체나 GIL에 의존하지 않아
+// 바인딩에서 GIL을 해제한 채로 호출합니다.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace airphoto {
+
+// 한 축의 면적 가중치 표 (출력 인덱스마다 원본 시작 인덱스와 가중치 목록)
+struct AreaTaps {
+    std::vector<int> first;     // 출력 i가 읽는 첫 원본 인덱스
+    std::vector<int> offset;    // weights 안에서 출력 i의 시작 위치 (크기 n + 1)
+    std::vector<float> weights; // 원본 칸과 출력 칸이 겹치는 비율 (합 1)
+};
+
+// 원본 길이 src를 dst로 줄이는 면적 가중치를 계산합니다.
+// 출력 칸 i는 원본 구간 [i * s, (i + 1) * s) (s = src / dst)를 덮으며,
+// 구간과 겹치는 원본 칸마다 겹친 길이 / s를 가중치로 갖습니다 (OpenCV INTER_AREA와 같은 정의).
+inline AreaTaps area_taps(int src, int dst) {
+    AreaTaps taps;
+    taps.first.resize(dst);
+    taps.offset.resize(dst + 1);
+    const double scale = static_cast<double>(src) / dst;
+    for (int i = 0; i < dst; ++i) {
+        const double lo = i * scale;
+        const double hi = std::min((i + 1) * scale, static_cast<double>(src));
+        int j = static_cast<int>(std::floor(lo));
+        taps.first[i] = j;
+        taps.offset[i] = static_cast<int>(taps.weights.size());
+        for (; j < src && j < hi; ++j) {
+            const double overlap = std::min(hi, j + 1.0) - std::max(lo, static_cast<double>(j));
+            if (overlap > 1e-9) {
+                taps.weights.push_back(static_cast<float>(overlap / scale));
+            } else if (taps.offset[i] == static_cast<int>(taps.weights.size())) {
+                // 부동소수 오차로 생긴 앞쪽 빈 칸은 건너뛴다
+                taps.first[i] = j + 1;
+            }
+        }
+    }
+    taps.offset[dst] = static_cast<int>(taps.weights.size());
+    return taps;
+}
+
+// 누적한 실수 값을 출력 자료형으로 변환합니다 (정수형은 반올림 후 포화).
+template <class T>
+inline T saturate(float value) {
+    if constexpr (std::is_integral_v<T>) {
+        const float lo = static_cast<float>(std::numeric_limits<T>::min());
+        const float hi = static_cast<float>(std::numeric_limits<T>::max());
+        return static_cast<T>(std::lrint(std::clamp(value, lo, hi)));
+    } else {
+        return static_cast<T>(value);
+    }
+}
+
+// 원본 한 행을 가로 방향으로 축소해 실수 행에 씁니다.
+// CHANNELS가 0이 아니면 채널 루프를 컴파일 시점에 펼친다.
+template <int CHANNELS, class T>
+void area_row(const T* in, float* out, const AreaTaps& tx, int dw, int channels) {
+    const int nc = CHANNELS ? CHANNELS : channels;
+    for (int x = 0; x < dw; ++x, out += nc) {
+        float sum[CHANNELS ? CHANNELS : 1] = {};
+        float* acc = CHANNELS ? sum : out;
+        if (!CHANNELS) {
+            std::fill(out, out + nc, 0.0f);
+        }
+        const T* px = in + static_cast<std::size_t>(tx.first[x]) * nc;
+        for (int t = tx.offset[x]; t < tx.offset[x + 1]; ++t, px += nc) {
+            const float w = tx.weights[t];
+            for (int c = 0; c < nc; ++c) {
+                acc[c] += w * static_cast<float>(px[c]);
+            }
+        }
+        if (CHANNELS) {
+            std::copy(sum, sum + nc, out);
+        }
+    }
+}
+
+// 면적 평균으로 영상을 축소합니다 (채널 수 제한 없음).
+//
+// 원본 행마다 가로 축소를 한 번만 하고, 그 행을 덮는 출력 행(최대 2개)의
+// 누적 버퍼에 세로 가중치로 더하는 분리형 구현입니다.
+// src는 (sh, sw, channels), dst는 (dh, dw, channels) 형태의 C 연속 버퍼입니다.
+template <class T>
+void area_resize(const T* src, int sw, int sh, T* dst, int dw, int dh, int channels) {
+    const AreaTaps tx = area_taps(sw, dw);
+    const AreaTaps ty = area_taps(sh, dh);
+    const std::size_t out_row = static_cast<std::size_t>(dw) * channels;
+    const std::size_t in_row = static_cast<std::size_t>(sw) * channels;
+    std::vector<float> row(out_row);
+    std::vector<float> acc(out_row);
+    std::vector<float> next(out_row, 0.0f);  // 다음 출력 행과 공유하는 경계 행 몫
+    int shared = -1;                         // next에 누적된 원본 행 (없으면 -1)
+
+    auto reduce_row = [&](int j) {
+        const T* in = src + static_cast<std::size_t>(j) * in_row;
+        switch (channels) {
+            case 1: area_row<1>(in, row.data(), tx, dw, channels); break;
+            case 3: area_row<3>(in, row.data(), tx, dw, channels); break;
+            case 4: area_row<4>(in, row.data(), tx, dw, channels); break;
+            default: area_row<0>(in, row.data(), tx, dw, channels); break;
+        }
+    };
+
+    for (int y = 0; y < dh; ++y) {
+        std::fill(acc.begin(), acc.end(), 0.0f);
+        const int ny = ty.offset[y + 1] - ty.offset[y];
+        for (int k = 0; k < ny; ++k) {
+            const int j = ty.first[y] + k;
+            const float wy = ty.weights[ty.offset[y] + k];
+            if (j == shared) {
+                // 앞 출력 행에서 이미 가로 축소한 경계 행
+                for (std::size_t i = 0; i < out_row; ++i) {
+                    acc[i] += wy * next[i];
+                }
+                continue;
+            }
+            reduce_row(j);
+            for (std::size_t i = 0; i < out_row; ++i) {
+                acc[i] += wy * row[i];
+            }
+            if (k == ny - 1 && y + 1 < dh && ty.first[y + 1] == j) {
+                // 다음 출력 행도 이 원본 행을 덮는다
+                std::copy(row.begin(), row.end(), next.begin());
+                shared = j;
+            }
+        }
+        T* out = dst + static_cast<std::size_t>(y) * out_row;
+        for (std::size_t i = 0; i < out_row; ++i) {
+            out[i] = saturate<T>(acc[i]);
+        }
+    }
+}
+
+// 채널별 LUT를 적용합니다.
+//
+// lut는 (entries, channels) 형태이며, entries 이상의 값은 마지막 항목을 씁니다.
+template <class T>
+void apply_lut(const T* src, T* dst, std::size_t pixels, int channels,
+               const T* lut, std::size_t entries) {
+    const std::size_t last = entries - 1;
+    if (channels == 1) {
+        for (std::size_t i = 0; i < pixels; ++i) {
+            dst[i] = lut[std::min<std::size_t>(src[i], last)];
+        }
+        return;
+    }
+    for (std::size_t i = 0; i < pixels; ++i) {
+        const T* in = src + i * channels;
+        T* out = dst + i * channels;
+        for (int c = 0; c < channels; ++c) {
+            out[c] = lut[std::min<std::size_t>(in[c], last) * channels + c];
+        }
+    }
+}
+
+}  // namespace airphoto
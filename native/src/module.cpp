@@ -0,0 +1,185 @@
+// airphoto_viewer._native 파이썬 확장 모듈
+//
+// NumPy 배열을 버퍼 프로토콜로 받아 복사 없이 커널에 넘깁니다. 출력 배열은
+// 파이썬 쪽에서 할당해 전달하며, 계산하는 동안 GIL을 해제하므로 타일 작업자
+// 스레드들이 동시에 커널을 실행할 수 있습니다.
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include <cstring>
+#include <string>
+
+#include "airphoto/kernels.hpp"
+
+namespace {
+
+// Py_buffer를 해제하는 RAII 래퍼
+class Buffer {
+public:
+    Buffer() { std::memset(&view_, 0, sizeof(view_)); }
+    ~Buffer() {
+        if (view_.obj != nullptr) {
+            PyBuffer_Release(&view_);
+        }
+    }
+    Buffer(const Buffer&) = delete;
+    Buffer& operator=(const Buffer&) = delete;
+
+    // C 연속 버퍼를 얻습니다. 실패하면 파이썬 예외를 설정하고 false를 반환합니다.
+    bool acquire(PyObject* obj, bool writable) {
+        int flags = PyBUF_C_CONTIGUOUS | PyBUF_FORMAT | PyBUF_ND;
+        if (writable) {
+            flags |= PyBUF_WRITABLE;
+        }
+        return PyObject_GetBuffer(obj, &view_, flags) == 0;
+    }
+
+    const Py_buffer& view() const { return view_; }
+    void* data() const { return view_.buf; }
+    int ndim() const { return view_.ndim; }
+    Py_ssize_t dim(int i) const { return i < view_.ndim ? view_.shape[i] : 1; }
+    Py_ssize_t count() const { return view_.len / view_.itemsize; }
+
+    // 자료형 코드 ('B': uint8, 'H': uint16, 'f': float32, 그 외 0)
+    char kind() const {
+        const char* format = view_.format != nullptr ? view_.format : "B";
+        if (*format == '<' || *format == '=' || *format == '@') {
+            ++format;
+        }
+        if (format[1] != '\0') {
+            return 0;
+        }
+        if ((*format == 'B' && view_.itemsize == 1) || (*format == 'H' && view_.itemsize == 2) ||
+            (*format == 'f' && view_.itemsize == 4)) {
+            return *format;
+        }
+        return 0;
+    }
+
+private:
+    Py_buffer view_;
+};
+
+// 영상 버퍼 형태를 확인합니다 (PyErr_Format은 ASCII 형식 문자열만 받으므로 직접 조립)
+bool check_image(const Buffer& buffer, const std::string& name) {
+    if (buffer.ndim() != 2 && buffer.ndim() != 3) {
+        PyErr_SetString(PyExc_ValueError, (name + "는 2차원 또는 3차원 배열이어야 합니다.").c_str());
+        return false;
+    }
+    if (buffer.kind() == 0) {
+        PyErr_SetString(PyExc_ValueError,
+                        (name + "의 자료형은 uint8, uint16, float32만 지원합니다.").c_str());
+        return false;
+    }
+    return true;
+}
+
+PyObject* area_resize(PyObject*, PyObject* args) {
+    PyObject* src_obj;
+    PyObject* dst_obj;
+    if (!PyArg_ParseTuple(args, "OO:area_resize", &src_obj, &dst_obj)) {
+        return nullptr;
+    }
+    Buffer src;
+    Buffer dst;
+    if (!src.acquire(src_obj, false) || !dst.acquire(dst_obj, true)) {
+        return nullptr;
+    }
+    if (!check_image(src, "src") || !check_image(dst, "dst")) {
+        return nullptr;
+    }
+    if (src.kind() != dst.kind() || src.dim(2) != dst.dim(2)) {
+        PyErr_SetString(PyExc_ValueError, "src와 dst의 자료형과 채널 수가 같아야 합니다.");
+        return nullptr;
+    }
+    const int sw = static_cast<int>(src.dim(1));
+    const int sh = static_cast<int>(src.dim(0));
+    const int dw = static_cast<int>(dst.dim(1));
+    const int dh = static_cast<int>(dst.dim(0));
+    const int channels = static_cast<int>(src.dim(2));
+    if (dw <= 0 || dh <= 0 || dw > sw || dh > sh) {
+        PyErr_SetString(PyExc_ValueError, "출력 크기는 1 이상이고 입력 크기 이하여야 합니다.");
+        return nullptr;
+    }
+
+    const char kind = src.kind();
+    Py_BEGIN_ALLOW_THREADS
+    if (kind == 'B') {
+        airphoto::area_resize(static_cast<const uint8_t*>(src.data()), sw, sh,
+                              static_cast<uint8_t*>(dst.data()), dw, dh, channels);
+    } else if (kind == 'H') {
+        airphoto::area_resize(static_cast<const uint16_t*>(src.data()), sw, sh,
+                              static_cast<uint16_t*>(dst.data()), dw, dh, channels);
+    } else {
+        airphoto::area_resize(static_cast<const float*>(src.data()), sw, sh,
+                              static_cast<float*>(dst.data()), dw, dh, channels);
+    }
+    Py_END_ALLOW_THREADS
+    Py_RETURN_NONE;
+}
+
+PyObject* apply_lut(PyObject*, PyObject* args) {
+    PyObject* src_obj;
+    PyObject* lut_obj;
+    PyObject* dst_obj;
+    if (!PyArg_ParseTuple(args, "OOO:apply_lut", &src_obj, &lut_obj, &dst_obj)) {
+        return nullptr;
+    }
+    Buffer src;
+    Buffer lut;
+    Buffer dst;
+    if (!src.acquire(src_obj, false) || !lut.acquire(lut_obj, false) ||
+        !dst.acquire(dst_obj, true)) {
+        return nullptr;
+    }
+    const char kind = src.kind();
+    if (kind != 'B' && kind != 'H') {
+        PyErr_SetString(PyExc_ValueError, "LUT는 uint8, uint16 배열에만 적용할 수 있습니다.");
+        return nullptr;
+    }
+    if (lut.kind() != kind || dst.kind() != kind || dst.count() != src.count()) {
+        PyErr_SetString(PyExc_ValueError, "src, lut, dst의 자료형과 dst 크기가 맞아야 합니다.");
+        return nullptr;
+    }
+    // 2차원 배열은 단일 채널, 3차원 배열은 마지막 축이 채널이다
+    const int channels = src.ndim() == 3 ? static_cast<int>(src.dim(2)) : 1;
+    if (lut.ndim() != 2 || lut.dim(1) != channels || lut.dim(0) == 0) {
+        PyErr_SetString(PyExc_ValueError, "lut는 (항목 수, 채널 수) 형태여야 합니다.");
+        return nullptr;
+    }
+    const std::size_t pixels = static_cast<std::size_t>(src.count()) / channels;
+    const std::size_t entries = static_cast<std::size_t>(lut.dim(0));
+
+    Py_BEGIN_ALLOW_THREADS
+    if (kind == 'B') {
+        airphoto::apply_lut(static_cast<const uint8_t*>(src.data()),
+                            static_cast<uint8_t*>(dst.data()), pixels, channels,
+                            static_cast<const uint8_t*>(lut.data()), entries);
+    } else {
+        airphoto::apply_lut(static_cast<const uint16_t*>(src.data()),
+                            static_cast<uint16_t*>(dst.data()), pixels, channels,
+                            static_cast<const uint16_t*>(lut.data()), entries);
+    }
+    Py_END_ALLOW_THREADS
+    Py_RETURN_NONE;
+}
+
+PyMethodDef methods[] = {
+    {"area_resize", area_resize, METH_VARARGS,
+     "area_resize(src, dst)\n\n면적 평균으로 src를 dst 크기로 축소해 dst에 씁니다."},
+    {"apply_lut", apply_lut, METH_VARARGS,
+     "apply_lut(src, lut, dst)\n\n채널별 LUT (항목 수, 채널 수)를 적용해 dst에 씁니다."},
+    {nullptr, nullptr, 0, nullptr},
+};
+
+PyModuleDef module = {
+    PyModuleDef_HEAD_INIT, "_native", "항공사진 뷰어 네이티브 커널", -1, methods,
+    nullptr, nullptr, nullptr, nullptr,
+};
+
+}  // namespace
+
+PyMODINIT_FUNC PyInit__native() {
+    return PyModule_Create(&module);
+}
@@ -0,0 +1,195 @@
+// 네이티브 커널 단위 테스트
+//
+// 파이썬 없이 kernels.hpp만으로 빌드하며, CTest로 실행합니다.
+// Release 빌드에서도 검사가 빠지지 않도록 assert 대신 CHECK 매크로를 씁니다.
+
+#include <airphoto/kernels.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+int failures = 0;
+
+#define CHECK(cond)                                                        \
+    do {                                                                   \
+        if (!(cond)) {                                                     \
+            std::fprintf(stderr, "%s:%d: 실패: %s\n", __FILE__, __LINE__, #cond); \
+            ++failures;                                                    \
+        }                                                                  \
+    } while (0)
+
+bool near(float a, float b, float eps = 1e-5f) { return std::fabs(a - b) <= eps; }
+
+// 정수배 축소: 출력 칸마다 원본 두 칸을 반씩
+void test_taps_integer_factor() {
+    const airphoto::AreaTaps taps = airphoto::area_taps(4, 2);
+    CHECK((taps.first == std::vector<int>{0, 2}));
+    CHECK((taps.offset == std::vector<int>{0, 2, 4}));
+    CHECK(taps.weights.size() == 4);
+    for (float w : taps.weights) {
+        CHECK(near(w, 0.5f));
+    }
+}
+
+// 비정수배 축소 3 → 2: 출력 0은 [0, 1.5), 출력 1은 [1.5, 3)을 덮는다
+void test_taps_fractional_factor() {
+    const airphoto::AreaTaps taps = airphoto::area_taps(3, 2);
+    CHECK((taps.first == std::vector<int>{0, 1}));
+    CHECK((taps.offset == std::vector<int>{0, 2, 4}));
+    CHECK(taps.weights.size() == 4);
+    CHECK(near(taps.weights[0], 2.0f / 3.0f));
+    CHECK(near(taps.weights[1], 1.0f / 3.0f));
+    CHECK(near(taps.weights[2], 1.0f / 3.0f));
+    CHECK(near(taps.weights[3], 2.0f / 3.0f));
+}
+
+// 같은 크기는 항등 가중치
+void test_taps_identity() {
+    const airphoto::AreaTaps taps = airphoto::area_taps(5, 5);
+    CHECK((taps.first == std::vector<int>{0, 1, 2, 3, 4}));
+    CHECK((taps.offset == std::vector<int>{0, 1, 2, 3, 4, 5}));
+    for (float w : taps.weights) {
+        CHECK(near(w, 1.0f));
+    }
+}
+
+// 가중치 합은 항상 1
+void test_taps_sum_to_one() {
+    for (int src = 1; src <= 40; ++src) {
+        for (int dst = 1; dst <= src; ++dst) {
+            const airphoto::AreaTaps taps = airphoto::area_taps(src, dst);
+            for (int i = 0; i < dst; ++i) {
+                float sum = 0.0f;
+                for (int t = taps.offset[i]; t < taps.offset[i + 1]; ++t) {
+                    sum += taps.weights[t];
+                }
+                CHECK(near(sum, 1.0f, 1e-4f));
+            }
+        }
+    }
+}
+
+void test_resize_2x2_to_1x1() {
+    const std::uint8_t src[] = {10, 20, 30, 40};
+    std::uint8_t dst[1] = {};
+    airphoto::area_resize(src, 2, 2, dst, 1, 1, 1);
+    CHECK(dst[0] == 25);
+}
+
+// 한 행 3 → 2: 0·2/3 + 90·1/3 = 30, 90·1/3 + 180·2/3 = 150
+void test_resize_fractional_row() {
+    const std::uint8_t src[] = {0, 90, 180};
+    std::uint8_t dst[2] = {};
+    airphoto::area_resize(src, 3, 1, dst, 2, 1, 1);
+    CHECK(dst[0] == 30);
+    CHECK(dst[1] == 150);
+}
+
+// 3 x 3 → 2 x 2: 세로 경계 행을 두 출력 행이 나눠 쓰는 경로
+void test_resize_shared_row() {
+    const std::uint16_t src[] = {
+        0, 0, 0,
+        900, 900, 900,
+        1800, 1800, 1800,
+    };
+    std::uint16_t dst[4] = {};
+    airphoto::area_resize(src, 3, 3, dst, 2, 2, 1);
+    CHECK(dst[0] == 300 && dst[1] == 300);
+    CHECK(dst[2] == 1500 && dst[3] == 1500);
+}
+
+// 채널 수 제한 없음 (5채널), 채널은 서로 섞이지 않는다
+void test_resize_many_channels() {
+    const int channels = 5;
+    std::vector<std::uint16_t> src(2 * 2 * channels);
+    for (int p = 0; p < 4; ++p) {
+        for (int c = 0; c < channels; ++c) {
+            src[p * channels + c] = static_cast<std::uint16_t>(1000 * c + 100 * p);
+        }
+    }
+    std::vector<std::uint16_t> dst(channels);
+    airphoto::area_resize(src.data(), 2, 2, dst.data(), 1, 1, channels);
+    for (int c = 0; c < channels; ++c) {
+        CHECK(dst[c] == 1000 * c + 150);
+    }
+}
+
+// 실수형은 반올림하지 않는다
+void test_resize_float() {
+    const float src[] = {0.1f, 0.2f};
+    float dst[1] = {};
+    airphoto::area_resize(src, 2, 1, dst, 1, 1, 1);
+    CHECK(near(dst[0], 0.15f));
+}
+
+// 정수형 포화: 최댓값 근처에서 넘치지 않는다
+void test_resize_saturates() {
+    const std::uint8_t src[] = {255, 255, 255, 255};
+    std::uint8_t dst[1] = {};
+    airphoto::area_resize(src, 2, 2, dst, 1, 1, 1);
+    CHECK(dst[0] == 255);
+    CHECK(airphoto::saturate<std::uint8_t>(300.0f) == 255);
+    CHECK(airphoto::saturate<std::uint8_t>(-5.0f) == 0);
+    CHECK(airphoto::saturate<std::uint16_t>(70000.0f) == 65535);
+}
+
+// 8비트 LUT의 양 끝 값
+void test_lut_uint8_edges() {
+    std::vector<std::uint8_t> lut(256);
+    for (int i = 0; i < 256; ++i) {
+        lut[i] = static_cast<std::uint8_t>(255 - i);
+    }
+    const std::uint8_t src[] = {0, 1, 254, 255};
+    std::uint8_t dst[4] = {};
+    airphoto::apply_lut(src, dst, 4, 1, lut.data(), lut.size());
+    CHECK(dst[0] == 255 && dst[1] == 254 && dst[2] == 1 && dst[3] == 0);
+}
+
+// 항목 수보다 큰 값은 마지막 항목을 쓴다
+void test_lut_clamps_to_last_entry() {
+    const std::uint16_t lut[] = {7, 8, 9};
+    const std::uint16_t src[] = {0, 2, 3, 65535};
+    std::uint16_t dst[4] = {};
+    airphoto::apply_lut(src, dst, 4, 1, lut, 3);
+    CHECK(dst[0] == 7 && dst[1] == 9 && dst[2] == 9 && dst[3] == 9);
+}
+
+// 다채널 LUT는 (항목, 채널) 순서로 채널마다 다른 열을 쓴다
+void test_lut_per_channel() {
+    // 항목 0..3, 채널 2: 채널 0은 항등, 채널 1은 10배
+    const std::uint16_t lut[] = {0, 0, 1, 10, 2, 20, 3, 30};
+    const std::uint16_t src[] = {1, 1, 3, 2, 65535, 0};
+    std::uint16_t dst[6] = {};
+    airphoto::apply_lut(src, dst, 3, 2, lut, 4);
+    CHECK(dst[0] == 1 && dst[1] == 10);
+    CHECK(dst[2] == 3 && dst[3] == 20);
+    CHECK(dst[4] == 3 && dst[5] == 0);
+}
+
+}  // namespace
+
+int main() {
+    test_taps_integer_factor();
+    test_taps_fractional_factor();
+    test_taps_identity();
+    test_taps_sum_to_one();
+    test_resize_2x2_to_1x1();
+    test_resize_fractional_row();
+    test_resize_shared_row();
+    test_resize_many_channels();
+    test_resize_float();
+    test_resize_saturates();
+    test_lut_uint8_edges();
+    test_lut_clamps_to_last_entry();
+    test_lut_per_channel();
+    if (failures) {
+        std::fprintf(stderr, "%d개 검사 실패\n", failures);
+        return 1;
+    }
+    std::printf("모든 검사 통과\n");
+    return 0;
+}
@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+"""
+타일 완료 통지 벤치마크 스크립트
+
+이 스크립트는 작업자 스레드들이 완료한 타일 키를 메인 스레드로 넘기는 두 방식의
+타일당 전달 비용을 비교합니다.
+
+1. 타일마다 메인 스레드로 큐잉되는 Qt 시그널 발생
+2. `CompletionQueue`에 넣고 메인 스레드가 깨어날 때 한꺼번에 꺼냄
+
+측정값은 모든 키가 메인 스레드에 도착할 때까지 걸린 시간을 키 수로 나눈 값과,
+메인 스레드가 처리한 이벤트(깨우기) 수입니다.
+"""
+
+import argparse
+import sys
+import threading
+import time
+from pathlib import Path
+
+from PyQt6.QtCore import QCoreApplication, QObject, pyqtSignal
+
+# 프로젝트 루트 디렉토리를 시스템 경로에 추가
+project_root = Path(__file__).parent.parent
+sys.path.append(str(project_root / "src"))
+
+from airphoto_viewer.core.tile.completion_queue import CompletionQueue
+
+
+class SignalReceiver(QObject):
+    """타일마다 시그널을 받는 수신자"""
+
+    tile_ready = pyqtSignal(object)
+
+    def __init__(self, total: int):
+        super().__init__()
+        self.total = total
+        self.received = 0
+        self.events = 0
+        self.tile_ready.connect(self._on_tile_ready)
+
+    def push(self, key) -> None:
+        self.tile_ready.emit(key)
+
+    def _on_tile_ready(self, key) -> None:
+        self.events += 1
+        self.received += 1
+        if self.received == self.total:
+            QCoreApplication.quit()
+
+
+class QueueReceiver(QObject):
+    """완료 큐를 한꺼번에 꺼내는 수신자"""
+
+    _tiles_ready = pyqtSignal()
+
+    def __init__(self, total: int):
+        super().__init__()
+        self.total = total
+        self.received = 0
+        self.events = 0
+        self.queue = CompletionQueue(self._tiles_ready.emit)
+        self.push = self.queue.push
+        self._tiles_ready.connect(self._on_tiles_ready)
+
+    def _on_tiles_ready(self) -> None:
+        self.events += 1
+        self.received += len(self.queue.drain())
+        if self.received == self.total:
+            QCoreApplication.quit()
+
+
+def run(app: QCoreApplication, receiver_class, producers: int, count: int) -> None:
+    """생산자 스레드들이 키를 보내고 메인 스레드가 모두 받을 때까지 측정합니다."""
+    total = producers * count
+    receiver = receiver_class(total)
+
+    def produce(index: int) -> None:
+        push = receiver.push
+        for i in range(count):
+            push(("bench", 0, index, i))
+
+    threads = [threading.Thread(target=produce, args=(i,)) for i in range(producers)]
+    start = time.perf_counter()
+    for thread in threads:
+        thread.start()
+    app.exec()
+    elapsed = time.perf_counter() - start
+    for thread in threads:
+        thread.join()
+    print(f"{receiver_class.__doc__:<24} 키 {total}개: {elapsed * 1e6 / total:6.2f} us/키, "
+          f"메인 스레드 이벤트 {receiver.events}개")
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description="타일 완료 통지 벤치마크")
+    parser.add_argument("--producers", type=int, default=4, help="생산자 스레드 수")
+    parser.add_argument("--count", type=int, default=50000, help="스레드당 키 수")
+    args = parser.parse_args()
+
+    app = QCoreApplication(sys.argv)
+    run(app, SignalReceiver, args.producers, args.count)
+    run(app, QueueReceiver, args.producers, args.count)
+
+
+if __name__ == "__main__":
+    main()
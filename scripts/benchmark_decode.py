@@ -0,0 +1,94 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+"""
+디코딩 풀 벤치마크 스크립트
+
+이 스크립트는 임시 JPEG 프레임으로 모자이크를 만들고, 한 레벨의 모든 타일을
+스레드 풀로 읽는 처리량을 비교합니다.
+
+1. 스레드 디코딩: 타일 작업자 스레드가 직접 프레임을 디코딩
+2. 프로세스 디코딩: 프레임 디코딩을 `DecodePool` 작업자 프로세스에 맡기고
+   결과는 공유 메모리 슬롯으로 받음
+"""
+
+import argparse
+import os
+import sys
+import tempfile
+import time
+from concurrent.futures import ThreadPoolExecutor
+from pathlib import Path
+
+import cv2
+import numpy as np
+
+# 프로젝트 루트 디렉토리를 시스템 경로에 추가
+project_root = Path(__file__).parent.parent
+sys.path.append(str(project_root / "src"))
+
+from airphoto_viewer.core.tile.decode_pool import DecodePool
+from airphoto_viewer.core.tile.mosaic import MosaicFrame, MosaicSource
+from airphoto_viewer.core.tile.tile import TileCoord
+from airphoto_viewer.core.tile.tile_cache import TileCache
+
+
+def make_frames(directory: str, count: int, width: int, height: int):
+    """격자로 배치한 JPEG 프레임 목록을 만듭니다."""
+    rng = np.random.default_rng(0)
+    base = rng.integers(0, 255, (height // 8, width // 8, 3), dtype=np.uint8)
+    columns = int(np.ceil(np.sqrt(count)))
+    frames = []
+    for i in range(count):
+        path = os.path.join(directory, f"frame_{i:04d}.jpg")
+        image = cv2.resize(np.roll(base, i * 7, axis=1), (width, height),
+                           interpolation=cv2.INTER_CUBIC)
+        cv2.imwrite(path, image, [cv2.IMWRITE_JPEG_QUALITY, 90])
+        frames.append(MosaicFrame(path, (i % columns) * width, (i // columns) * height,
+                                  width, height))
+    return frames
+
+
+def read_level(frames, level: int, threads: int, pool=None):
+    """한 레벨의 모든 타일을 읽고 (타일 수, 초)를 반환합니다."""
+    source = MosaicSource(frames, cache=TileCache(2048), decode_pool=pool)
+    columns, rows = source.tile_grid(level)
+    coords = [TileCoord(level, col, row) for row in range(rows) for col in range(columns)]
+    start = time.perf_counter()
+    with ThreadPoolExecutor(threads) as executor:
+        list(executor.map(source.get_tile, coords))
+    return len(coords), time.perf_counter() - start
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description="디코딩 풀 벤치마크")
+    parser.add_argument("--frames", type=int, default=24, help="프레임 수")
+    parser.add_argument("--width", type=int, default=4000, help="프레임 너비")
+    parser.add_argument("--height", type=int, default=3000, help="프레임 높이")
+    parser.add_argument("--level", type=int, default=1, help="읽을 피라미드 레벨")
+    parser.add_argument("--workers", type=int, default=os.cpu_count() or 1,
+                        help="작업자 스레드/프로세스 수")
+    args = parser.parse_args()
+
+    with tempfile.TemporaryDirectory() as directory:
+        print(f"프레임 {args.frames}개 ({args.width}x{args.height}) 생성 중...")
+        frames = make_frames(directory, args.frames, args.width, args.height)
+
+        count, elapsed = read_level(frames, args.level, args.workers)
+        print(f"스레드 디코딩 ({args.workers}): 타일 {count}개 {elapsed:.2f}초, "
+              f"{count / elapsed:.0f} 타일/초, {args.frames / elapsed:.1f} 프레임/초")
+
+        pool = DecodePool(args.workers)
+        try:
+            # 작업자 프로세스 시작 비용은 제외한다
+            pool.decode(frames[0].path, 8)
+            # 스레드가 모두 풀을 기다리므로 디코딩 동시성은 프로세스 수가 정한다
+            count, elapsed = read_level(frames, args.level, 2 * args.workers, pool)
+        finally:
+            pool.close()
+        print(f"프로세스 디코딩 ({args.workers}): 타일 {count}개 {elapsed:.2f}초, "
+              f"{count / elapsed:.0f} 타일/초, {args.frames / elapsed:.1f} 프레임/초")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,105 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+"""
+네이티브 커널 벤치마크 스크립트
+
+이 스크립트는 `airphoto_viewer._native`의 면적 축소와 LUT 커널을 OpenCV/NumPy
+경로와 비교합니다. 결과가 같은지(정수형은 반올림 차이 1 이내) 함께 확인하고,
+GIL 해제 효과를 보기 위해 여러 스레드에서 동시에 실행한 처리량도 출력합니다.
+
+먼저 확장 모듈을 빌드해야 합니다:
+    cmake -S native -B build/native && cmake --build build/native
+"""
+
+import argparse
+import sys
+import time
+from concurrent.futures import ThreadPoolExecutor
+from pathlib import Path
+
+import cv2
+import numpy as np
+
+# 프로젝트 루트 디렉토리를 시스템 경로에 추가
+project_root = Path(__file__).parent.parent
+sys.path.append(str(project_root / "src"))
+
+from airphoto_viewer.utils import native
+
+
+def measure(func, repeat: int) -> float:
+    """함수를 반복 실행하여 호출당 평균 시간(ms)을 반환합니다."""
+    func()
+    start = time.perf_counter()
+    for _ in range(repeat):
+        func()
+    return (time.perf_counter() - start) / repeat * 1000
+
+
+def opencv_area(array: np.ndarray, size) -> np.ndarray:
+    """OpenCV INTER_AREA 축소 (4채널 초과는 나누어 처리)."""
+    if array.ndim == 2 or array.shape[2] <= 4:
+        return cv2.resize(array, size, interpolation=cv2.INTER_AREA)
+    parts = [cv2.resize(np.ascontiguousarray(array[..., i:i + 4]), size,
+                        interpolation=cv2.INTER_AREA) for i in range(0, array.shape[2], 4)]
+    return np.dstack(parts)
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description="네이티브 커널 벤치마크")
+    parser.add_argument("--size", type=int, default=4001, help="입력 영상 한 변 (홀수면 비정수 배율)")
+    parser.add_argument("--repeat", type=int, default=5, help="반복 횟수")
+    parser.add_argument("--threads", type=int, default=4, help="동시 실행 스레드 수")
+    args = parser.parse_args()
+
+    module = native.get_native()
+    if module is None:
+        sys.exit("네이티브 확장을 찾을 수 없습니다. 빌드한 뒤 AIRPHOTO_NATIVE_DIR을 "
+                 "빌드 디렉토리로 설정하세요 (예: build/native).")
+
+    rng = np.random.default_rng(0)
+    n = args.size
+    size = ((n + 1) // 2, (n + 1) // 2)
+    print(f"면적 축소 {n}x{n} -> {size[0]}x{size[1]} (ms)")
+    print(f"{'자료형':>8} {'채널':>4} {'OpenCV':>8} {'네이티브':>8} {'최대 차이':>8}")
+    for dtype in (np.uint8, np.uint16, np.float32):
+        for channels in (1, 3, 4, 8):
+            shape = (n, n) if channels == 1 else (n, n, channels)
+            array = (rng.random(shape) * 250).astype(dtype)
+            ref = opencv_area(array, size)
+            out = native.area_resize(array, size)
+            diff = np.abs(out.astype(np.float64) - ref.reshape(out.shape)).max()
+            t_cv = measure(lambda: opencv_area(array, size), args.repeat)
+            t_native = measure(lambda: native.area_resize(array, size), args.repeat)
+            print(f"{np.dtype(dtype).name:>8} {channels:>4} {t_cv:8.1f} {t_native:8.1f} {diff:8.2f}")
+
+    print()
+    print(f"LUT {n}x{n}x3 (ms)")
+    for dtype, entries in ((np.uint8, 256), (np.uint16, 65536)):
+        array = (rng.random((n, n, 3)) * (entries - 1)).astype(dtype)
+        lut = (rng.random((entries, 3)) * (entries - 1)).astype(dtype)
+        if dtype == np.uint8:
+            cv_lut = np.ascontiguousarray(lut.reshape(1, 256, 3))
+            baseline, label = (lambda: cv2.LUT(array, cv_lut)), "OpenCV"
+        else:
+            index = np.arange(3)
+            baseline, label = (lambda: lut[array, index]), "NumPy"
+        assert np.array_equal(native.apply_lut(array, lut), lut[array, np.arange(3)])
+        print(f"{np.dtype(dtype).name:>8} {label} {measure(baseline, args.repeat):8.1f}"
+              f"  네이티브 {measure(lambda: native.apply_lut(array, lut), args.repeat):8.1f}")
+
+    # GIL을 해제하므로 스레드 수만큼(코어 수 이내) 처리량이 늘어야 한다
+    print()
+    array = (rng.random((n, n, 8)) * 250).astype(np.uint8)
+    single = measure(lambda: native.area_resize(array, size), args.repeat)
+    with ThreadPoolExecutor(args.threads) as pool:
+        def parallel():
+            list(pool.map(lambda _: native.area_resize(array, size), range(args.threads)))
+        batch = measure(parallel, args.repeat)
+    print(f"스레드 {args.threads}개 동시 실행: 호출당 {batch / args.threads:.1f} ms "
+          f"(단일 {single:.1f} ms, 배속 {single * args.threads / batch:.2f})")
+
+
+if __name__ == "__main__":
+    main()
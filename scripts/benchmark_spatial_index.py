@@ -0,0 +1,96 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+"""
+공간 색인 벤치마크 스크립트
+
+이 스크립트는 PackedRTree의 적재 시간과 사각형/점 질의 지연 시간을
+수백만 개의 무작위 풋프린트로 측정합니다. 메모리 맵으로 다시 연 트리의
+질의 시간도 함께 출력합니다.
+"""
+
+import argparse
+import os
+import sys
+import tempfile
+import time
+from pathlib import Path
+
+import numpy as np
+
+# 프로젝트 루트 디렉토리를 시스템 경로에 추가
+project_root = Path(__file__).parent.parent
+sys.path.append(str(project_root / "src"))
+
+from airphoto_viewer.utils.spatial_index import PackedRTree
+
+
+def measure(label: str, func, repeat: int) -> None:
+    """함수를 반복 실행하여 호출당 평균/최대 지연 시간을 출력합니다.
+
+    Args:
+        label: 출력 이름
+        func: 인수 없이 호출할 함수 (반환값은 결과 개수)
+        repeat: 반복 횟수
+    """
+    times = []
+    hits = 0
+    for _ in range(repeat):
+        start = time.perf_counter()
+        hits += func()
+        times.append(time.perf_counter() - start)
+    times = np.array(times) * 1000
+    print(f"  - {label}: 평균 {times.mean():.3f} ms, p99 {np.percentile(times, 99):.3f} ms, "
+          f"평균 결과 {hits / repeat:.1f}개")
+
+
+def _viewport(point):
+    """좌상단 점에서 4000 x 3000 뷰포트 사각형을 만듭니다."""
+    x, y = point
+    return (x, y, x + 4000, y + 3000)
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description="PackedRTree 벤치마크")
+    parser.add_argument("--count", type=int, default=2_000_000, help="항목 수")
+    parser.add_argument("--extent", type=float, default=1e7, help="좌표 범위")
+    parser.add_argument("--repeat", type=int, default=2000, help="질의 반복 횟수")
+    args = parser.parse_args()
+
+    rng = np.random.default_rng(0)
+    origin = rng.uniform(0, args.extent, (args.count, 2))
+    size = rng.uniform(10, 6000, (args.count, 2))
+    boxes = np.hstack([origin, origin + size])
+
+    print(f"\n{'='*50}")
+    print(f"PackedRTree 벤치마크: {args.count:,}개 항목")
+    print("-" * 50)
+
+    start = time.perf_counter()
+    tree = PackedRTree(boxes)
+    print(f"  - 적재: {time.perf_counter() - start:.2f} s")
+
+    # 화면 하나 크기(약 4000 x 3000)의 뷰포트 질의
+    viewports = rng.uniform(0, args.extent, (args.repeat, 2))
+    points = iter(viewports.tolist())
+    measure("사각형 질의", lambda: len(tree.query(*_viewport(next(points)))), args.repeat)
+    points = iter(viewports.tolist())
+    measure("점 질의", lambda: len(tree.query_point(*next(points))), args.repeat)
+
+    with tempfile.TemporaryDirectory() as tmp:
+        path = os.path.join(tmp, "footprints.rtree")
+        tree.save(path)
+        start = time.perf_counter()
+        mapped = PackedRTree.load(path)
+        print(f"  - 메모리 맵 열기: {(time.perf_counter() - start) * 1000:.3f} ms "
+              f"({os.path.getsize(path) / 1e6:.1f} MB)")
+        points = iter(viewports.tolist())
+        measure("사각형 질의 (메모리 맵)",
+                lambda: len(mapped.query(*_viewport(next(points)))), args.repeat)
+        del mapped
+
+    print("="*50 + "\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+"""
+뷰어 시작 시간 벤치마크 스크립트
+
+이 스크립트는 두 가지를 측정합니다.
+
+1. `python -X importtime`으로 뷰어 엔진을 가져올 때 누적 시간이 큰 모듈 목록
+2. 새 프로세스를 띄운 시점부터 메인 창이 처음 그려질 때까지의 시간과,
+   백그라운드 모듈 가져오기가 끝나 첫 탭이 준비될 때까지의 시간
+
+화면이 없는 환경에서는 QT_QPA_PLATFORM=offscreen으로 실행합니다.
+"""
+
+import argparse
+import os
+import subprocess
+import sys
+import time
+from pathlib import Path
+
+# 프로젝트 루트 디렉토리를 시스템 경로에 추가
+project_root = Path(__file__).parent.parent
+source_root = project_root / "src"
+
+ENGINE_MODULE = "airphoto_viewer.core.render.viewer_engine"
+
+# 자식 프로세스에서 창을 띄우고 첫 그리기/시작 완료 시점을 출력하는 코드
+CHILD_SCRIPT = f"""
+import sys
+from PyQt6.QtCore import QEvent, QObject, QTimer
+from PyQt6.QtWidgets import QApplication
+from {ENGINE_MODULE} import ImageViewer
+
+class FirstPaint(QObject):
+    done = False
+    def eventFilter(self, obj, event):
+        if not self.done and event.type() == QEvent.Type.Paint:
+            self.done = True
+            print("first_window", flush=True)
+        return False
+
+app = QApplication(sys.argv)
+app.setStyle('Fusion')
+viewer = ImageViewer()
+watcher = FirstPaint()
+viewer.installEventFilter(watcher)
+viewer.show()
+
+def poll():
+    if viewer.tabs.count() > 0:
+        print("ready", flush=True)
+        app.quit()
+    else:
+        QTimer.singleShot(5, poll)
+
+QTimer.singleShot(0, poll)
+app.exec()
+"""
+
+
+def child_env() -> dict:
+    """자식 프로세스 환경 변수를 반환합니다 (src를 모듈 경로에 추가)."""
+    env = dict(os.environ)
+    env["PYTHONPATH"] = os.pathsep.join(filter(None, [str(source_root),
+                                                      env.get("PYTHONPATH")]))
+    return env
+
+
+def import_breakdown(top: int) -> None:
+    """`-X importtime` 결과에서 누적 시간이 큰 모듈을 출력합니다.
+
+    Args:
+        top: 출력할 모듈 수
+    """
+    result = subprocess.run([sys.executable, "-X", "importtime", "-c", f"import {ENGINE_MODULE}"],
+                            env=child_env(), capture_output=True, text=True, check=True)
+    rows = []
+    for line in result.stderr.splitlines():
+        if not line.startswith("import time:") or "cumulative" in line:
+            continue
+        # 형식: "import time: self | cumulative | name" (시간은 마이크로초)
+        fields = line[len("import time:"):].split("|")
+        self_us, cumulative_us, name = int(fields[0]), int(fields[1]), fields[2]
+        rows.append((cumulative_us, self_us, name.rstrip()))
+
+    total = next((c for c, _, n in rows if n.strip() == ENGINE_MODULE), 0)
+    print(f"{ENGINE_MODULE} 가져오기: {total / 1000:.1f} ms")
+    print(f"{'누적(ms)':>10} {'자체(ms)':>10}  모듈")
+    for cumulative_us, self_us, name in sorted(rows, reverse=True)[:top]:
+        print(f"{cumulative_us / 1000:10.1f} {self_us / 1000:10.1f}  {name}")
+
+
+def time_to_window() -> tuple:
+    """새 프로세스에서 첫 창 그리기와 시작 완료까지의 시간(ms)을 반환합니다."""
+    start = time.perf_counter()
+    process = subprocess.Popen([sys.executable, "-c", CHILD_SCRIPT], env=child_env(),
+                               stdout=subprocess.PIPE, text=True)
+    marks = {}
+    for line in process.stdout:
+        marks[line.strip()] = (time.perf_counter() - start) * 1000
+    process.wait()
+    if "first_window" not in marks or "ready" not in marks:
+        raise RuntimeError(f"자식 프로세스가 비정상 종료했습니다 (코드 {process.returncode})")
+    return marks["first_window"], marks["ready"]
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description="뷰어 시작 시간 벤치마크")
+    parser.add_argument("--repeat", type=int, default=5, help="창 띄우기 반복 횟수")
+    parser.add_argument("--top", type=int, default=15, help="출력할 가져오기 모듈 수")
+    args = parser.parse_args()
+
+    import_breakdown(args.top)
+
+    # 첫 실행은 디스크 캐시/바이트코드 생성 영향이 있어 버린다
+    time_to_window()
+    results = [time_to_window() for _ in range(args.repeat)]
+    windows = sorted(window for window, _ in results)
+    readies = sorted(ready for _, ready in results)
+    print()
+    print(f"첫 창까지: 중앙값 {windows[len(windows) // 2]:.0f} ms, "
+          f"최소 {windows[0]:.0f} ms, 최대 {windows[-1]:.0f} ms")
+    print(f"시작 완료(첫 탭)까지: 중앙값 {readies[len(readies) // 2]:.0f} ms, "
+          f"최소 {readies[0]:.0f} ms, 최대 {readies[-1]:.0f} ms")
+
+
+if __name__ == "__main__":
+    main()
@@ -4,18 +4,37 @@
 이 모듈은 이미지 처리, 타일 생성, 렌더링 등 핵심 기능을 제공합니다.
 """
 
+import os
 from pathlib import Path
 from typing import Optional
 
 # 버전 정보
 __version__ = "0.1.0"
 
+# init()으로 설정된 캐시 디렉토리
+_cache_dir: Optional[Path] = None
+
+
+def default_cache_dir() -> Path:
+    """플랫폼 기본 사용자 캐시 디렉토리 아래의 경로를 반환합니다."""
+    base = os.environ.get("XDG_CACHE_HOME") or os.environ.get("LOCALAPPDATA")
+    return Path(base or Path.home() / ".cache") / "airphoto_viewer"
+
+
 # 모듈 초기화
 def init(cache_dir: Optional[Path] = None) -> None:
     """모듈을 초기화합니다.
-    
+
     Args:
         cache_dir: 캐시 디렉토리 경로. None인 경우 기본 경로 사용
     """
-    # 필요한 초기화 로직 추가
-    pass
+    global _cache_dir
+    _cache_dir = Path(cache_dir) if cache_dir is not None else default_cache_dir()
+    _cache_dir.mkdir(parents=True, exist_ok=True)
+
+
+def get_cache_dir() -> Path:
+    """캐시 디렉토리를 반환합니다. init()이 호출되지 않았으면 기본 경로로 초기화합니다."""
+    if _cache_dir is None:
+        init()
+    return _cache_dir
@@ -4,6 +4,39 @@
 이 모듈은 이미지 로딩, 변환, 처리 기능을 제공합니다.
 """
 
-from .image_data import ImageData, ImageMetadata, load_image
+from ...utils.lazy_import import lazy_exports
 
-__all__ = ['ImageData', 'ImageMetadata', 'load_image']
+# 공개 이름은 처음 사용할 때 해당 하위 모듈만 가져온다 (시작 시간 단축)
+__getattr__, __dir__ = lazy_exports(__name__, {
+    'GeoTransform': '.georef',
+    'Georeference': '.geotags',
+    'read_georeference': '.geotags',
+    'TiffBlocks': '.file_changes',
+    'changed_block_indices': '.file_changes',
+    'changed_blocks': '.file_changes',
+    'changed_pixels': '.file_changes',
+    'patch_blocks': '.file_changes',
+    'read_tiff_blocks': '.file_changes',
+    'ImageData': '.image_data',
+    'band_page_count': '.image_data',
+    'ImageMetadata': '.image_data',
+    'load_image': '.image_data',
+    'read_metadata': '.image_data',
+    'CaptureMetadata': '.metadata_index',
+    'MetadataIndex': '.metadata_index',
+    'read_capture_metadata': '.metadata_index',
+    'ThumbnailDatabase': '.thumbnails',
+    'ThumbnailService': '.thumbnails',
+    'get_shared_thumbnail_database': '.thumbnails',
+    'list_images': '.thumbnails',
+    'make_thumbnail': '.thumbnails',
+})
+
+__all__ = [
+    'GeoTransform', 'Georeference', 'ImageData', 'ImageMetadata', 'band_page_count',
+    'load_image', 'read_georeference', 'read_metadata', 'CaptureMetadata', 'MetadataIndex',
+    'read_capture_metadata', 'ThumbnailDatabase', 'ThumbnailService', 'list_images',
+    'make_thumbnail', 'get_shared_thumbnail_database', 'TiffBlocks',
+    'changed_block_indices', 'changed_blocks', 'changed_pixels', 'patch_blocks',
+    'read_tiff_blocks',
+]
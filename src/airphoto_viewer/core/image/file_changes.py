@@ -0,0 +1,342 @@
+"""
+다시 쓰인 영상 파일에서 바뀐 영역을 찾는 모듈입니다.
+
+타일/스트립 TIFF는 IFD의 블록 오프셋·바이트 수로 블록 원시 바이트를 읽어
+(바이트 수, CRC32) 서명을 비교하므로 픽셀을 디코딩하지 않고도 바뀐 블록을
+알 수 있습니다. 앞쪽 블록의 압축 크기가 바뀌면 뒤쪽 블록 오프셋이 모두
+밀리므로 오프셋은 서명에 넣지 않습니다. 바이트 수를 먼저 비교해 이미 바뀐
+것이 확실한 블록은 읽지 않고, 바이트 수가 같은 블록만 내용 CRC32로 같은
+크기로 다시 압축된 경우를 가려냅니다. 바뀐 블록은 그 블록 하나만 담은
+TIFF를 메모리에서 만들어 디코딩하고 기존 배열 사본에 덮어쓰므로, 영상
+전체를 다시 디코딩하지 않습니다. 블록 배치(크기, 블록 크기, 압축 방식
+등)가 달라졌거나 TIFF가 아닌 형식은 디코딩한 두 배열을 블록 단위로
+비교합니다.
+
+사각형은 레벨 0 픽셀 좌표 (x, y, 너비, 높이)입니다.
+"""
+
+import os
+import struct
+import zlib
+from dataclasses import dataclass
+from typing import Hashable, List, Optional, Sequence, Tuple
+
+import cv2
+import numpy as np
+from PIL import Image
+
+from .tiff_ifd import TIFF_LONG, encode_ifd
+
+Rect = Tuple[int, int, int, int]
+
+TIFF_MAGIC = (b"II*\x00", b"MM\x00*", b"II+\x00", b"MM\x00+")
+
+# 블록 배치 태그
+TAG_IMAGE_WIDTH = 256
+TAG_IMAGE_LENGTH = 257
+TAG_STRIP_OFFSETS = 273
+TAG_SAMPLES_PER_PIXEL = 277
+TAG_ROWS_PER_STRIP = 278
+TAG_STRIP_BYTE_COUNTS = 279
+TAG_PLANAR_CONFIGURATION = 284
+TAG_TILE_WIDTH = 322
+TAG_TILE_LENGTH = 323
+TAG_TILE_OFFSETS = 324
+TAG_TILE_BYTE_COUNTS = 325
+
+# 블록 해석에 영향을 주는 태그 (하나라도 바뀌면 블록 비교가 무의미함)
+LAYOUT_TAGS = (
+    TAG_IMAGE_WIDTH, TAG_IMAGE_LENGTH, 258, 259, 262, TAG_SAMPLES_PER_PIXEL,
+    TAG_ROWS_PER_STRIP, TAG_PLANAR_CONFIGURATION, 317, TAG_TILE_WIDTH,
+    TAG_TILE_LENGTH, 338, 339, 347,
+)
+
+# 블록 하나짜리 TIFF로 옮겨 적는 디코딩 태그 (비트 수, 압축, 색 해석, 예측자,
+# 팔레트, 추가 샘플, 샘플 형식, JPEG 테이블, YCbCr 부표본화)
+DECODE_TAGS = (258, 259, 262, TAG_SAMPLES_PER_PIXEL, TAG_PLANAR_CONFIGURATION,
+               317, 320, 338, 339, 347, 530)
+
+# TIFF 자료형 코드 → struct 형식 (BYTE, SHORT, LONG, UNDEFINED, DOUBLE)
+_TAG_FORMATS = {1: "B", 3: "H", 4: "I", 7: "s", 12: "d"}
+
+# (페이지 순번, 페이지 안 블록 순번)
+BlockIndex = Tuple[int, int]
+
+
+@dataclass(frozen=True)
+class TiffBlocks:
+    """TIFF 블록(타일/스트립) 배치와 블록별 내용 서명입니다.
+
+    첫 페이지와 같은 크기의 페이지(밴드별 페이지)만 포함하며, 크기가 다른
+    페이지(내장 개요)는 표시에 쓰이지 않으므로 제외합니다.
+
+    속성:
+        layout (Hashable): 블록 해석에 영향을 주는 태그 값
+        size (Tuple[int, int]): 페이지 (너비, 높이)
+        block_size (Tuple[int, int]): 블록 (너비, 높이). 스트립은 (영상 너비, 스트립 행 수)
+        pages (Tuple): 페이지별 블록 서명 (바이트 수, CRC32) 튜플.
+            CRC32가 None이면 읽지 않은 블록 (이전 서명과 바이트 수가 달라 바뀐 것이 확실함)
+    """
+    layout: Hashable
+    size: Tuple[int, int]
+    block_size: Tuple[int, int]
+    pages: Tuple[Tuple[Tuple[int, int], ...], ...]
+
+    def block_rect(self, index: int) -> Rect:
+        """페이지 안 블록 순번의 영상 사각형을 반환합니다 (평면 분리 블록 포함)."""
+        width, height = self.size
+        block_w, block_h = self.block_size
+        columns = -(-width // block_w)
+        per_plane = columns * -(-height // block_h)
+        index %= per_plane
+        x, y = (index % columns) * block_w, (index // columns) * block_h
+        return x, y, min(block_w, width - x), min(block_h, height - y)
+
+
+def read_tiff_blocks(path: str, previous: Optional[TiffBlocks] = None) -> Optional[TiffBlocks]:
+    """TIFF 파일의 블록 배치와 블록별 내용 서명을 읽습니다.
+
+    Args:
+        path: 영상 파일 경로
+        previous: 비교할 이전 서명. 주면 바이트 수가 달라진 블록은 읽지 않음 (CRC32가 None)
+
+    Returns:
+        Optional[TiffBlocks]: 블록 정보. TIFF가 아니거나 읽을 수 없으면 None
+    """
+    try:
+        with open(path, "rb") as f:
+            if f.read(4) not in TIFF_MAGIC:
+                return None
+            # 메모리 맵은 쓰는 쪽이 파일을 줄이면 SIGBUS가 나므로 일반 읽기를 쓴다
+            with Image.open(path) as image:
+                return _read_blocks(image, f, previous)
+    except (OSError, ValueError, KeyError, SyntaxError):
+        # 쓰는 도중이거나 손상된 파일은 블록 비교 없이 디코딩 비교로 넘긴다
+        return None
+
+
+def _read_blocks(image: Image.Image, f, previous: Optional[TiffBlocks]) -> Optional[TiffBlocks]:
+    """열린 TIFF의 페이지들을 돌며 블록 서명을 모읍니다."""
+    file_size = os.fstat(f.fileno()).st_size
+    tags = image.tag_v2
+    layout = tuple(_tag_value(tags.get(tag)) for tag in LAYOUT_TAGS)
+    size = (int(tags[TAG_IMAGE_WIDTH]), int(tags[TAG_IMAGE_LENGTH]))
+    if TAG_TILE_OFFSETS in tags:
+        block_size = (int(tags[TAG_TILE_WIDTH]), int(tags[TAG_TILE_LENGTH]))
+    else:
+        block_size = (size[0], min(size[1], int(tags.get(TAG_ROWS_PER_STRIP, size[1]))))
+    if previous is not None and (previous.layout, previous.size,
+                                 previous.block_size) != (layout, size, block_size):
+        previous = None
+
+    pages = []
+    for number, (offsets, counts) in _page_blocks(image, size):
+        if any(o + c > file_size for o, c in zip(offsets, counts)):
+            # 블록이 파일 끝을 넘으면 아직 쓰는 중이다
+            return None
+        old = (previous.pages[len(pages)] if previous is not None
+               and len(pages) < len(previous.pages) else ())
+        signatures = []
+        for index, (offset, count) in enumerate(zip(offsets, counts)):
+            if index < len(old) and old[index][0] != count:
+                # 바이트 수가 다르면 내용을 읽지 않아도 바뀐 블록이다
+                signatures.append((count, None))
+                continue
+            f.seek(offset)
+            block = f.read(count)
+            if len(block) != count:
+                return None
+            signatures.append((count, zlib.crc32(block)))
+        pages.append(tuple(signatures))
+    return TiffBlocks(layout, size, block_size, tuple(pages))
+
+
+def _page_blocks(image: Image.Image, size: Tuple[int, int]):
+    """첫 페이지와 크기가 같은 페이지마다 (페이지 번호, (블록 오프셋, 바이트 수))를 냅니다."""
+    for number in range(getattr(image, "n_frames", 1)):
+        image.seek(number)
+        tags = image.tag_v2
+        if (int(tags[TAG_IMAGE_WIDTH]), int(tags[TAG_IMAGE_LENGTH])) != size:
+            continue
+        if TAG_TILE_OFFSETS in tags:
+            offsets, counts = tags[TAG_TILE_OFFSETS], tags[TAG_TILE_BYTE_COUNTS]
+        else:
+            offsets, counts = tags[TAG_STRIP_OFFSETS], tags[TAG_STRIP_BYTE_COUNTS]
+        offsets = (offsets,) if isinstance(offsets, int) else tuple(offsets)
+        counts = (counts,) if isinstance(counts, int) else tuple(counts)
+        if len(offsets) != len(counts):
+            raise ValueError("블록 오프셋과 바이트 수의 개수가 다릅니다.")
+        yield number, (offsets, counts)
+
+
+def _tag_value(value):
+    """태그 값을 비교 가능한 불변 값으로 바꿉니다."""
+    if isinstance(value, (list, tuple)):
+        return tuple(_tag_value(v) for v in value)
+    return value
+
+
+def changed_block_indices(old: TiffBlocks, new: TiffBlocks) -> Optional[List[BlockIndex]]:
+    """두 블록 서명을 비교해 바뀐 블록의 (페이지 순번, 블록 순번)을 반환합니다.
+
+    Args:
+        old: 이전 블록 정보
+        new: 새 블록 정보
+
+    Returns:
+        Optional[List[BlockIndex]]: 바뀐 블록 (바뀐 것이 없으면 빈 목록).
+            블록 배치나 페이지 수가 달라 비교할 수 없으면 None
+    """
+    if (old.layout != new.layout or old.size != new.size
+            or old.block_size != new.block_size or len(old.pages) != len(new.pages)):
+        return None
+    changed = []
+    for page, (old_page, new_page) in enumerate(zip(old.pages, new.pages)):
+        if len(old_page) != len(new_page):
+            return None
+        for index, (a, b) in enumerate(zip(old_page, new_page)):
+            # 읽지 않은(CRC32가 None인) 블록은 같은지 알 수 없으므로 바뀐 것으로 본다
+            if a != b or b[1] is None:
+                changed.append((page, index))
+    return changed
+
+
+def changed_blocks(old: TiffBlocks, new: TiffBlocks) -> Optional[List[Rect]]:
+    """두 블록 서명을 비교해 바뀐 블록의 사각형을 반환합니다.
+
+    Args:
+        old: 이전 블록 정보
+        new: 새 블록 정보
+
+    Returns:
+        Optional[List[Rect]]: 바뀐 블록 사각형 (바뀐 것이 없으면 빈 목록).
+            블록 배치나 페이지 수가 달라 비교할 수 없으면 None
+    """
+    changed = changed_block_indices(old, new)
+    if changed is None:
+        return None
+    rects = {new.block_rect(index) for _, index in changed}
+    return sorted(rects, key=lambda r: (r[1], r[0]))
+
+
+def patch_blocks(path: str, blocks: TiffBlocks, changed: Sequence[BlockIndex],
+                 base: np.ndarray) -> Optional[Tuple[np.ndarray, TiffBlocks]]:
+    """바뀐 블록만 디코딩해 기존 배열의 사본에 덮어씁니다.
+
+    블록마다 그 블록 하나만 담은 TIFF를 메모리에서 만들어 OpenCV로 디코딩하므로
+    `cv2.imread`로 전체를 읽은 결과와 같은 채널 순서·자료형을 얻습니다.
+    페이지가 여러 개면 페이지 순번을 밴드로 보고 해당 채널에 덮어씁니다.
+
+    Args:
+        path: 영상 파일 경로
+        blocks: 새 파일의 블록 정보 (`read_tiff_blocks`)
+        changed: 바뀐 블록 (`changed_block_indices`)
+        base: 이전 파일을 디코딩한 배열 (바뀌지 않음)
+
+    Returns:
+        Optional[Tuple[np.ndarray, TiffBlocks]]: (새 배열, 읽은 블록의 CRC32를 채운
+            블록 정보). 평면 분리 배치이거나, 블록 디코딩 결과가 배열과 맞지 않거나,
+            파일이 그 사이 다시 바뀌었으면 None
+    """
+    pages = len(blocks.pages)
+    if pages > 1 and (base.ndim != 3 or base.shape[2] != pages):
+        return None
+    by_page = {}
+    for page, index in changed:
+        by_page.setdefault(page, []).append(index)
+    signatures = [list(page) for page in blocks.pages]
+    out = base.copy()
+    try:
+        with open(path, "rb") as f, Image.open(path) as image:
+            for page, (offsets, counts) in enumerate(
+                    entry for _, entry in _page_blocks(image, blocks.size)):
+                if page >= pages or len(counts) != len(signatures[page]):
+                    return None
+                tags = image.tag_v2
+                if int(tags.get(TAG_PLANAR_CONFIGURATION, 1)) != 1:
+                    return None
+                for index in by_page.get(page, ()):
+                    if counts[index] != signatures[page][index][0]:
+                        return None
+                    f.seek(offsets[index])
+                    data = f.read(counts[index])
+                    crc = zlib.crc32(data)
+                    if signatures[page][index][1] not in (None, crc) or len(data) != counts[index]:
+                        return None
+                    signatures[page][index] = (counts[index], crc)
+                    x, y, w, h = blocks.block_rect(index)
+                    block = _decode_block(tags, blocks, index, data)
+                    if block is None:
+                        return None
+                    block = block[:h, :w]
+                    target = out[y:y + h, x:x + w] if pages == 1 else out[y:y + h, x:x + w, page]
+                    if block.shape != target.shape or block.dtype != target.dtype:
+                        return None
+                    target[...] = block
+    except (OSError, ValueError, KeyError, SyntaxError, struct.error):
+        return None
+    return out, TiffBlocks(blocks.layout, blocks.size, blocks.block_size,
+                           tuple(tuple(page) for page in signatures))
+
+
+def _decode_block(tags, blocks: TiffBlocks, index: int, data: bytes) -> Optional[np.ndarray]:
+    """블록 하나만 담은 TIFF를 메모리에서 만들어 디코딩합니다."""
+    block_w, block_h = blocks.block_size
+    entries = []
+    for tag in DECODE_TAGS:
+        if tag not in tags:
+            continue
+        code = tags.tagtype.get(tag)
+        fmt = _TAG_FORMATS.get(code)
+        if fmt is None:
+            return None
+        values = tags[tag]
+        if fmt == "s":
+            values = bytes(values)
+        else:
+            values = values if isinstance(values, tuple) else (values,)
+        entries.append((tag, (code, struct.calcsize(fmt) if fmt != "s" else 1, fmt), values))
+    if TAG_TILE_OFFSETS in tags:
+        entries += [(TAG_IMAGE_WIDTH, TIFF_LONG, (block_w,)),
+                    (TAG_IMAGE_LENGTH, TIFF_LONG, (block_h,)),
+                    (TAG_TILE_WIDTH, TIFF_LONG, (block_w,)),
+                    (TAG_TILE_LENGTH, TIFF_LONG, (block_h,))]
+        offset_tag, count_tag = TAG_TILE_OFFSETS, TAG_TILE_BYTE_COUNTS
+    else:
+        # 마지막 스트립은 남은 행만 담는다
+        rows = blocks.block_rect(index)[3]
+        entries += [(TAG_IMAGE_WIDTH, TIFF_LONG, (blocks.size[0],)),
+                    (TAG_IMAGE_LENGTH, TIFF_LONG, (rows,)),
+                    (TAG_ROWS_PER_STRIP, TIFF_LONG, (rows,))]
+        offset_tag, count_tag = TAG_STRIP_OFFSETS, TAG_STRIP_BYTE_COUNTS
+    # 자리 잡기로 IFD 크기를 잰 뒤 블록 데이터를 IFD 뒤에 둔다
+    probe = encode_ifd(entries + [(offset_tag, TIFF_LONG, (0,)),
+                                  (count_tag, TIFF_LONG, (len(data),))], 8, False)
+    at = 8 + len(probe) + (len(probe) % 2)
+    ifd = encode_ifd(entries + [(offset_tag, TIFF_LONG, (at,)),
+                                (count_tag, TIFF_LONG, (len(data),))], 8, False)
+    buffer = b"II*\x00" + struct.pack("<I", 8) + ifd + b"\x00" * (at - 8 - len(ifd)) + data
+    return cv2.imdecode(np.frombuffer(buffer, np.uint8), cv2.IMREAD_UNCHANGED)
+
+
+def changed_pixels(old: np.ndarray, new: np.ndarray, block: int = 256) -> Optional[List[Rect]]:
+    """두 배열을 블록 단위로 비교해 픽셀이 바뀐 블록의 사각형을 반환합니다.
+
+    Args:
+        old: 이전 픽셀 배열
+        new: 새 픽셀 배열
+        block: 비교 블록 한 변의 픽셀 수
+
+    Returns:
+        Optional[List[Rect]]: 바뀐 블록 사각형 (바뀐 것이 없으면 빈 목록).
+            형태나 자료형이 달라 비교할 수 없으면 None
+    """
+    if old.shape != new.shape or old.dtype != new.dtype:
+        return None
+    height, width = new.shape[:2]
+    rects = []
+    for y in range(0, height, block):
+        for x in range(0, width, block):
+            if not np.array_equal(old[y:y + block, x:x + block], new[y:y + block, x:x + block]):
+                rects.append((x, y, min(block, width - x), min(block, height - y)))
+    return rects
@@ -0,0 +1,86 @@
+"""
+영상 픽셀 좌표와 지상 좌표 사이의 아핀 변환(지오트랜스폼) 모듈입니다.
+
+계수 배치는 GDAL과 같습니다::
+
+    X = c0 + col * c1 + row * c2
+    Y = c3 + col * c4 + row * c5
+
+픽셀 좌표 (0, 0)은 좌상단 픽셀의 좌상단 모서리입니다. 모든 변환은 (N, 2)
+배열을 한 번에 처리합니다.
+"""
+
+from dataclasses import dataclass
+from functools import cached_property
+from typing import Tuple
+
+import numpy as np
+
+
+@dataclass(frozen=True)
+class GeoTransform:
+    """픽셀 → 지상 좌표 아핀 변환입니다.
+
+    속성:
+        coefficients (Tuple[float, ...]): GDAL 순서의 계수 6개
+    """
+    coefficients: Tuple[float, float, float, float, float, float]
+
+    def __post_init__(self):
+        if len(self.coefficients) != 6:
+            raise ValueError(f"지오트랜스폼 계수는 6개여야 합니다: {self.coefficients}")
+        c = self.coefficients
+        if c[1] * c[5] - c[2] * c[4] == 0:
+            raise ValueError(f"역변환이 불가능한 지오트랜스폼입니다: {self.coefficients}")
+
+    @classmethod
+    def from_origin(cls, x: float, y: float, pixel_width: float,
+                    pixel_height: float) -> "GeoTransform":
+        """북쪽이 위인 영상의 좌상단 좌표와 픽셀 크기로 변환을 만듭니다.
+
+        Args:
+            x, y: 좌상단 모서리의 지상 좌표
+            pixel_width: 픽셀 너비 (지상 단위)
+            pixel_height: 픽셀 높이 (양수, 지상 단위)
+        """
+        return cls((x, pixel_width, 0.0, y, 0.0, -pixel_height))
+
+    @cached_property
+    def matrix(self) -> np.ndarray:
+        """(2, 3) 아핀 행렬 [[c1, c2, c0], [c4, c5, c3]]을 반환합니다."""
+        c = self.coefficients
+        return np.array([[c[1], c[2], c[0]], [c[4], c[5], c[3]]], dtype=np.float64)
+
+    @property
+    def pixel_size(self) -> Tuple[float, float]:
+        """픽셀 한 칸의 (가로, 세로) 지상 길이를 반환합니다."""
+        c = self.coefficients
+        return (float(np.hypot(c[1], c[4])), float(np.hypot(c[2], c[5])))
+
+    @cached_property
+    def inverse(self) -> "GeoTransform":
+        """지상 → 픽셀 역변환을 같은 형식으로 반환합니다."""
+        m = np.vstack([self.matrix, [0.0, 0.0, 1.0]])
+        inv = np.linalg.inv(m)
+        return GeoTransform((inv[0, 2], inv[0, 0], inv[0, 1], inv[1, 2], inv[1, 0], inv[1, 1]))
+
+    def apply(self, points) -> np.ndarray:
+        """(N, 2) 좌표 배열에 변환을 적용합니다.
+
+        Args:
+            points: (N, 2) 또는 (2,) 좌표
+
+        Returns:
+            np.ndarray: 같은 형태의 변환된 좌표 (float64)
+        """
+        points = np.asarray(points, dtype=np.float64)
+        m = self.matrix
+        return points @ m[:, :2].T + m[:, 2]
+
+    def pixel_to_ground(self, points) -> np.ndarray:
+        """픽셀 좌표를 지상 좌표로 변환합니다."""
+        return self.apply(points)
+
+    def ground_to_pixel(self, points) -> np.ndarray:
+        """지상 좌표를 픽셀 좌표로 변환합니다."""
+        return self.inverse.apply(points)
@@ -0,0 +1,326 @@
+"""
+영상 파일 헤더에서 지리참조 정보를 읽는 모듈입니다.
+
+픽셀은 디코딩하지 않고 다음 출처를 차례로 확인합니다.
+
+1. GeoTIFF 태그 (ModelPixelScale/ModelTiepoint/ModelTransformation, GeoKey)
+2. JP2 상자: GeoJP2 UUID 상자(내장 GeoTIFF)와 GMLJP2 XML 상자
+3. 같은 이름의 월드 파일 (.tfw/.jgw/.pgw, .tifw, .wld)과 .prj
+
+GDAL 없이 헤더 몇 KB만 읽으므로 영상 로드·모자이크 구성 시 부담이 없습니다.
+"""
+
+import io
+import math
+import os
+import re
+import struct
+from dataclasses import dataclass
+from functools import lru_cache
+from typing import Dict, Iterator, List, Optional, Tuple
+
+from PIL import Image
+
+from .georef import GeoTransform
+
+# GeoTIFF 태그 번호
+TAG_MODEL_PIXEL_SCALE = 33550
+TAG_MODEL_TIEPOINT = 33922
+TAG_MODEL_TRANSFORMATION = 34264
+TAG_GEO_KEY_DIRECTORY = 34735
+TAG_GEO_DOUBLE_PARAMS = 34736
+TAG_GEO_ASCII_PARAMS = 34737
+TAG_GDAL_NODATA = 42113
+
+# GeoKey 번호와 값
+KEY_MODEL_TYPE = 1024
+KEY_RASTER_TYPE = 1025
+KEY_GEOGRAPHIC_TYPE = 2048
+KEY_PROJECTED_CS_TYPE = 3072
+MODEL_GEOGRAPHIC = 2
+RASTER_PIXEL_IS_POINT = 2
+USER_DEFINED = 32767
+
+JP2_SIGNATURE = b"\x00\x00\x00\x0cjP  \r\n\x87\n"
+GEOJP2_UUID = bytes.fromhex("b14bf8bd083d4b43a5ae8cd7d5a6ce03")
+
+# 위도 1도의 대략적인 길이 (미터)
+METERS_PER_DEGREE = 111319.49
+
+
+@dataclass
+class Georeference:
+    """헤더에서 읽은 지리참조 정보입니다.
+
+    속성:
+        geotransform (GeoTransform): 픽셀 → 지상 좌표 변환
+        crs (Optional[str]): 좌표계 ('EPSG:xxxx' 또는 WKT)
+        nodata (Optional[float]): 값 없음을 뜻하는 픽셀 값
+        gsd (Optional[float]): 지상 표본 거리 (미터/픽셀, 지리 좌표계는 근사)
+    """
+    geotransform: GeoTransform
+    crs: Optional[str] = None
+    nodata: Optional[float] = None
+    gsd: Optional[float] = None
+
+
+def read_georeference(path: str) -> Optional[Georeference]:
+    """영상 파일의 지리참조를 헤더에서 읽습니다.
+
+    Args:
+        path: 영상 파일 경로
+
+    Returns:
+        Optional[Georeference]: 지리참조. 어느 출처에도 없으면 None
+    """
+    try:
+        with open(path, "rb") as f:
+            magic = f.read(12)
+    except OSError:
+        return None
+
+    georef = None
+    crs = nodata = None
+    geographic = None
+    try:
+        if magic[:4] in (b"II*\x00", b"MM\x00*", b"II+\x00", b"MM\x00+"):
+            with Image.open(path) as image:
+                georef = _from_tiff_tags(image.tag_v2)
+        elif magic == JP2_SIGNATURE:
+            georef = _from_jp2(path)
+    except Exception:
+        # 손상된 태그는 지리참조가 없는 것으로 본다
+        georef = None
+
+    if georef is not None:
+        geotransform, crs, nodata, geographic = georef
+    else:
+        geotransform = _read_world_file(path)
+        if geotransform is None:
+            return None
+    if crs is None:
+        crs = _read_prj(path)
+    return Georeference(geotransform, crs, nodata,
+                        _ground_sample_distance(geotransform, crs, geographic))
+
+
+def world_file_candidates(path: str) -> List[str]:
+    """영상 경로에 대응하는 월드 파일 후보 경로를 반환합니다.
+
+    예: photo.tif → photo.tfw, photo.tifw, photo.wld
+    """
+    stem, ext = os.path.splitext(path)
+    ext = ext.lstrip(".")
+    names = []
+    if len(ext) >= 2:
+        names.append(f"{stem}.{ext[0]}{ext[-1]}w")
+    if ext:
+        names.append(f"{stem}.{ext}w")
+    names.append(f"{stem}.wld")
+    # 대문자 확장자 파일 시스템도 고려
+    return names + [name[:len(stem)] + name[len(stem):].upper() for name in names]
+
+
+def _read_world_file(path: str) -> Optional[GeoTransform]:
+    """월드 파일 6줄(A, D, B, E, C, F)을 지오트랜스폼으로 변환합니다.
+
+    월드 파일의 C, F는 좌상단 픽셀의 중심이므로 반 픽셀 옮겨 모서리로 맞춥니다.
+    """
+    for candidate in world_file_candidates(path):
+        if not os.path.isfile(candidate):
+            continue
+        try:
+            with open(candidate, "r", encoding="ascii", errors="ignore") as f:
+                values = [float(line) for line in f.read().split()[:6]]
+            a, d, b, e, c, f_ = values
+            return GeoTransform((c - 0.5 * (a + b), a, b, f_ - 0.5 * (d + e), d, e))
+        except (ValueError, TypeError):
+            continue
+    return None
+
+
+def _read_prj(path: str) -> Optional[str]:
+    """같은 이름의 .prj 파일에서 좌표계 WKT를 읽습니다."""
+    stem = os.path.splitext(path)[0]
+    for candidate in (stem + ".prj", stem + ".PRJ"):
+        if os.path.isfile(candidate):
+            with open(candidate, "r", encoding="utf-8", errors="ignore") as f:
+                text = f.read().strip()
+            return text or None
+    return None
+
+
+def _tag_tuple(tags, tag: int) -> Tuple:
+    """태그 값을 항상 튜플로 반환합니다 (단일 값 태그는 스칼라로 읽힘)."""
+    value = tags.get(tag)
+    if value is None:
+        return ()
+    return tuple(value) if isinstance(value, (tuple, list)) else (value,)
+
+
+def _geo_keys(tags) -> Dict[int, object]:
+    """GeoKeyDirectory 태그를 {키: 값} 사전으로 풉니다."""
+    directory = _tag_tuple(tags, TAG_GEO_KEY_DIRECTORY)
+    if len(directory) < 4:
+        return {}
+    doubles = _tag_tuple(tags, TAG_GEO_DOUBLE_PARAMS)
+    ascii_params = tags.get(TAG_GEO_ASCII_PARAMS) or ""
+    keys = {}
+    for i in range(4, 4 + 4 * directory[3], 4):
+        key, location, count, value = directory[i:i + 4]
+        if location == 0:
+            keys[key] = value
+        elif location == TAG_GEO_DOUBLE_PARAMS:
+            keys[key] = doubles[value:value + count]
+        elif location == TAG_GEO_ASCII_PARAMS:
+            keys[key] = ascii_params[value:value + count].rstrip("|\x00")
+    return keys
+
+
+def _from_tiff_tags(tags) -> Optional[Tuple[GeoTransform, Optional[str], Optional[float], bool]]:
+    """GeoTIFF 태그에서 (지오트랜스폼, 좌표계, nodata, 지리 좌표계 여부)를 읽습니다."""
+    matrix = _tag_tuple(tags, TAG_MODEL_TRANSFORMATION)
+    scale = _tag_tuple(tags, TAG_MODEL_PIXEL_SCALE)
+    tiepoint = _tag_tuple(tags, TAG_MODEL_TIEPOINT)
+    if len(matrix) >= 8:
+        c = (matrix[3], matrix[0], matrix[1], matrix[7], matrix[4], matrix[5])
+    elif len(scale) >= 2 and len(tiepoint) >= 6:
+        i, j, _, x, y, _ = tiepoint[:6]
+        c = (x - i * scale[0], scale[0], 0.0, y + j * scale[1], 0.0, -scale[1])
+    else:
+        return None
+
+    keys = _geo_keys(tags)
+    if keys.get(KEY_RASTER_TYPE) == RASTER_PIXEL_IS_POINT:
+        # 좌표가 픽셀 중심을 가리키므로 모서리 기준으로 옮긴다 (GDAL 기본 동작)
+        c = (c[0] - 0.5 * (c[1] + c[2]), c[1], c[2],
+             c[3] - 0.5 * (c[4] + c[5]), c[4], c[5])
+    crs = None
+    for key in (KEY_PROJECTED_CS_TYPE, KEY_GEOGRAPHIC_TYPE):
+        code = keys.get(key)
+        if isinstance(code, int) and 0 < code < USER_DEFINED:
+            crs = f"EPSG:{code}"
+            break
+    nodata = None
+    text = tags.get(TAG_GDAL_NODATA)
+    if text:
+        try:
+            nodata = float(str(text).strip("\x00 "))
+        except ValueError:
+            nodata = None
+    model = keys.get(KEY_MODEL_TYPE)
+    return (GeoTransform(tuple(float(v) for v in c)), crs, nodata,
+            None if model is None else model == MODEL_GEOGRAPHIC)
+
+
+def _iter_boxes(f, end: int) -> Iterator[Tuple[bytes, int, int]]:
+    """JP2 상자의 (종류, 내용 시작 위치, 내용 끝 위치)를 차례로 반환합니다.
+
+    코드스트림(jp2c) 같은 큰 상자는 읽지 않고 건너뜁니다.
+    """
+    position = f.tell()
+    while position + 8 <= end:
+        f.seek(position)
+        header = f.read(8)
+        if len(header) < 8:
+            return
+        length, kind = struct.unpack(">I4s", header)
+        start = position + 8
+        if length == 1:
+            length = struct.unpack(">Q", f.read(8))[0]
+            start += 8
+        elif length == 0:
+            length = end - position
+        if length < start - position:
+            return
+        yield kind, start, position + length
+        position += length
+
+
+def _from_jp2(path: str):
+    """JP2 상자에서 GeoJP2 또는 GMLJP2 지리참조를 읽습니다."""
+    with open(path, "rb") as f:
+        end = f.seek(0, io.SEEK_END)
+        f.seek(0)
+        return _scan_jp2_boxes(f, end)
+
+
+def _scan_jp2_boxes(f, end: int):
+    """상자 목록을 훑어 GeoJP2 UUID 상자를 우선, 없으면 GMLJP2 XML을 사용합니다."""
+    gml = None
+    for kind, start, stop in list(_iter_boxes(f, end)):
+        if kind == b"uuid":
+            f.seek(start)
+            payload = f.read(stop - start)
+            if payload[:16] == GEOJP2_UUID:
+                with Image.open(io.BytesIO(payload[16:])) as tiff:
+                    result = _from_tiff_tags(tiff.tag_v2)
+                if result is not None:
+                    return result
+        elif kind == b"asoc":
+            f.seek(start)
+            result = _scan_jp2_boxes(f, stop)
+            if result is not None:
+                return result
+        elif kind == b"xml " and gml is None:
+            f.seek(start)
+            text = f.read(stop - start).decode("utf-8", errors="ignore")
+            if "RectifiedGrid" in text:
+                gml = _from_gml(text)
+    return gml
+
+
+def _from_gml(text: str):
+    """GMLJP2 RectifiedGrid의 원점과 오프셋 벡터로 지리참조를 만듭니다.
+
+    원점은 좌상단 픽셀의 중심이며, EPSG URN의 지리 좌표계는 (위도, 경도)
+    축 순서이므로 (경도, 위도)로 바꿉니다.
+    """
+    origin = re.search(r"<(?:\w+:)?origin\b.*?<(?:\w+:)?pos\b[^>]*>([^<]+)<", text, re.S)
+    vectors = re.findall(r"<(?:\w+:)?offsetVector\b[^>]*>([^<]+)<", text)
+    if origin is None or len(vectors) < 2:
+        return None
+    ox, oy = (float(v) for v in origin.group(1).split()[:2])
+    (ax, ay), (bx, by) = ((float(v) for v in vector.split()[:2]) for vector in vectors[:2])
+    crs = None
+    srs = re.search(r'srsName="([^"]+)"', text)
+    if srs and "EPSG" in srs.group(1).upper():
+        crs = f"EPSG:{re.findall(r'[0-9]+', srs.group(1))[-1]}"
+        if srs.group(1).startswith("urn:") and _is_lat_first(crs):
+            ox, oy, ax, ay, bx, by = oy, ox, ay, ax, by, bx
+    c = (ox - 0.5 * (ax + bx), ax, bx, oy - 0.5 * (ay + by), ay, by)
+    return (GeoTransform(c), crs, None, None)
+
+
+@lru_cache(maxsize=32)
+def _is_lat_first(crs: str) -> bool:
+    """좌표계의 첫 축이 위도(북/남)인지 확인합니다."""
+    from pyproj import CRS
+    axes = CRS.from_user_input(crs).axis_info
+    return bool(axes) and axes[0].direction in ("north", "south")
+
+
+@lru_cache(maxsize=32)
+def _is_geographic(crs: str) -> bool:
+    """좌표계가 경위도(도 단위)인지 확인합니다."""
+    from pyproj import CRS
+    try:
+        return CRS.from_user_input(crs).is_geographic
+    except Exception:
+        return False
+
+
+def _ground_sample_distance(geotransform: GeoTransform, crs: Optional[str],
+                            geographic: Optional[bool]) -> Optional[float]:
+    """픽셀 한 칸의 평균 지상 길이(미터)를 계산합니다.
+
+    지리 좌표계는 원점 위도에서 도 단위를 미터로 근사 환산합니다.
+    좌표계를 모르면 지상 좌표 단위 그대로 반환합니다.
+    """
+    width, height = geotransform.pixel_size
+    if geographic is None:
+        geographic = crs is not None and _is_geographic(crs)
+    if not geographic:
+        return 0.5 * (width + height)
+    latitude = geotransform.coefficients[3]
+    return 0.5 * METERS_PER_DEGREE * (width * math.cos(math.radians(latitude)) + height)
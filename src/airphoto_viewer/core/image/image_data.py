@@ -6,11 +6,15 @@
 import os
 from dataclasses import dataclass
 from pathlib import Path
-from typing import Optional, Tuple, Union
+from typing import Iterator, Optional, Tuple, Union
 
 import cv2
 import numpy as np
-from PIL import Image, ImageCms
+from PIL import Image
+
+from ...utils.buffer_view import pinned_view
+from .georef import GeoTransform
+from .geotags import read_georeference
 
 
 @dataclass
@@ -20,11 +24,15 @@ class ImageMetadata:
     속성:
         width (int): 이미지 너비 (픽셀 단위)
         height (int): 이미지 높이 (픽셀 단위)
-        channels (int): 색상 채널 수 (예: RGB=3, RGBA=4)
+        channels (int): 색상 채널(밴드) 수 (예: RGB=3, RGBA=4, 다중분광=4~8)
         dpi (Tuple[float, float]): 이미지 해상도 (x, y)
-        color_space (str): 색상 공간 (예: 'RGB', 'RGBA', 'L')
+        color_space (str): 색상 공간 (예: 'RGB', 'RGBA', 'L', 'MULTISPECTRAL')
         format (str): 이미지 포맷 (예: 'JPEG', 'PNG', 'TIFF')
         has_alpha (bool): 알파 채널 존재 여부
+        geotransform (Optional[GeoTransform]): 픽셀 → 지상 좌표 변환 (지리참조가 없으면 None)
+        crs (Optional[str]): 지상 좌표계 (EPSG 코드 문자열 또는 WKT)
+        nodata (Optional[float]): 값 없음을 뜻하는 픽셀 값
+        gsd (Optional[float]): 지상 표본 거리 (미터/픽셀)
     """
     width: int = 0
     height: int = 0
@@ -33,6 +41,19 @@ class ImageMetadata:
     color_space: str = ""
     format: str = ""
     has_alpha: bool = False
+    geotransform: Optional[GeoTransform] = None
+    crs: Optional[str] = None
+    nodata: Optional[float] = None
+    gsd: Optional[float] = None
+
+    def apply_georeference(self, filepath: Union[str, Path]) -> None:
+        """파일 헤더(또는 월드 파일)의 지리참조를 읽어 필드를 채웁니다."""
+        georef = read_georeference(str(filepath))
+        if georef is not None:
+            self.geotransform = georef.geotransform
+            self.crs = georef.crs
+            self.nodata = georef.nodata
+            self.gsd = georef.gsd
 
 
 class ImageData:
@@ -77,8 +98,13 @@ class ImageData:
             raise FileNotFoundError(f"이미지 파일을 찾을 수 없습니다: {self.filepath}")
         
         try:
-            # OpenCV로 이미지 로드 (BGR 형식)
-            self._data = cv2.imread(str(self.filepath), cv2.IMREAD_UNCHANGED)
+            # 밴드별 페이지로 저장된 다중분광 TIFF는 헤더로 판별해 페이지를 밴드로 쌓고,
+            # 그 밖에는 OpenCV로 한 번만 디코딩한다 (BGR 형식)
+            self._data = None
+            if band_page_count(self.filepath) > 1:
+                self._data = self._read_band_pages()
+            if self._data is None:
+                self._data = cv2.imread(str(self.filepath), cv2.IMREAD_UNCHANGED)
             
             if self._data is None:
                 raise IOError(f"이미지 로딩에 실패했습니다: {self.filepath}")
@@ -90,6 +116,44 @@ class ImageData:
             self._data = None
             raise IOError(f"이미지 로딩 중 오류가 발생했습니다: {e}")
     
+    @classmethod
+    def from_array(cls, filepath: Union[str, Path], data: np.ndarray) -> "ImageData":
+        """이미 디코딩한 픽셀 배열로 인스턴스를 만듭니다 (메타데이터는 파일 헤더에서 읽음).
+        
+        바뀐 블록만 다시 디코딩해 덮어쓴 배열처럼 파일 전체를 다시 읽지 않고
+        얻은 픽셀에 사용합니다.
+        
+        Args:
+            filepath: 픽셀의 원본 파일 경로
+            data: 픽셀 배열
+            
+        Returns:
+            ImageData: 로드된 상태의 인스턴스
+        """
+        image_data = cls()
+        image_data.filepath = Path(filepath)
+        image_data._data = data
+        image_data._extract_metadata()
+        return image_data
+    
+    def _read_band_pages(self) -> Optional[np.ndarray]:
+        """다중 페이지 TIFF의 단일 채널 페이지들을 (H, W, 밴드) 배열로 읽습니다.
+        
+        Returns:
+            Optional[np.ndarray]: 밴드 배열. 디코딩한 페이지가 밴드 스택 형식이 아니면 None
+        """
+        ok, pages = cv2.imreadmulti(str(self.filepath), flags=cv2.IMREAD_UNCHANGED)
+        if not ok or not pages:
+            return None
+        first = pages[0]
+        if any(p.ndim != 2 or p.shape != first.shape or p.dtype != first.dtype
+               for p in pages):
+            return None
+        bands = np.empty(first.shape + (len(pages),), dtype=first.dtype)
+        for index, page in enumerate(pages):
+            bands[..., index] = page
+        return bands
+    
     def unload(self) -> None:
         """이미지 데이터를 메모리에서 해제합니다."""
         self._data = None
@@ -108,7 +172,8 @@ class ImageData:
             height=height,
             channels=channels,
             has_alpha=channels == 4,
-            color_space='RGBA' if channels == 4 else 'RGB' if channels == 3 else 'L'
+            color_space=('MULTISPECTRAL' if channels > 4 else 'RGBA' if channels == 4
+                         else 'RGB' if channels == 3 else 'L')
         )
         
         # PIL을 사용하여 추가 메타데이터 추출
@@ -118,12 +183,62 @@ class ImageData:
                 self._metadata.dpi = img.info.get('dpi', (0, 0))
         except Exception:
             pass
+        
+        # 지리참조 (헤더 태그/상자 또는 월드 파일)
+        self._metadata.apply_georeference(self.filepath)
     
     @property
     def data(self) -> Optional[np.ndarray]:
         """이미지 데이터를 반환합니다."""
         return self._data
     
+    def region(self, x: int, y: int, width: int, height: int) -> np.ndarray:
+        """영역을 복사 없이 읽기 전용 뷰로 반환합니다.
+        
+        뷰는 버퍼 프로토콜을 구현하므로 NumPy/OpenCV/Pillow가 그대로 사용할 수
+        있으며, 뷰가 살아 있는 동안에는 `unload()` 후에도 픽셀 메모리가 유지됩니다.
+        
+        Args:
+            x, y: 좌상단 좌표
+            width, height: 영역 크기
+            
+        Returns:
+            np.ndarray: (height, width[, 채널]) 형태의 쓰기 불가 뷰
+            
+        Raises:
+            ValueError: 이미지가 로드되지 않았거나 영역이 이미지를 벗어난 경우
+        """
+        if self._data is None:
+            raise ValueError("로드되지 않은 이미지의 영역을 읽을 수 없습니다.")
+        image_h, image_w = self._data.shape[:2]
+        if x < 0 or y < 0 or width <= 0 or height <= 0 \
+                or x + width > image_w or y + height > image_h:
+            raise ValueError(f"영역이 이미지({image_w}x{image_h})를 벗어났습니다: "
+                             f"({x}, {y}, {width}, {height})")
+        return pinned_view(self._data[y:y + height, x:x + width])
+    
+    def tiles(self, tile_size: int = 256
+              ) -> Iterator[Tuple[Tuple[int, int, int, int], np.ndarray]]:
+        """이미지를 격자로 나눈 타일을 행 순서대로 읽기 전용 뷰로 반환합니다.
+        
+        Args:
+            tile_size: 타일 한 변의 픽셀 수 (가장자리 타일은 더 작을 수 있음)
+            
+        Yields:
+            Tuple: ((x, y, 너비, 높이), 타일 뷰)
+            
+        Raises:
+            ValueError: 이미지가 로드되지 않은 경우
+        """
+        if self._data is None:
+            raise ValueError("로드되지 않은 이미지의 타일을 읽을 수 없습니다.")
+        data = self._data
+        image_h, image_w = data.shape[:2]
+        for y in range(0, image_h, tile_size):
+            for x in range(0, image_w, tile_size):
+                w, h = min(tile_size, image_w - x), min(tile_size, image_h - y)
+                yield (x, y, w, h), pinned_view(data[y:y + h, x:x + w])
+    
     @property
     def metadata(self) -> ImageMetadata:
         """이미지 메타데이터를 반환합니다."""
@@ -139,6 +254,80 @@ class ImageData:
         self.unload()
 
 
+def band_page_count(filepath: Union[str, Path]) -> int:
+    """밴드별 페이지로 저장된 다중분광 TIFF의 밴드 수를 헤더만 읽어 반환합니다.
+    
+    모든 페이지가 같은 크기·비트 수·샘플 형식의 단일 채널이고 두 쪽 이상일 때만
+    밴드 스택으로 봅니다 (크기가 다른 페이지가 있으면 내장 개요로 봄).
+    
+    Args:
+        filepath: 이미지 파일 경로
+        
+    Returns:
+        int: 밴드 수. 밴드 스택 TIFF가 아니면 0
+    """
+    if Path(filepath).suffix.lower() not in ('.tif', '.tiff'):
+        return 0
+    try:
+        with Image.open(filepath) as img:
+            count = getattr(img, 'n_frames', 1)
+            if count < 2:
+                return 0
+            first = None
+            for page in range(count):
+                img.seek(page)
+                tags = img.tag_v2
+                layout = (img.size, tags.get(277, 1), tags.get(258), tags.get(339, 1))
+                if layout[1] != 1 or (first is not None and layout != first):
+                    return 0
+                first = layout
+            return count
+    except Exception:
+        # Pillow가 읽지 못하는 헤더는 단일 페이지 영상으로 디코딩한다
+        return 0
+
+
+def read_metadata(filepath: Union[str, Path]) -> ImageMetadata:
+    """픽셀을 디코딩하지 않고 헤더만 읽어 메타데이터를 반환합니다.
+    
+    Args:
+        filepath: 이미지 파일 경로
+        
+    Returns:
+        ImageMetadata: 크기, 채널, 포맷, 지리참조 정보
+        
+    Raises:
+        FileNotFoundError: 파일이 존재하지 않는 경우
+        IOError: 헤더를 읽을 수 없는 경우
+    """
+    filepath = Path(filepath)
+    if not filepath.exists():
+        raise FileNotFoundError(f"이미지 파일을 찾을 수 없습니다: {filepath}")
+    try:
+        with Image.open(filepath) as img:
+            channels = len(img.getbands())
+            metadata = ImageMetadata(
+                width=img.width,
+                height=img.height,
+                channels=channels,
+                dpi=img.info.get('dpi', (0.0, 0.0)),
+                color_space=img.mode,
+                format=img.format or "",
+                has_alpha='A' in img.getbands()
+            )
+    except Exception as e:
+        raise IOError(f"이미지 헤더를 읽을 수 없습니다: {e}")
+    # 밴드별 페이지 TIFF는 로드 시와 같게 페이지 수를 채널 수로 본다
+    bands = band_page_count(filepath)
+    if bands > 1:
+        metadata.channels = bands
+        metadata.has_alpha = bands == 4
+        metadata.color_space = ('MULTISPECTRAL' if bands > 4 else 'RGBA' if bands == 4
+                                else 'RGB' if bands == 3 else 'L')
+    metadata.apply_georeference(filepath)
+    return metadata
+
+
 def load_image(filepath: Union[str, Path]) -> ImageData:
     """이미지 파일을 로드하여 ImageData 인스턴스를 반환합니다.
     
@@ -0,0 +1,436 @@
+"""
+대량의 영상에서 촬영 메타데이터(EXIF/GPS/XMP)를 읽어 색인하는 모듈입니다.
+
+`read_capture_metadata()`는 픽셀을 디코딩하지 않고 파일 머리 부분만 읽습니다.
+JPEG은 SOS 마커 전까지의 세그먼트(APP1 EXIF/XMP, SOF 크기)만, TIFF는 IFD와
+필요한 태그 값 위치만 찾아 읽습니다. EXIF에서는 촬영 시각·카메라·초점 거리를,
+GPS IFD에서는 위경도와 고도를, XMP에서는 드론 비행 정보(상대 고도, 자세 등)를
+꺼냅니다.
+
+`MetadataIndex`는 결과를 캐시 디렉토리의 SQLite 데이터베이스에 보관하고
+촬영 시각·고도·카메라로 질의합니다. 다시 스캔하면 수정 시각과 크기가 바뀐
+파일만 읽고, 사라진 파일은 색인에서 지웁니다.
+"""
+
+import io
+import json
+import os
+import re
+import sqlite3
+import struct
+import threading
+from concurrent.futures import ThreadPoolExecutor
+from dataclasses import asdict, dataclass, field, fields
+from pathlib import Path
+from typing import Callable, Dict, List, Optional, Sequence, Tuple
+
+from .thumbnails import list_images
+
+# TIFF 필드 자료형 코드 → (바이트 수, struct 형식)
+_TIFF_TYPES = {
+    1: (1, "B"), 2: (1, "s"), 3: (2, "H"), 4: (4, "I"), 5: (8, "II"),
+    6: (1, "b"), 7: (1, "s"), 8: (2, "h"), 9: (4, "i"), 10: (8, "ii"),
+    11: (4, "f"), 12: (8, "d"),
+}
+
+# 읽을 EXIF 태그
+_TAG_WIDTH, _TAG_HEIGHT = 256, 257
+_TAG_MAKE, _TAG_MODEL = 0x010F, 0x0110
+_TAG_XMP = 700
+_TAG_EXIF_IFD, _TAG_GPS_IFD = 0x8769, 0x8825
+_TAG_DATETIME_ORIGINAL, _TAG_SUBSEC_ORIGINAL = 0x9003, 0x9291
+_TAG_FOCAL_LENGTH = 0x920A
+_TAG_PIXEL_X, _TAG_PIXEL_Y = 0xA002, 0xA003
+
+# 색인할 XMP 속성 (드론 제조사 확장 포함)
+_XMP_KEYS = {
+    "RelativeAltitude": "relative_altitude",
+    "AbsoluteAltitude": "absolute_altitude",
+    "FlightYawDegree": "yaw",
+    "GimbalYawDegree": "gimbal_yaw",
+    "GimbalPitchDegree": "pitch",
+    "GimbalRollDegree": "gimbal_roll",
+}
+_XMP_ATTRIBUTE = re.compile(rb'([A-Za-z][\w.-]*):([A-Za-z][\w.-]*)="([^"]*)"')
+_XMP_ELEMENT = re.compile(rb"<([A-Za-z][\w.-]*):([A-Za-z][\w.-]*)>([^<]*)</\1:\2>")
+_XMP_SIGNATURE = b"http://ns.adobe.com/xap/1.0/\x00"
+
+# 태그 값 하나로 읽을 최대 바이트 수 (잘못된 파일 방어)
+_MAX_VALUE_BYTES = 1 << 20
+
+
+@dataclass
+class CaptureMetadata:
+    """영상 한 장의 촬영 메타데이터입니다.
+
+    속성:
+        path (str): 절대 경로
+        mtime_ns (int): 파일 수정 시각 (나노초)
+        size (int): 파일 크기
+        width (Optional[int]): 영상 너비
+        height (Optional[int]): 영상 높이
+        capture_time (Optional[str]): 촬영 시각 (ISO 8601, 카메라 현지 시각)
+        make (Optional[str]): 카메라 제조사
+        model (Optional[str]): 카메라 모델
+        focal_length (Optional[float]): 초점 거리 (mm)
+        latitude (Optional[float]): 위도 (도)
+        longitude (Optional[float]): 경도 (도)
+        altitude (Optional[float]): GPS 고도 (m, 해수면 기준)
+        relative_altitude (Optional[float]): 이륙 지점 기준 고도 (m, XMP)
+        yaw (Optional[float]): 기체 방위각 (도, XMP)
+        pitch (Optional[float]): 짐벌 피치 (도, XMP)
+        xmp (Dict[str, float]): 그 밖에 읽은 XMP 값
+    """
+    path: str
+    mtime_ns: int = 0
+    size: int = 0
+    width: Optional[int] = None
+    height: Optional[int] = None
+    capture_time: Optional[str] = None
+    make: Optional[str] = None
+    model: Optional[str] = None
+    focal_length: Optional[float] = None
+    latitude: Optional[float] = None
+    longitude: Optional[float] = None
+    altitude: Optional[float] = None
+    relative_altitude: Optional[float] = None
+    yaw: Optional[float] = None
+    pitch: Optional[float] = None
+    xmp: Dict[str, float] = field(default_factory=dict)
+
+
+def read_capture_metadata(path: str) -> CaptureMetadata:
+    """파일 머리 부분만 읽어 촬영 메타데이터를 반환합니다.
+
+    Args:
+        path: 영상 경로
+
+    Returns:
+        CaptureMetadata: 읽은 메타데이터 (없는 항목은 None)
+
+    Raises:
+        FileNotFoundError: 파일이 없는 경우
+        IOError: 파일을 읽을 수 없는 경우
+    """
+    if not os.path.exists(path):
+        raise FileNotFoundError(f"파일을 찾을 수 없습니다: {path}")
+    stat = os.stat(path)
+    metadata = CaptureMetadata(os.path.abspath(path), stat.st_mtime_ns, stat.st_size)
+    try:
+        with open(path, "rb") as f:
+            head = f.read(4)
+            f.seek(0)
+            if head[:2] == b"\xff\xd8":
+                _read_jpeg(f, metadata)
+            elif head in (b"II*\x00", b"MM\x00*"):
+                tags = _read_tiff(f, 0)
+                metadata.width = _first(tags.get(_TAG_WIDTH))
+                metadata.height = _first(tags.get(_TAG_HEIGHT))
+                _apply_tags(tags, metadata)
+            elif head == b"\x89PNG":
+                f.seek(16)
+                metadata.width, metadata.height = struct.unpack(">II", f.read(8))
+    except (struct.error, ValueError, OSError) as e:
+        raise IOError(f"메타데이터를 읽을 수 없습니다: {path}: {e}")
+    return metadata
+
+
+def _read_jpeg(f, metadata: CaptureMetadata) -> None:
+    """SOS 전까지의 JPEG 세그먼트에서 EXIF, XMP, 영상 크기를 읽습니다."""
+    f.seek(2)
+    while True:
+        marker = f.read(2)
+        if len(marker) < 2 or marker[0] != 0xFF:
+            return
+        code = marker[1]
+        if code == 0xFF:
+            f.seek(-1, io.SEEK_CUR)
+            continue
+        if code in (0xD8, 0x01) or 0xD0 <= code <= 0xD7:
+            continue
+        if code in (0xDA, 0xD9):
+            return
+        length = struct.unpack(">H", f.read(2))[0]
+        if code == 0xE1:
+            data = f.read(length - 2)
+            if data.startswith(b"Exif\x00\x00"):
+                tags = _read_tiff(io.BytesIO(data), 6)
+                _apply_tags(tags, metadata)
+            elif data.startswith(_XMP_SIGNATURE):
+                _apply_xmp(data[len(_XMP_SIGNATURE):], metadata)
+            continue
+        if 0xC0 <= code <= 0xCF and code not in (0xC4, 0xC8, 0xCC):
+            height, width = struct.unpack(">HH", f.read(5)[1:])
+            metadata.width, metadata.height = width, height
+            f.seek(length - 7, io.SEEK_CUR)
+            continue
+        f.seek(length - 2, io.SEEK_CUR)
+
+
+def _read_tiff(f, base: int) -> Dict[int, object]:
+    """TIFF 구조(파일 또는 EXIF 블록)의 IFD0과 EXIF/GPS 하위 IFD 태그를 읽습니다.
+
+    GPS 태그는 (1000 + 태그 번호) 키로 반환합니다.
+    """
+    f.seek(base)
+    order = f.read(2)
+    endian = "<" if order == b"II" else ">"
+    magic, offset = struct.unpack(endian + "HI", f.read(6))
+    if magic != 42:
+        # BigTIFF 등은 크기만 알 수 없을 뿐 오류로 보지 않는다
+        return {}
+    tags = _read_ifd(f, base, offset, endian)
+    for pointer, prefix in ((_TAG_EXIF_IFD, 0), (_TAG_GPS_IFD, 1000)):
+        sub = _first(tags.get(pointer))
+        if sub:
+            for tag, value in _read_ifd(f, base, sub, endian).items():
+                tags[prefix + tag] = value
+    return tags
+
+
+def _read_ifd(f, base: int, offset: int, endian: str) -> Dict[int, object]:
+    """IFD 하나의 태그 값을 읽습니다 (알 수 없는 자료형은 건너뜀)."""
+    f.seek(base + offset)
+    count = struct.unpack(endian + "H", f.read(2))[0]
+    raw = f.read(12 * count)
+    tags = {}
+    for index in range(count):
+        tag, kind, number, value = struct.unpack(
+            endian + "HHI4s", raw[12 * index:12 * index + 12])
+        if kind not in _TIFF_TYPES:
+            continue
+        size, fmt = _TIFF_TYPES[kind]
+        total = size * number
+        if total > _MAX_VALUE_BYTES:
+            continue
+        if total > 4:
+            f.seek(base + struct.unpack(endian + "I", value)[0])
+            value = f.read(total)
+        if fmt == "s":
+            tags[tag] = value[:total]
+        elif kind in (5, 10):
+            pairs = struct.unpack(f"{endian}{2 * number}{fmt[0]}", value[:total])
+            tags[tag] = tuple(pairs[i] / pairs[i + 1] if pairs[i + 1] else 0.0
+                              for i in range(0, len(pairs), 2))
+        else:
+            tags[tag] = struct.unpack(f"{endian}{number}{fmt}", value[:total])
+    return tags
+
+
+def _apply_tags(tags: Dict[int, object], metadata: CaptureMetadata) -> None:
+    """EXIF/GPS 태그 값을 메타데이터에 반영합니다."""
+    if metadata.width is None and _TAG_PIXEL_X in tags:
+        metadata.width = _first(tags[_TAG_PIXEL_X])
+        metadata.height = _first(tags.get(_TAG_PIXEL_Y))
+    metadata.make = _text(tags.get(_TAG_MAKE)) or metadata.make
+    metadata.model = _text(tags.get(_TAG_MODEL)) or metadata.model
+    taken = _text(tags.get(_TAG_DATETIME_ORIGINAL))
+    if taken and len(taken) >= 19:
+        # "YYYY:MM:DD HH:MM:SS" → ISO 8601
+        metadata.capture_time = f"{taken[:4]}-{taken[5:7]}-{taken[8:10]}T{taken[11:19]}"
+        subsec = _text(tags.get(_TAG_SUBSEC_ORIGINAL))
+        if subsec and subsec.isdigit():
+            metadata.capture_time += f".{subsec}"
+    focal = _first(tags.get(_TAG_FOCAL_LENGTH))
+    if focal:
+        metadata.focal_length = float(focal)
+    latitude = _degrees(tags.get(1002), tags.get(1001), b"S")
+    longitude = _degrees(tags.get(1004), tags.get(1003), b"W")
+    if latitude is not None and longitude is not None:
+        metadata.latitude, metadata.longitude = latitude, longitude
+    altitude = _first(tags.get(1006))
+    if altitude is not None:
+        below = _first(tags.get(1005)) == 1
+        metadata.altitude = -float(altitude) if below else float(altitude)
+    xmp = tags.get(_TAG_XMP)
+    if isinstance(xmp, (bytes, tuple)):
+        _apply_xmp(bytes(xmp), metadata)
+
+
+def _apply_xmp(packet: bytes, metadata: CaptureMetadata) -> None:
+    """XMP 패킷에서 숫자 속성(드론 비행 정보 등)을 읽습니다."""
+    for match in list(_XMP_ATTRIBUTE.finditer(packet)) + list(_XMP_ELEMENT.finditer(packet)):
+        name = match.group(2).decode("ascii", "ignore")
+        key = _XMP_KEYS.get(name)
+        if key is None:
+            continue
+        try:
+            value = float(match.group(3))
+        except ValueError:
+            continue
+        if key in ("relative_altitude", "yaw", "pitch"):
+            setattr(metadata, key, value)
+        else:
+            metadata.xmp[key] = value
+
+
+def _first(value):
+    """태그 값 튜플의 첫 값을 반환합니다."""
+    if isinstance(value, tuple) and value:
+        return value[0]
+    return None
+
+
+def _text(value) -> Optional[str]:
+    """ASCII 태그 값을 문자열로 반환합니다."""
+    if not isinstance(value, bytes):
+        return None
+    text = value.split(b"\x00", 1)[0].decode("utf-8", "replace").strip()
+    return text or None
+
+
+def _degrees(value, reference, negative: bytes) -> Optional[float]:
+    """GPS (도, 분, 초) 유리수 값을 십진 도로 변환합니다."""
+    if not isinstance(value, tuple) or len(value) != 3:
+        return None
+    degrees = value[0] + value[1] / 60.0 + value[2] / 3600.0
+    if isinstance(reference, bytes) and reference.startswith(negative):
+        degrees = -degrees
+    return degrees
+
+
+class MetadataIndex:
+    """촬영 메타데이터를 SQLite에 색인하고 질의합니다.
+
+    스캔은 작업자 스레드에서 파일 머리를 병렬로 읽고, 데이터베이스 쓰기는
+    스캔을 호출한 스레드에서 한 트랜잭션으로 처리합니다.
+
+    속성:
+        path (Path): 데이터베이스 파일 경로
+    """
+
+    _COLUMNS = [f.name for f in fields(CaptureMetadata)]
+
+    def __init__(self, path: Optional[Path] = None):
+        """MetadataIndex 인스턴스를 초기화합니다.
+
+        Args:
+            path: 데이터베이스 파일 경로. None이면 캐시 디렉토리의 기본 파일
+        """
+        if path is None:
+            from .. import get_cache_dir
+            path = get_cache_dir() / "metadata.sqlite"
+        self.path = Path(path)
+        self.path.parent.mkdir(parents=True, exist_ok=True)
+        self._lock = threading.Lock()
+        self._db = sqlite3.connect(str(self.path), check_same_thread=False)
+        self._db.execute("PRAGMA journal_mode=WAL")
+        self._db.execute("PRAGMA synchronous=NORMAL")
+        self._db.executescript("""
+            CREATE TABLE IF NOT EXISTS images (
+                path TEXT PRIMARY KEY, directory TEXT NOT NULL,
+                mtime_ns INTEGER, size INTEGER, width INTEGER, height INTEGER,
+                capture_time TEXT, make TEXT, model TEXT, focal_length REAL,
+                latitude REAL, longitude REAL, altitude REAL, relative_altitude REAL,
+                yaw REAL, pitch REAL, xmp TEXT);
+            CREATE INDEX IF NOT EXISTS images_directory ON images(directory);
+            CREATE INDEX IF NOT EXISTS images_capture_time ON images(capture_time);
+            CREATE INDEX IF NOT EXISTS images_altitude ON images(altitude);
+        """)
+
+    def scan(self, directory: str, workers: Optional[int] = None,
+             progress: Optional[Callable[[int, int], None]] = None) -> Tuple[int, int]:
+        """폴더의 영상을 색인합니다. 바뀐 파일만 다시 읽습니다.
+
+        Args:
+            directory: 영상 폴더 (하위 폴더 제외)
+            workers: 작업자 스레드 수. None이면 CPU 코어 수의 두 배 (입출력 대기 포함)
+            progress: (완료 수, 읽을 파일 수)로 호출되는 함수
+
+        Returns:
+            Tuple[int, int]: (새로 읽은 파일 수, 변경이 없어 건너뛴 파일 수)
+        """
+        directory = os.path.abspath(directory)
+        paths = list_images(directory)
+        with self._lock:
+            known = {row[0]: (row[1], row[2]) for row in self._db.execute(
+                "SELECT path, mtime_ns, size FROM images WHERE directory = ?", (directory,))}
+        changed = []
+        for path in paths:
+            try:
+                stat = os.stat(path)
+            except OSError:
+                continue
+            if known.pop(path, None) != (stat.st_mtime_ns, stat.st_size):
+                changed.append(path)
+
+        def read(path: str) -> Optional[CaptureMetadata]:
+            try:
+                return read_capture_metadata(path)
+            except (IOError, OSError):
+                return None
+
+        rows = []
+        workers = workers or 2 * (os.cpu_count() or 2)
+        with ThreadPoolExecutor(max_workers=workers, thread_name_prefix="metadata") as pool:
+            for done, metadata in enumerate(pool.map(read, changed), 1):
+                if metadata is not None:
+                    rows.append(self._row(metadata, directory))
+                if progress is not None:
+                    progress(done, len(changed))
+
+        with self._lock, self._db:
+            self._db.executemany(
+                f"INSERT OR REPLACE INTO images (directory, {', '.join(self._COLUMNS)}) "
+                f"VALUES ({', '.join('?' * (len(self._COLUMNS) + 1))})", rows)
+            # 폴더에서 사라진 파일은 색인에서 지운다
+            self._db.executemany("DELETE FROM images WHERE path = ?",
+                                 [(path,) for path in known])
+        return len(rows), len(paths) - len(changed)
+
+    def query(self, directory: Optional[str] = None, start: Optional[str] = None,
+              end: Optional[str] = None, min_altitude: Optional[float] = None,
+              max_altitude: Optional[float] = None, camera: Optional[str] = None,
+              relative: bool = False) -> List[CaptureMetadata]:
+        """조건에 맞는 영상을 촬영 시각 순으로 반환합니다.
+
+        Args:
+            directory: 폴더 (None이면 전체)
+            start: 촬영 시각 하한 (ISO 8601 문자열, 포함)
+            end: 촬영 시각 상한 (ISO 8601 문자열, 포함)
+            min_altitude: 고도 하한 (m)
+            max_altitude: 고도 상한 (m)
+            camera: 제조사 또는 모델에 포함된 문자열
+            relative: True이면 고도 조건을 이륙 지점 기준 고도(XMP)에 적용
+        """
+        clauses, values = [], []
+        altitude = "relative_altitude" if relative else "altitude"
+        for clause, value in (("directory = ?", directory and os.path.abspath(directory)),
+                              ("capture_time >= ?", start),
+                              ("capture_time <= ?", end),
+                              (f"{altitude} >= ?", min_altitude),
+                              (f"{altitude} <= ?", max_altitude)):
+            if value is not None:
+                clauses.append(clause)
+                values.append(value)
+        if camera:
+            clauses.append("(make LIKE ? OR model LIKE ?)")
+            values += [f"%{camera}%"] * 2
+        where = f"WHERE {' AND '.join(clauses)}" if clauses else ""
+        with self._lock:
+            rows = self._db.execute(
+                f"SELECT {', '.join(self._COLUMNS)} FROM images {where} "
+                f"ORDER BY capture_time, path", values).fetchall()
+        return [self._metadata(row) for row in rows]
+
+    def get(self, path: str) -> Optional[CaptureMetadata]:
+        """색인된 영상 하나의 메타데이터를 반환합니다. 없으면 None."""
+        with self._lock:
+            row = self._db.execute(f"SELECT {', '.join(self._COLUMNS)} FROM images "
+                                   f"WHERE path = ?", (os.path.abspath(path),)).fetchone()
+        return self._metadata(row) if row else None
+
+    def close(self) -> None:
+        """데이터베이스 연결을 닫습니다."""
+        with self._lock:
+            self._db.close()
+
+    def _row(self, metadata: CaptureMetadata, directory: str) -> tuple:
+        values = asdict(metadata)
+        values["xmp"] = json.dumps(metadata.xmp) if metadata.xmp else None
+        return (directory,) + tuple(values[name] for name in self._COLUMNS)
+
+    def _metadata(self, row: Sequence) -> CaptureMetadata:
+        values = dict(zip(self._COLUMNS, row))
+        values["xmp"] = json.loads(values["xmp"]) if values["xmp"] else {}
+        return CaptureMetadata(**values)
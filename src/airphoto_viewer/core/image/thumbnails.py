@@ -0,0 +1,506 @@
+"""
+폴더의 영상 썸네일을 병렬로 만들고 영구 캐시에 보관하는 모듈입니다.
+
+썸네일은 가능한 한 적게 디코딩해서 만듭니다.
+
+* JPEG: EXIF에 내장된 썸네일이 충분히 크고 종횡비가 같으면 그대로 사용하고,
+  아니면 DCT 축소 디코딩(Pillow draft, 최대 1/8)으로 읽습니다.
+* 여러 페이지 TIFF(COG 등): 썸네일 크기 이상인 가장 작은 오버뷰 페이지를 읽습니다.
+* 그 밖의 형식: 전체를 디코딩해 축소합니다.
+
+결과는 `core.init()` 캐시 디렉토리의 단일 데이터베이스 파일에 추가 기록됩니다.
+레코드는 (고정 크기 머리말 + BGR 픽셀)이고 파일 전체를 메모리 맵으로 열어
+썸네일을 복사 없이 NumPy 뷰로 돌려줍니다. 키는 절대 경로이며, 레코드에 저장된
+수정 시각·파일 크기가 현재 파일과 다르면 다시 만듭니다. 여러 프로세스가 같은
+파일을 쓸 때는 잠금 파일의 배타 잠금으로 기록과 압축을 직렬화합니다.
+"""
+
+import hashlib
+import io
+import mmap
+import os
+import struct
+import threading
+from concurrent.futures import ThreadPoolExecutor
+from pathlib import Path
+from typing import Callable, Dict, List, Optional, Sequence, Tuple
+
+import cv2
+import numpy as np
+from PIL import ExifTags, Image
+
+from ..tile.background_loader import BackgroundLoader
+
+# 썸네일을 만들 영상 확장자
+THUMBNAIL_EXTENSIONS = {".jpg", ".jpeg", ".tif", ".tiff", ".png", ".jp2", ".bmp"}
+
+# 기본 썸네일 크기 (긴 변 픽셀 수)
+DEFAULT_THUMBNAIL_SIZE = 128
+
+# 파일 머리말: 매직(버전 포함), 썸네일 크기, 예약
+_FILE_HEADER = struct.Struct("<8sII")
+_MAGIC = b"APTHUMB1"
+# 레코드 머리말: 매직, 경로 해시, 수정 시각(ns), 파일 크기, 원본 크기, 썸네일 크기, 픽셀 바이트 수
+_RECORD = struct.Struct("<4s16sqqIIHHI")
+_RECORD_MAGIC = b"THMB"
+
+# EXIF 방향 값 → 바로 세우는 Pillow 변환 (OpenCV imread와 같은 방향으로 표시)
+_ORIENTATION_TRANSPOSE = {
+    2: Image.Transpose.FLIP_LEFT_RIGHT,
+    3: Image.Transpose.ROTATE_180,
+    4: Image.Transpose.FLIP_TOP_BOTTOM,
+    5: Image.Transpose.TRANSPOSE,
+    6: Image.Transpose.ROTATE_270,
+    7: Image.Transpose.TRANSVERSE,
+    8: Image.Transpose.ROTATE_90,
+}
+
+
+def list_images(directory: str) -> List[str]:
+    """폴더의 영상 파일 경로를 이름 순으로 반환합니다 (하위 폴더 제외)."""
+    with os.scandir(directory) as entries:
+        paths = [entry.path for entry in entries
+                 if entry.is_file() and os.path.splitext(entry.name)[1].lower()
+                 in THUMBNAIL_EXTENSIONS]
+    return sorted(paths)
+
+
+def make_thumbnail(path: str, size: int = DEFAULT_THUMBNAIL_SIZE
+                   ) -> Tuple[np.ndarray, Tuple[int, int]]:
+    """영상의 썸네일을 만듭니다.
+
+    Args:
+        path: 영상 경로
+        size: 썸네일 긴 변 픽셀 수
+
+    Returns:
+        Tuple[np.ndarray, Tuple[int, int]]: (8비트 BGR 썸네일, 원본 (너비, 높이))
+
+    Raises:
+        IOError: 영상을 읽을 수 없는 경우
+    """
+    try:
+        with Image.open(path) as image:
+            source_size = image.size
+            orientation = image.getexif().get(0x0112, 1) if "exif" in image.info else 1
+            preview = _exif_thumbnail(image, size)
+            if preview is None:
+                preview = _reduced_page(image, size)
+            preview = preview.convert("RGB")
+            if orientation in _ORIENTATION_TRANSPOSE:
+                preview = preview.transpose(_ORIENTATION_TRANSPOSE[orientation])
+                if orientation >= 5:
+                    source_size = source_size[::-1]
+            array = np.asarray(preview)[..., ::-1]
+    except Exception:
+        # Pillow가 읽지 못하는 형식(다중밴드, 16비트 등)은 OpenCV로 축소 디코딩한다
+        array = cv2.imread(path, cv2.IMREAD_REDUCED_COLOR_8)
+        if array is None:
+            raise IOError(f"썸네일을 만들 수 없습니다: {path}")
+        source_size = (array.shape[1] * 8, array.shape[0] * 8)
+    h, w = array.shape[:2]
+    scale = size / max(w, h)
+    if scale < 1.0:
+        array = cv2.resize(array, (max(1, round(w * scale)), max(1, round(h * scale))),
+                           interpolation=cv2.INTER_AREA)
+    return np.ascontiguousarray(array), source_size
+
+
+def _exif_thumbnail(image: Image.Image, size: int) -> Optional[Image.Image]:
+    """충분히 크고 종횡비가 같은 EXIF 내장 썸네일을 반환합니다. 없으면 None."""
+    raw = image.info.get("exif")
+    if image.format != "JPEG" or not raw:
+        return None
+    ifd1 = image.getexif().get_ifd(ExifTags.IFD.IFD1)
+    offset, length = ifd1.get(0x0201), ifd1.get(0x0202)
+    if not offset or not length:
+        return None
+    start = 6 if raw.startswith(b"Exif") else 0
+    try:
+        thumb = Image.open(io.BytesIO(raw[start + offset:start + offset + length]))
+        thumb.load()
+    except Exception:
+        return None
+    # 3:2 영상에 4:3 썸네일처럼 여백이 들어간 경우는 쓰지 않는다
+    if max(thumb.size) < size or abs(thumb.width / thumb.height
+                                     - image.width / image.height) > 0.02:
+        return None
+    return thumb
+
+
+def _reduced_page(image: Image.Image, size: int) -> Image.Image:
+    """가능한 한 적게 디코딩한 축소 영상을 반환합니다."""
+    if image.format == "JPEG":
+        # DCT 단계에서 1/2~1/8로 축소 디코딩 (결과는 요청 크기 이상)
+        image.draft("RGB", (size, size))
+    elif getattr(image, "n_frames", 1) > 1:
+        # 썸네일 크기 이상이면서 가장 작은, 종횡비가 같은 페이지 (COG 오버뷰 등)
+        width, height = image.size
+        best = 0
+        for page in range(1, image.n_frames):
+            image.seek(page)
+            w, h = image.size
+            if min(w, h) and abs(w / h - width / height) < 0.02 and max(w, h) >= size:
+                best = page
+        image.seek(best)
+    image.load()
+    return image
+
+
+def _path_key(path: str) -> bytes:
+    """절대 경로의 16바이트 해시 키를 반환합니다."""
+    normalized = os.path.normcase(os.path.abspath(path))
+    return hashlib.blake2b(normalized.encode("utf-8", "surrogateescape"),
+                           digest_size=16).digest()
+
+
+class _FileLock:
+    """잠금 파일에 대한 프로세스 간 배타 잠금입니다 (POSIX flock, Windows msvcrt.locking).
+
+    같은 프로세스의 스레드끼리는 배제하지 않으므로 스레드 잠금 안에서 사용합니다.
+    """
+
+    def __init__(self, path: Path):
+        """잠금 파일을 엽니다 (없으면 생성)."""
+        self._file = open(path, "a+b")
+
+    def __enter__(self) -> "_FileLock":
+        if os.name == "nt":
+            import msvcrt
+            self._file.seek(0)
+            while True:
+                try:
+                    msvcrt.locking(self._file.fileno(), msvcrt.LK_LOCK, 1)
+                    break
+                except OSError:
+                    continue  # LK_LOCK은 10초 동안 재시도한 뒤 실패하므로 다시 기다린다
+        else:
+            import fcntl
+            fcntl.flock(self._file.fileno(), fcntl.LOCK_EX)
+        return self
+
+    def __exit__(self, *exc) -> None:
+        if os.name == "nt":
+            import msvcrt
+            self._file.seek(0)
+            msvcrt.locking(self._file.fileno(), msvcrt.LK_UNLCK, 1)
+        else:
+            import fcntl
+            fcntl.flock(self._file.fileno(), fcntl.LOCK_UN)
+
+    def close(self) -> None:
+        """잠금 파일을 닫습니다."""
+        self._file.close()
+
+
+class ThumbnailDatabase:
+    """메모리 맵으로 읽는 추가 기록식 썸네일 데이터베이스입니다.
+
+    열 때 레코드 머리말만 훑어 색인을 만들고, 썸네일 픽셀은 요청 시 메모리 맵의
+    뷰로 반환합니다. 같은 경로의 레코드가 여러 개면 마지막 것이 유효합니다.
+
+    여러 프로세스가 같은 파일을 함께 쓸 수 있습니다. 레코드 추가, 끊긴 마지막
+    레코드 잘라내기, 압축은 잠금 파일(`<파일>.lock`)의 배타 잠금 안에서 하며,
+    레코드는 잠금을 놓기 전에 파일에 모두 기록됩니다. 따라서 열 때 끝에 남은
+    조각은 기록 도중 종료된 프로세스의 것뿐이므로 잘라내도 안전합니다. 다른
+    프로세스가 추가한 레코드는 다음 추가 때 색인에 반영되고, 다른 프로세스가
+    압축해 파일이 바뀌면 색인을 다시 만듭니다.
+
+    속성:
+        path (Path): 데이터베이스 파일 경로
+        size (int): 썸네일 긴 변 픽셀 수
+        stale_bytes (int): 더 이상 쓰이지 않는 레코드의 바이트 수
+    """
+
+    def __init__(self, path: Path, size: int = DEFAULT_THUMBNAIL_SIZE):
+        """ThumbnailDatabase 인스턴스를 초기화합니다.
+
+        Args:
+            path: 데이터베이스 파일 경로 (없으면 생성)
+            size: 썸네일 긴 변 픽셀 수
+
+        Raises:
+            ValueError: 다른 형식이거나 썸네일 크기가 다른 파일인 경우
+        """
+        self.path = Path(path)
+        self.size = size
+        self.stale_bytes = 0
+        self._lock = threading.Lock()
+        self._index: Dict[bytes, tuple] = {}
+        self._map: Optional[mmap.mmap] = None
+        self.path.parent.mkdir(parents=True, exist_ok=True)
+        self._file_lock = _FileLock(self.path.with_name(self.path.name + ".lock"))
+        try:
+            with self._file_lock:
+                if not self.path.exists() or self.path.stat().st_size < _FILE_HEADER.size:
+                    with open(self.path, "wb") as f:
+                        f.write(_FILE_HEADER.pack(_MAGIC, size, 0))
+                self._end = self._scan(_FILE_HEADER.size)
+                if self._end < self.path.stat().st_size:
+                    os.truncate(self.path, self._end)
+                self._open_writer()
+        except BaseException:
+            self._file_lock.close()
+            raise
+
+    def __len__(self) -> int:
+        return len(self._index)
+
+    def _open_writer(self) -> None:
+        """추가 기록 파일을 열고 파일 식별 번호를 기억합니다."""
+        self._writer = open(self.path, "ab")
+        self._inode = os.fstat(self._writer.fileno()).st_ino
+
+    def _scan(self, offset: int) -> int:
+        """offset부터 레코드 머리말을 읽어 색인에 더하고 마지막 온전한 레코드의 끝을 반환합니다."""
+        with open(self.path, "rb") as f:
+            magic, size, _ = _FILE_HEADER.unpack(f.read(_FILE_HEADER.size))
+            if magic != _MAGIC or size != self.size:
+                raise ValueError(f"썸네일 데이터베이스 형식이 다릅니다: {self.path}")
+            total = os.fstat(f.fileno()).st_size
+            while offset + _RECORD.size <= total:
+                f.seek(offset)
+                magic, key, mtime, length, sw, sh, tw, th, nbytes = \
+                    _RECORD.unpack(f.read(_RECORD.size))
+                end = offset + _RECORD.size + nbytes
+                if magic != _RECORD_MAGIC or nbytes != tw * th * 3 or end > total:
+                    break
+                self._add_locked(key, (offset + _RECORD.size, mtime, length, sw, sh, tw, th))
+                offset = end
+        return offset
+
+    def _sync_locked(self) -> None:
+        """다른 프로세스가 추가한 레코드를 색인에 더하고, 압축으로 파일이 바뀌었으면
+        색인을 다시 만듭니다 (두 잠금을 모두 잡은 상태에서 호출)."""
+        if os.stat(self.path).st_ino != self._inode:
+            self._writer.close()
+            self._index = {}
+            self._map = None
+            self.stale_bytes = 0
+            self._open_writer()
+            self._end = self._scan(_FILE_HEADER.size)
+        else:
+            self._end = self._scan(self._end)
+
+    def get(self, path: str, stat: Optional[os.stat_result] = None
+            ) -> Optional[Tuple[np.ndarray, Tuple[int, int]]]:
+        """유효한 썸네일을 (읽기 전용 BGR 뷰, 원본 크기)로 반환합니다. 없으면 None.
+
+        Args:
+            path: 영상 경로
+            stat: 미리 구한 os.stat 결과 (None이면 직접 조회)
+        """
+        entry = self._index.get(_path_key(path))
+        if entry is None:
+            return None
+        if stat is None:
+            try:
+                stat = os.stat(path)
+            except OSError:
+                return None
+        offset, mtime, length, sw, sh, tw, th = entry
+        if mtime != stat.st_mtime_ns or length != stat.st_size:
+            return None
+        with self._lock:
+            if self._map is None or len(self._map) < offset + tw * th * 3:
+                # 추가 기록으로 파일이 커졌으면 다시 매핑한다 (이전 뷰는 그대로 유효)
+                with open(self.path, "rb") as f:
+                    if os.fstat(f.fileno()).st_ino != self._inode:
+                        # 다른 프로세스가 압축해 위치가 달라졌다 (다음 추가 때 색인을 다시 만듦)
+                        return None
+                    self._map = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+            buffer = self._map
+        thumb = np.frombuffer(buffer, dtype=np.uint8, count=tw * th * 3, offset=offset)
+        return thumb.reshape(th, tw, 3), (sw, sh)
+
+    def put(self, path: str, stat: os.stat_result, thumb: np.ndarray,
+            source_size: Tuple[int, int]) -> None:
+        """썸네일 레코드를 추가합니다 (스레드·프로세스 안전).
+
+        Args:
+            path: 영상 경로
+            stat: 썸네일을 만들 때의 os.stat 결과
+            thumb: 8비트 BGR 썸네일
+            source_size: 원본 (너비, 높이)
+        """
+        th, tw = thumb.shape[:2]
+        key = _path_key(path)
+        data = np.ascontiguousarray(thumb, dtype=np.uint8).tobytes()
+        header = _RECORD.pack(_RECORD_MAGIC, key, stat.st_mtime_ns, stat.st_size,
+                              source_size[0], source_size[1], tw, th, len(data))
+        with self._lock, self._file_lock:
+            self._sync_locked()
+            self._writer.seek(0, os.SEEK_END)
+            offset = self._writer.tell() + _RECORD.size
+            self._writer.write(header + data)
+            # 잠금을 놓기 전에 레코드 전체를 파일에 기록한다
+            self._writer.flush()
+            self._end = offset + len(data)
+            self._add_locked(key, (offset, stat.st_mtime_ns, stat.st_size,
+                                   source_size[0], source_size[1], tw, th))
+
+    def _add_locked(self, key: bytes, entry: tuple) -> None:
+        """색인 항목을 추가하고, 대체된 레코드를 낡은 바이트로 셉니다."""
+        previous = self._index.get(key)
+        if previous is not None:
+            self.stale_bytes += _RECORD.size + previous[5] * previous[6] * 3
+        self._index[key] = entry
+
+    def compact(self) -> None:
+        """유효한 레코드만 새 파일에 옮겨 쓰고 교체합니다.
+
+        이전에 반환한 뷰는 이전 매핑을 참조하므로 계속 유효합니다.
+        """
+        with self._lock, self._file_lock:
+            self._sync_locked()
+            temporary = self.path.with_suffix(".tmp")
+            index = {}
+            with open(self.path, "rb") as source, open(temporary, "wb") as target:
+                target.write(_FILE_HEADER.pack(_MAGIC, self.size, 0))
+                for key, entry in self._index.items():
+                    offset, tw, th = entry[0], entry[5], entry[6]
+                    source.seek(offset - _RECORD.size)
+                    record = source.read(_RECORD.size + tw * th * 3)
+                    index[key] = (target.tell() + _RECORD.size,) + entry[1:]
+                    target.write(record)
+                end = target.tell()
+            self._writer.close()
+            os.replace(temporary, self.path)
+            self._index = index
+            self._map = None
+            self.stale_bytes = 0
+            self._end = end
+            self._open_writer()
+
+    def close(self) -> None:
+        """기록 파일을 닫습니다. 반환한 뷰가 살아 있는 동안 매핑은 유지됩니다."""
+        with self._lock:
+            self._writer.close()
+            self._file_lock.close()
+            self._map = None
+
+
+_shared_databases: Dict[int, ThumbnailDatabase] = {}
+_shared_lock = threading.Lock()
+
+
+def get_shared_thumbnail_database(size: int = DEFAULT_THUMBNAIL_SIZE) -> ThumbnailDatabase:
+    """캐시 디렉토리의 썸네일 데이터베이스를 반환합니다 (크기별로 프로세스에 하나).
+
+    처음 열 때 낡은 레코드가 파일의 절반을 넘으면 압축합니다.
+
+    Args:
+        size: 썸네일 긴 변 픽셀 수
+    """
+    with _shared_lock:
+        database = _shared_databases.get(size)
+        if database is None:
+            from .. import get_cache_dir
+            database = ThumbnailDatabase(get_cache_dir() / f"thumbnails_{size}.db", size)
+            if database.stale_bytes > database.path.stat().st_size // 2:
+                database.compact()
+            _shared_databases[size] = database
+        return database
+
+
+class ThumbnailService:
+    """폴더 썸네일을 캐시에서 꺼내거나 작업자 스레드 풀에서 만듭니다.
+
+    Pillow/OpenCV 디코딩은 GIL을 해제하므로 스레드 풀로 모든 코어를 사용합니다.
+    요청은 우선순위 큐로 처리되어 화면에 보이는 항목을 먼저 만들 수 있습니다.
+
+    속성:
+        database (ThumbnailDatabase): 썸네일 데이터베이스
+        size (int): 썸네일 긴 변 픽셀 수
+    """
+
+    def __init__(self, size: int = DEFAULT_THUMBNAIL_SIZE,
+                 database: Optional[ThumbnailDatabase] = None,
+                 workers: Optional[int] = None):
+        """ThumbnailService 인스턴스를 초기화합니다.
+
+        Args:
+            size: 썸네일 긴 변 픽셀 수
+            database: 사용할 데이터베이스. None이면 캐시 디렉토리의 기본 파일
+            workers: 작업자 스레드 수. None이면 CPU 코어 수
+        """
+        # 공유 데이터베이스는 다른 사용자(모자이크 개요 등)도 쓰므로 닫지 않는다
+        self._owns_database = database is not None
+        if database is None:
+            database = get_shared_thumbnail_database(size)
+        self.database = database
+        self.size = database.size
+        self._workers = workers or os.cpu_count() or 4
+        self._loader = BackgroundLoader(self._workers)
+
+    def lookup(self, path: str) -> Optional[Tuple[np.ndarray, Tuple[int, int]]]:
+        """캐시된 유효한 썸네일을 반환합니다. 없으면 None."""
+        return self.database.get(path)
+
+    def request(self, path: str,
+                callback: Callable[[str, Optional[Tuple[np.ndarray, Tuple[int, int]]]], None],
+                priority: float = 0.0) -> Optional[Tuple[np.ndarray, Tuple[int, int]]]:
+        """썸네일을 요청합니다.
+
+        캐시에 있으면 바로 반환하고, 없으면 생성 작업을 대기열에 넣고 None을
+        반환합니다. 생성이 끝나면 작업자 스레드에서 callback(path, 결과)가
+        호출되며, 실패하면 결과는 None입니다.
+
+        Args:
+            path: 영상 경로
+            callback: 완료 시 호출할 함수
+            priority: 우선순위 (작을수록 먼저)
+        """
+        cached = self.database.get(path)
+        if cached is not None:
+            return cached
+        self._loader.queue_tile_load(path, lambda: self._generate(path), priority,
+                                     callback)
+        return None
+
+    def populate(self, paths: Sequence[str],
+                 progress: Optional[Callable[[int, int], None]] = None) -> int:
+        """경로 목록의 썸네일을 모두 준비될 때까지 만듭니다 (폴더 미리 채우기).
+
+        Args:
+            paths: 영상 경로 목록
+            progress: (완료 수, 전체 수)로 호출되는 함수
+
+        Returns:
+            int: 새로 만든 썸네일 수
+        """
+        missing = [path for path in paths if self.database.get(path) is None]
+        finished = len(paths) - len(missing)
+        if progress is not None:
+            progress(finished, len(paths))
+        created = 0
+        if not missing:
+            return 0
+        with ThreadPoolExecutor(max_workers=self._workers,
+                                thread_name_prefix="thumbnail") as pool:
+            for result in pool.map(self._generate, missing):
+                finished += 1
+                created += result is not None
+                if progress is not None:
+                    progress(finished, len(paths))
+        return created
+
+    def cancel_pending(self) -> int:
+        """아직 시작되지 않은 썸네일 요청을 모두 취소합니다."""
+        return self._loader.cancel_pending_requests()
+
+    def close(self) -> None:
+        """작업자를 종료하고(실행 중인 생성은 마칠 때까지 기다림) 데이터베이스를 닫습니다."""
+        self._loader.shutdown(wait=True)
+        if self._owns_database:
+            self.database.close()
+
+    def _generate(self, path: str) -> Optional[Tuple[np.ndarray, Tuple[int, int]]]:
+        """썸네일을 만들어 데이터베이스에 기록합니다 (작업자 스레드)."""
+        try:
+            stat = os.stat(path)
+            thumb, source_size = make_thumbnail(path, self.size)
+        except Exception:
+            return None
+        self.database.put(path, stat, thumb, source_size)
+        return thumb, source_size
@@ -0,0 +1,56 @@
+"""
+TIFF IFD(이미지 파일 디렉터리)를 직렬화하는 모듈입니다.
+
+타일 TIFF/COG 작성기와, 바뀐 블록 하나만 담은 TIFF를 메모리에서 만들어
+디코딩하는 파일 변경 감지가 함께 사용합니다.
+"""
+
+import struct
+from typing import Sequence, Tuple
+
+# TIFF 필드 자료형: (코드, 바이트 수, struct 형식)
+TIFF_ASCII = (2, 1, "s")
+TIFF_SHORT = (3, 2, "H")
+TIFF_LONG = (4, 4, "I")
+TIFF_DOUBLE = (12, 8, "d")
+TIFF_LONG8 = (16, 8, "Q")
+
+
+def encode_ifd(entries: Sequence[Tuple[int, tuple, Sequence]], offset: int,
+               bigtiff: bool, next_ifd: int = 0) -> bytes:
+    """IFD 하나를 직렬화합니다. 값이 칸에 들어가지 않으면 IFD 바로 뒤에 둡니다.
+
+    Args:
+        entries: (태그, 자료형, 값 목록) 목록. 태그 순으로 정렬됨
+        offset: 파일에서 이 IFD가 놓일 위치
+        bigtiff: BigTIFF 형식 여부
+        next_ifd: 다음 IFD 위치 (없으면 0)
+
+    Returns:
+        bytes: IFD와 넘친 값 영역
+    """
+    entries = sorted(entries, key=lambda e: e[0])
+    count_fmt, entry_size, slot, offset_fmt = (("<Q", 20, 8, "<Q") if bigtiff
+                                               else ("<H", 12, 4, "<I"))
+    head = struct.calcsize(count_fmt)
+    overflow_at = offset + head + entry_size * len(entries) + slot
+    body = bytearray(struct.pack(count_fmt, len(entries)))
+    overflow = bytearray()
+    for tag, (code, size, fmt), values in entries:
+        if fmt == "s":
+            data = values.encode("ascii") + b"\x00" if isinstance(values, str) else bytes(values)
+            count = len(data)
+        else:
+            data = struct.pack(f"<{len(values)}{fmt}", *values)
+            count = len(values)
+        body += struct.pack("<HH", tag, code)
+        body += struct.pack(offset_fmt, count)
+        if len(data) <= slot:
+            body += data.ljust(slot, b"\x00")
+        else:
+            if (overflow_at + len(overflow)) % 2:
+                overflow += b"\x00"
+            body += struct.pack(offset_fmt, overflow_at + len(overflow))
+            overflow += data
+    body += struct.pack(offset_fmt, next_ifd)
+    return bytes(body + overflow)
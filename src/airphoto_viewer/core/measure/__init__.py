@@ -0,0 +1,22 @@
+"""
+거리·면적 측정 기능을 제공하는 모듈입니다.
+
+이 모듈은 픽셀 좌표 도형을 지상 좌표로 바꿔 측지 길이와 면적을 계산합니다.
+"""
+
+from ...utils.lazy_import import lazy_exports
+
+# 공개 이름은 처음 사용할 때 해당 하위 모듈만 가져온다 (시작 시간 단축)
+__getattr__, __dir__ = lazy_exports(__name__, {
+    'CoordinateConverter': '.coordinates',
+    'cached_transformer': '.coordinates',
+    'LiveMeasurement': '.geodesic',
+    'MeasurementEngine': '.geodesic',
+    'format_area': '.geodesic',
+    'format_length': '.geodesic',
+})
+
+__all__ = [
+    'CoordinateConverter', 'LiveMeasurement', 'MeasurementEngine', 'cached_transformer',
+    'format_area', 'format_length',
+]
@@ -0,0 +1,117 @@
+"""
+커서 좌표 표시용 좌표 변환 모듈입니다.
+
+`pyproj.Transformer` 생성은 수 밀리초가 걸리므로 좌표계 쌍마다 한 번만
+만들어 공유합니다(`cached_transformer`). 픽셀 → 투영 좌표 아핀 변환은
+계수를 파이썬 실수로 미리 풀어 두어 numpy 호출 없이 계산합니다.
+"""
+
+from functools import lru_cache
+from typing import Optional, Tuple, Union
+
+from pyproj import CRS, Transformer
+
+from ..image.georef import GeoTransform
+
+CrsLike = Union[str, int, CRS]
+
+WGS84 = "EPSG:4326"
+
+
+@lru_cache(maxsize=64)
+def cached_transformer(source: str, target: str) -> Transformer:
+    """좌표계 쌍의 변환기를 만들거나 캐시에서 반환합니다 (경도, 위도 순서).
+
+    Args:
+        source: 원본 좌표계 (EPSG 코드 문자열, WKT 등)
+        target: 대상 좌표계
+
+    Returns:
+        Transformer: always_xy 변환기
+    """
+    return Transformer.from_crs(source, target, always_xy=True)
+
+
+def utm_zone(lon: float, lat: float) -> Tuple[int, bool]:
+    """경위도가 속한 UTM 존 번호와 북반구 여부를 반환합니다."""
+    zone = int((lon + 180.0) // 6.0) + 1
+    return (min(max(zone, 1), 60), lat >= 0.0)
+
+
+class CoordinateConverter:
+    """픽셀 좌표를 투영 좌표·WGS84 경위도·UTM 좌표로 변환합니다.
+
+    속성:
+        geotransform (Optional[GeoTransform]): 픽셀 → 지상 변환
+        crs (Optional[CRS]): 지상 좌표계
+    """
+
+    def __init__(self, geotransform: Optional[GeoTransform] = None,
+                 crs: Optional[CrsLike] = None):
+        """CoordinateConverter 인스턴스를 초기화합니다.
+
+        Args:
+            geotransform: 픽셀 → 지상 변환. None이면 픽셀 좌표만 표시
+            crs: 지상 좌표계. None이면 경위도/UTM을 표시하지 않음
+
+        Raises:
+            ValueError: 좌표계를 해석할 수 없는 경우
+        """
+        self.geotransform = geotransform
+        self.crs = CRS.from_user_input(crs) if crs is not None else None
+        c = geotransform.coefficients if geotransform is not None else (0, 1, 0, 0, 0, 1)
+        self._affine = tuple(float(v) for v in c)
+        self._to_wgs84: Optional[Transformer] = None
+        self._projected = False
+        self._native_utm = False
+        if geotransform is not None and self.crs is not None:
+            key = self.crs.to_string()
+            self._to_wgs84 = cached_transformer(key, WGS84)
+            self._projected = not self.crs.is_geographic
+            self._native_utm = self.crs.utm_zone is not None
+
+    @property
+    def georeferenced(self) -> bool:
+        """경위도 변환이 가능한지 여부를 반환합니다."""
+        return self._to_wgs84 is not None
+
+    def pixel_to_ground(self, x: float, y: float) -> Tuple[float, float]:
+        """픽셀 좌표 하나를 지상 좌표로 변환합니다."""
+        c0, c1, c2, c3, c4, c5 = self._affine
+        return (c0 + x * c1 + y * c2, c3 + x * c4 + y * c5)
+
+    def pixel_to_lonlat(self, x: float, y: float) -> Tuple[float, float]:
+        """픽셀 좌표 하나를 WGS84 (경도, 위도)로 변환합니다.
+
+        Raises:
+            ValueError: 지리참조가 없는 경우
+        """
+        if self._to_wgs84 is None:
+            raise ValueError("지리참조가 없어 경위도로 변환할 수 없습니다.")
+        return self._to_wgs84.transform(*self.pixel_to_ground(x, y))
+
+    def format(self, x: float, y: float) -> str:
+        """상태 표시줄용 좌표 문자열을 만듭니다.
+
+        Args:
+            x, y: 레벨 0 픽셀 좌표
+
+        Returns:
+            str: 픽셀, 투영 좌표, WGS84, UTM을 '|'로 구분한 문자열
+        """
+        parts = [f"픽셀 ({x:.1f}, {y:.1f})"]
+        if self.geotransform is not None and (self.crs is None or self._projected):
+            gx, gy = self.pixel_to_ground(x, y)
+            parts.append(f"X {gx:,.2f}  Y {gy:,.2f}")
+        if self._to_wgs84 is not None:
+            gx, gy = self.pixel_to_ground(x, y)
+            lon, lat = self._to_wgs84.transform(gx, gy)
+            parts.append(f"WGS84 {abs(lat):.7f}°{'N' if lat >= 0 else 'S'} "
+                         f"{abs(lon):.7f}°{'E' if lon >= 0 else 'W'}")
+            if not self._native_utm and abs(lat) <= 84.0:
+                zone, north = utm_zone(lon, lat)
+                epsg = (32600 if north else 32700) + zone
+                easting, northing = cached_transformer(WGS84, f"EPSG:{epsg}").transform(lon, lat)
+                parts.append(f"UTM {zone}{'N' if north else 'S'} "
+                             f"{easting:,.1f}E {northing:,.1f}N")
+        return " | ".join(parts)
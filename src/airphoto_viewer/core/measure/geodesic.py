@@ -0,0 +1,246 @@
+"""
+지오트랜스폼과 좌표계를 이용한 측지 거리/면적 측정 모듈입니다.
+
+픽셀 좌표는 지오트랜스폼으로 지상 좌표가 되고, pyproj `Transformer`로
+경위도로 바뀐 뒤 좌표계 타원체의 `Geod`로 측지 길이와 면적을 계산합니다.
+모든 단계가 정점 배열 전체를 한 번에 처리하므로 정점 수천 개의 도형도
+호출 몇 번으로 끝납니다. 변환기와 타원체는 엔진 생성 시 한 번만 만듭니다.
+
+좌표계가 없으면 지상 좌표(또는 픽셀) 평면에서 유클리드 길이와 신발끈
+공식 면적을 돌려줍니다. 픽셀 좌표를 좌표계 좌표로 해석하면 틀린 값이
+조용히 나오므로, 측지 계산에는 지오트랜스폼이 반드시 있어야 합니다.
+"""
+
+from typing import List, Optional, Sequence, Tuple, Union
+
+import numpy as np
+from pyproj import CRS, Geod, Transformer
+
+from ..image.georef import GeoTransform
+
+CrsLike = Union[str, int, CRS]
+
+
+class MeasurementEngine:
+    """픽셀 좌표 도형의 측지 길이/면적을 계산합니다.
+
+    속성:
+        geotransform (Optional[GeoTransform]): 픽셀 → 지상 변환. None이면 픽셀 평면 측정
+        crs (Optional[CRS]): 지상 좌표계. None이면 평면 측정
+        geodesic (bool): 측지 계산 여부
+    """
+
+    def __init__(self, geotransform: Optional[GeoTransform] = None,
+                 crs: Optional[CrsLike] = None):
+        """MeasurementEngine 인스턴스를 초기화합니다.
+
+        Args:
+            geotransform: 픽셀 → 지상 변환
+            crs: 지상 좌표계 (EPSG 코드, WKT, PROJ 문자열 또는 CRS)
+
+        Raises:
+            ValueError: 좌표계를 해석할 수 없거나, 좌표계만 있고 지오트랜스폼이 없는 경우
+        """
+        if crs is not None and geotransform is None:
+            raise ValueError("지오트랜스폼 없이 좌표계만으로는 측지 측정을 할 수 없습니다.")
+        self.geotransform = geotransform
+        self.crs = CRS.from_user_input(crs) if crs is not None else None
+        self.geodesic = self.crs is not None
+        self._to_lonlat: Optional[Transformer] = None
+        self._geod: Optional[Geod] = None
+        if self.crs is not None:
+            geographic = self.crs.geodetic_crs
+            if geographic is None:
+                raise ValueError(f"측지 기준을 알 수 없는 좌표계입니다: {self.crs.name}")
+            self._to_lonlat = Transformer.from_crs(self.crs, geographic, always_xy=True)
+            self._geod = geographic.get_geod()
+
+    @property
+    def units(self) -> str:
+        """길이 단위 이름을 반환합니다 (측지 계산은 항상 미터)."""
+        if self.geodesic:
+            return "m"
+        if self.crs is None and self.geotransform is None:
+            return "px"
+        return "지상 단위"
+
+    def pixel_to_ground(self, pixels) -> np.ndarray:
+        """(N, 2) 픽셀 좌표를 지상 좌표로 변환합니다."""
+        pixels = np.asarray(pixels, dtype=np.float64).reshape(-1, 2)
+        if self.geotransform is None:
+            return pixels
+        return self.geotransform.pixel_to_ground(pixels)
+
+    def pixel_to_lonlat(self, pixels) -> Tuple[np.ndarray, np.ndarray]:
+        """(N, 2) 픽셀 좌표를 (경도 배열, 위도 배열)로 변환합니다.
+
+        Raises:
+            ValueError: 좌표계가 없는 경우
+        """
+        if self._to_lonlat is None:
+            raise ValueError("좌표계가 없어 경위도로 변환할 수 없습니다.")
+        ground = self.pixel_to_ground(pixels)
+        lon, lat = self._to_lonlat.transform(ground[:, 0], ground[:, 1])
+        return np.asarray(lon, dtype=np.float64), np.asarray(lat, dtype=np.float64)
+
+    def segment_lengths(self, pixels) -> np.ndarray:
+        """연속한 정점 사이 (N-1)개 구간의 길이를 반환합니다."""
+        pixels = np.asarray(pixels, dtype=np.float64).reshape(-1, 2)
+        if len(pixels) < 2:
+            return np.zeros(0)
+        if not self.geodesic:
+            return np.hypot(*np.diff(self.pixel_to_ground(pixels), axis=0).T)
+        lon, lat = self.pixel_to_lonlat(pixels)
+        _, _, distance = self._geod.inv(lon[:-1], lat[:-1], lon[1:], lat[1:])
+        return np.asarray(distance, dtype=np.float64)
+
+    def length(self, pixels) -> float:
+        """폴리라인 길이를 반환합니다."""
+        return float(self.segment_lengths(pixels).sum())
+
+    def lengths(self, polylines: Sequence) -> np.ndarray:
+        """여러 폴리라인의 길이를 한 번의 변환/측지 호출로 계산합니다.
+
+        Args:
+            polylines: (Ni, 2) 픽셀 좌표 배열 목록
+
+        Returns:
+            np.ndarray: 폴리라인별 길이
+        """
+        arrays = [np.asarray(p, dtype=np.float64).reshape(-1, 2) for p in polylines]
+        if not arrays:
+            return np.zeros(0)
+        owner = np.repeat(np.arange(len(arrays)), [len(a) for a in arrays])
+        segments = self.segment_lengths(np.concatenate(arrays))
+        # 폴리라인 경계를 넘는 구간(앞 폴리라인의 끝 → 다음 첫 정점)은 버린다
+        inside = owner[:-1] == owner[1:]
+        return np.bincount(owner[:-1][inside], weights=segments[inside],
+                           minlength=len(arrays))
+
+    def area_perimeter(self, pixels) -> Tuple[float, float]:
+        """닫힌 다각형의 (면적, 둘레)를 반환합니다. 면적은 항상 양수입니다."""
+        pixels = np.asarray(pixels, dtype=np.float64).reshape(-1, 2)
+        if len(pixels) < 3:
+            # 면적이 없는 퇴화 다각형: 둘레는 왕복 길이
+            return (0.0, 2.0 * self.length(pixels))
+        if not self.geodesic:
+            return _planar_area_perimeter(self.pixel_to_ground(pixels))
+        lon, lat = self.pixel_to_lonlat(pixels)
+        area, perimeter = self._geod.polygon_area_perimeter(lon, lat)
+        return (abs(float(area)), float(perimeter))
+
+    def areas(self, polygons: Sequence) -> List[Tuple[float, float]]:
+        """여러 다각형의 (면적, 둘레)를 계산합니다 (좌표 변환은 한 번에 수행)."""
+        arrays = [np.asarray(p, dtype=np.float64).reshape(-1, 2) for p in polygons]
+        if not arrays:
+            return []
+        if not self.geodesic:
+            return [self.area_perimeter(a) for a in arrays]
+        lon, lat = self.pixel_to_lonlat(np.concatenate(arrays))
+        result = []
+        start = 0
+        for array in arrays:
+            end = start + len(array)
+            if len(array) < 3:
+                result.append(self.area_perimeter(array))
+            else:
+                area, perimeter = self._geod.polygon_area_perimeter(lon[start:end],
+                                                                    lat[start:end])
+                result.append((abs(float(area)), float(perimeter)))
+            start = end
+        return result
+
+    def live(self, closed: bool = False) -> "LiveMeasurement":
+        """고무줄(rubber-band) 측정을 위한 증분 측정 객체를 만듭니다."""
+        return LiveMeasurement(self, closed)
+
+
+class LiveMeasurement:
+    """정점을 하나씩 추가하며 매 프레임 길이/면적을 갱신하는 측정입니다.
+
+    확정된 정점의 경위도와 누적 길이를 보관하므로, 커서를 따라 움직이는
+    마지막 정점만 바뀔 때는 새 구간 하나만 계산합니다.
+
+    속성:
+        engine (MeasurementEngine): 사용하는 측정 엔진
+        closed (bool): 다각형(면적) 측정 여부
+    """
+
+    def __init__(self, engine: MeasurementEngine, closed: bool = False):
+        self.engine = engine
+        self.closed = closed
+        self._pixels = np.zeros((0, 2), dtype=np.float64)
+        self._cumulative = 0.0
+
+    @property
+    def vertices(self) -> np.ndarray:
+        """확정된 정점 (N, 2) 픽셀 좌표를 반환합니다."""
+        return self._pixels
+
+    def add_vertex(self, x: float, y: float) -> None:
+        """정점을 확정해 추가합니다."""
+        point = np.array([[x, y]], dtype=np.float64)
+        if len(self._pixels):
+            self._cumulative += self.engine.length(np.vstack([self._pixels[-1:], point]))
+        self._pixels = np.vstack([self._pixels, point])
+
+    def remove_last(self) -> None:
+        """마지막 정점을 취소합니다."""
+        if len(self._pixels) >= 2:
+            self._cumulative -= self.engine.length(self._pixels[-2:])
+        self._pixels = self._pixels[:-1]
+        if len(self._pixels) < 2:
+            self._cumulative = 0.0
+
+    def clear(self) -> None:
+        """모든 정점을 지웁니다."""
+        self._pixels = np.zeros((0, 2), dtype=np.float64)
+        self._cumulative = 0.0
+
+    def preview(self, cursor: Optional[Tuple[float, float]] = None) -> Tuple[float, float]:
+        """커서 위치를 임시 정점으로 포함한 (길이 또는 둘레, 면적)을 반환합니다.
+
+        Args:
+            cursor: 커서 픽셀 좌표. None이면 확정된 정점만 사용
+
+        Returns:
+            Tuple[float, float]: 열린 측정은 (길이, 0), 닫힌 측정은 (둘레, 면적)
+        """
+        pixels = self._pixels
+        length = self._cumulative
+        if cursor is not None:
+            point = np.array([cursor], dtype=np.float64)
+            if len(pixels):
+                length += self.engine.length(np.vstack([pixels[-1:], point]))
+            pixels = np.vstack([pixels, point])
+        if not self.closed:
+            return (length, 0.0)
+        area, perimeter = self.engine.area_perimeter(pixels)
+        return (perimeter, area)
+
+
+def _planar_area_perimeter(points: np.ndarray) -> Tuple[float, float]:
+    """평면 다각형의 (면적, 둘레)를 신발끈 공식으로 계산합니다."""
+    x, y = points[:, 0], points[:, 1]
+    area = 0.5 * abs(np.dot(x, np.roll(y, -1)) - np.dot(y, np.roll(x, -1)))
+    closed = np.vstack([points, points[:1]])
+    perimeter = np.hypot(*np.diff(closed, axis=0).T).sum()
+    return (float(area), float(perimeter))
+
+
+def format_length(value: float, units: str = "m") -> str:
+    """길이를 보기 좋은 문자열로 변환합니다 (미터는 km로 올림)."""
+    if units == "m" and value >= 1000.0:
+        return f"{value / 1000.0:,.3f} km"
+    return f"{value:,.2f} {units}"
+
+
+def format_area(value: float, units: str = "m") -> str:
+    """면적을 보기 좋은 문자열로 변환합니다 (제곱미터는 ha/km²로 올림)."""
+    if units == "m":
+        if value >= 1e6:
+            return f"{value / 1e6:,.3f} km²"
+        if value >= 1e4:
+            return f"{value / 1e4:,.2f} ha"
+        return f"{value:,.1f} m²"
+    return f"{value:,.2f} {units}²"
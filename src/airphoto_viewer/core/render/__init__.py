@@ -4,6 +4,12 @@
 이 모듈은 이미지 렌더링 및 표시 기능을 제공합니다.
 """
 
-from .viewer_engine import ImageViewer, main as run_viewer
+from ...utils.lazy_import import lazy_exports
+
+# 공개 이름은 처음 사용할 때 해당 하위 모듈만 가져온다 (시작 시간 단축)
+__getattr__, __dir__ = lazy_exports(__name__, {
+    'ImageViewer': '.viewer_engine',
+    'run_viewer': '.viewer_engine:main',
+})
 
 __all__ = ['ImageViewer', 'run_viewer']
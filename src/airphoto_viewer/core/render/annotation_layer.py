@@ -0,0 +1,444 @@
+"""
+대량의 주석/측정 도형을 그리는 오버레이 레이어 모듈입니다.
+
+도형은 R-트리(`IncrementalRTree`)에 경계로 색인됩니다. 타일 레이어와 같은
+방식으로 확대율 레벨마다 고정 화면 크기의 셀 이미지를 백그라운드 로더에서
+만들어 캐시합니다. 셀을 만들 때만 셀과 겹치는 도형을 질의해 레벨 허용
+오차(화면 반 픽셀)로 Douglas-Peucker 단순화 후 스타일별로 묶어 그리며,
+한 픽셀보다 작은 도형은 점으로 그립니다. 따라서 이동 시에는 보이는 셀
+이미지 몇 장만 그리면 되고 도형 수와 무관합니다. 아직 없는 셀은 캐시된 더
+거친 레벨 셀을 확대해 대신 그립니다. 도형이 바뀌면 그 경계와 겹치는 셀만
+무효화됩니다. 셀을 만드는 작업자 스레드는 세대마다 한 번 떠 둔 색인·경계·
+도형의 읽기 전용 스냅숏만 읽으므로, 메인 스레드의 편집과 경합하지 않습니다.
+"""
+
+import math
+from collections import OrderedDict
+from dataclasses import dataclass
+from typing import Dict, Iterable, List, Optional, Sequence, Tuple
+
+import cv2
+import numpy as np
+from PyQt6.QtCore import QPointF, QRectF, Qt, pyqtSignal
+from PyQt6.QtGui import QBrush, QColor, QImage, QPainter, QPen, QPolygonF
+from PyQt6.QtWidgets import QGraphicsItem, QGraphicsObject, QStyleOptionGraphicsItem
+
+from ...utils.spatial_index import IncrementalRTree, RTreeSnapshot
+from ..tile.background_loader import BackgroundLoader, get_shared_loader
+from ..tile.tile_cache import next_cache_token
+
+# 도형 종류
+KINDS = ('point', 'line', 'polygon')
+# 셀 레벨 범위 (음수는 확대 화면용)
+MIN_LEVEL = -8
+MAX_LEVEL = 30
+
+
+@dataclass
+class Annotation:
+    """주석 도형 하나입니다.
+
+    속성:
+        kind (str): 'point', 'line', 'polygon' 중 하나
+        coords (np.ndarray): (N, 2) 레벨 0 좌표 (float64)
+        style (str): 색상 이름 또는 '#rrggbb' (같은 스타일끼리 한 번에 그림)
+        label (str): 표시용 이름
+    """
+    kind: str
+    coords: np.ndarray
+    style: str = '#ffcc00'
+    label: str = ''
+
+    @property
+    def bounds(self) -> Tuple[float, float, float, float]:
+        """(x0, y0, x1, y1) 경계를 반환합니다."""
+        x0, y0 = self.coords.min(axis=0)
+        x1, y1 = self.coords.max(axis=0)
+        return (float(x0), float(y0), float(x1), float(y1))
+
+
+class _StyleBatch:
+    """스타일별 선, 다각형, 점 목록 묶음입니다."""
+
+    __slots__ = ('lines', 'polygons', 'points')
+
+    def __init__(self):
+        self.lines: Dict[str, List[QPolygonF]] = {}
+        self.polygons: Dict[str, List[QPolygonF]] = {}
+        self.points: Dict[str, List[QPointF]] = {}
+
+
+@dataclass(frozen=True, eq=False)
+class _Snapshot:
+    """작업자 스레드가 셀을 만들 때 읽는 한 세대의 도형 상태입니다."""
+    generation: int
+    index: RTreeSnapshot
+    boxes: np.ndarray
+    features: Tuple[Optional[Annotation], ...]
+
+
+class AnnotationLayer(QGraphicsObject):
+    """공간 색인과 셀 이미지 캐시를 사용하는 주석 오버레이 아이템입니다.
+
+    아이템 좌표계는 레벨 0 픽셀 좌표와 같습니다. 도형 ID는 추가 순서대로
+    부여되는 정수입니다.
+    """
+
+    # 셀 한 변의 화면 픽셀 수 (레벨 n에서 장면 좌표로는 CELL_PIXELS * 2^n, n은 음수 가능)
+    CELL_PIXELS = 512
+    # 작업자 스레드에서 셀 이미지가 준비되면 발생 (메인 스레드로 큐잉됨)
+    cell_ready = pyqtSignal(object, object)
+
+    def __init__(self, extent: Optional[QRectF] = None,
+                 loader: Optional[BackgroundLoader] = None, max_cells: int = 256,
+                 parent=None):
+        """AnnotationLayer 인스턴스를 초기화합니다.
+
+        Args:
+            extent: 기본 경계 (예: 영상 크기). 도형이 밖에 있으면 넓어짐
+            loader: 셀 이미지를 만들 백그라운드 로더. None인 경우 공유 로더 사용
+            max_cells: 캐시할 최대 셀 이미지 수 (셀 하나에 1MB)
+            parent: 부모 아이템
+        """
+        super().__init__(parent)
+        self._features: List[Optional[Annotation]] = []
+        self._boxes = np.zeros((0, 4), dtype=np.float64)
+        self._index = IncrementalRTree()
+        self._cells: "OrderedDict[Tuple[int, int, int], Optional[QImage]]" = OrderedDict()
+        self._max_cells = max_cells
+        self._pens: Dict[Tuple[str, float], QPen] = {}
+        self._bounds = QRectF(extent) if extent is not None else QRectF()
+        self.loader = loader or get_shared_loader()
+        self._layer_key = ("annotations", next_cache_token())
+        # 도형이 바뀔 때마다 증가해 진행 중이던 셀 요청 결과를 무효화한다
+        self._generation = 0
+        self._snapshot: Optional[_Snapshot] = None
+        self.setFlag(QGraphicsItem.GraphicsItemFlag.ItemUsesExtendedStyleOption, True)
+        self.setZValue(2)
+        self.cell_ready.connect(self._on_cell_ready)
+
+    def __len__(self) -> int:
+        return len(self._index)
+
+    def annotation(self, annotation_id: int) -> Optional[Annotation]:
+        """ID에 해당하는 도형을 반환합니다. 삭제되었으면 None"""
+        if 0 <= annotation_id < len(self._features):
+            return self._features[annotation_id]
+        return None
+
+    def add(self, kind: str, coords, style: str = '#ffcc00', label: str = '') -> int:
+        """도형을 추가합니다.
+
+        Args:
+            kind: 'point', 'line', 'polygon' 중 하나
+            coords: (N, 2) 레벨 0 좌표
+            style: 색상
+            label: 표시용 이름
+
+        Returns:
+            int: 도형 ID
+
+        Raises:
+            ValueError: 종류나 좌표가 잘못된 경우
+        """
+        return self.add_many(kind, [coords], style, [label])[0]
+
+    def add_many(self, kind: str, coords_list: Iterable, style: str = '#ffcc00',
+                 labels: Optional[Sequence[str]] = None) -> List[int]:
+        """같은 종류·스타일의 도형을 한꺼번에 추가합니다 (색인은 한 번만 갱신).
+
+        Returns:
+            List[int]: 추가된 도형 ID 목록
+
+        Raises:
+            ValueError: 종류나 좌표가 잘못된 경우
+        """
+        if kind not in KINDS:
+            raise ValueError(f"지원하지 않는 도형 종류입니다: {kind}")
+        features = []
+        for i, coords in enumerate(coords_list):
+            coords = np.asarray(coords, dtype=np.float64).reshape(-1, 2)
+            if not len(coords):
+                raise ValueError("좌표가 비어 있습니다.")
+            label = labels[i] if labels is not None else ''
+            features.append(Annotation(kind, coords, style, label))
+        return self._insert(features)
+
+    def _insert(self, features: List[Annotation],
+                ids: Optional[List[int]] = None) -> List[int]:
+        """도형을 저장하고 색인·경계·셀 캐시를 갱신합니다."""
+        if ids is None:
+            start = len(self._features)
+            ids = list(range(start, start + len(features)))
+            self._features.extend([None] * len(features))
+            grown = np.zeros((len(self._features), 4), dtype=np.float64)
+            grown[:len(self._boxes)] = self._boxes
+            self._boxes = grown
+        bounds = np.empty((len(features), 4), dtype=np.float64)
+        for row, (annotation_id, feature) in enumerate(zip(ids, features)):
+            self._features[annotation_id] = feature
+            bounds[row, :2] = feature.coords.min(axis=0)
+            bounds[row, 2:] = feature.coords.max(axis=0)
+        self._boxes[ids] = bounds
+        self._index.update_many(zip(ids, map(tuple, bounds)))
+        if len(ids) > IncrementalRTree.MIN_DELTA:
+            # 대량 추가는 델타로 두지 않고 바로 다시 적재한다
+            self._index.rebuild()
+        self._invalidate_cells(ids)
+
+        if len(bounds):
+            x0, y0 = bounds[:, :2].min(axis=0)
+            x1, y1 = bounds[:, 2:].max(axis=0)
+            united = self._bounds.united(QRectF(x0, y0, x1 - x0, y1 - y0))
+            if united != self._bounds:
+                self.prepareGeometryChange()
+                self._bounds = united
+        self.update()
+        return ids
+
+    def update_annotation(self, annotation_id: int, coords) -> None:
+        """도형의 좌표를 바꿉니다 (편집 도구용)."""
+        feature = self.annotation(annotation_id)
+        if feature is None:
+            return
+        self._invalidate_cells([annotation_id])
+        coords = np.asarray(coords, dtype=np.float64).reshape(-1, 2)
+        self._insert([Annotation(feature.kind, coords, feature.style, feature.label)],
+                     [annotation_id])
+
+    def remove(self, annotation_id: int) -> None:
+        """도형을 삭제합니다. 없는 ID는 무시합니다."""
+        if self.annotation(annotation_id) is None:
+            return
+        self._invalidate_cells([annotation_id])
+        self._features[annotation_id] = None
+        self._index.remove(annotation_id)
+        self.update()
+
+    def clear(self) -> None:
+        """모든 도형을 삭제합니다."""
+        self._features = []
+        self._boxes = np.zeros((0, 4), dtype=np.float64)
+        self._index = IncrementalRTree()
+        self._generation += 1
+        self._snapshot = None
+        self._cells.clear()
+        self.update()
+
+    def release_cache(self) -> None:
+        """만들어 둔 셀 이미지와 대기 중인 셀 요청을 모두 해제합니다 (백그라운드 탭용)."""
+        prefix = self._layer_key
+        self.loader.cancel_pending_requests(
+            lambda key: isinstance(key, tuple) and key[0] == prefix)
+        self._cells.clear()
+        self._snapshot = None
+
+    def features_in_rect(self, rect: QRectF) -> np.ndarray:
+        """사각형(레벨 0 좌표)과 경계가 겹치는 도형 ID를 반환합니다."""
+        return self._index.query(rect.left(), rect.top(), rect.right(), rect.bottom())
+
+    def features_at(self, x: float, y: float, tolerance: float = 0.0) -> np.ndarray:
+        """점 주변 tolerance 안에 경계가 걸치는 도형 ID를 반환합니다 (선택 도구용)."""
+        return self._index.query(x - tolerance, y - tolerance, x + tolerance, y + tolerance)
+
+    def boundingRect(self) -> QRectF:
+        return self._bounds
+
+    @staticmethod
+    def level_for_scale(scale: float) -> int:
+        """화면 확대율에 맞는 셀 레벨을 반환합니다.
+
+        확대 화면에서는 음수 레벨(셀 이미지가 레벨 0보다 촘촘함)을 사용해
+        선이 흐려지지 않게 합니다.
+        """
+        if scale <= 0:
+            return MAX_LEVEL
+        return max(MIN_LEVEL, min(MAX_LEVEL, int(math.floor(math.log2(1.0 / scale)))))
+
+    def _span(self, level: int) -> float:
+        """레벨 셀 한 변의 장면 좌표 길이를 반환합니다."""
+        return self.CELL_PIXELS * 2.0 ** level
+
+    def paint(self, painter: QPainter, option: QStyleOptionGraphicsItem, widget=None) -> None:
+        scale = QStyleOptionGraphicsItem.levelOfDetailFromTransform(painter.worldTransform())
+        exposed = option.exposedRect.intersected(self._bounds)
+        # render() 등에서는 노출 영역이 아이템 전체일 수 있으므로 장치 영역으로도 자른다
+        inverse, invertible = painter.worldTransform().inverted()
+        if invertible:
+            exposed = exposed.intersected(inverse.mapRect(QRectF(painter.viewport())))
+        if exposed.isEmpty() or not len(self._index):
+            return
+
+        level = self.level_for_scale(scale)
+        span = self._span(level)
+        c0, r0 = int(exposed.left() // span), int(exposed.top() // span)
+        c1, r1 = int(exposed.right() // span), int(exposed.bottom() // span)
+        center = exposed.center()
+        wanted = set()
+        for row in range(r0, r1 + 1):
+            for col in range(c0, c1 + 1):
+                cell = (level, col, row)
+                target = QRectF(col * span, row * span, span, span)
+                if cell in self._cells:
+                    self._cells.move_to_end(cell)
+                    if self._cells[cell] is not None:
+                        painter.drawImage(target, self._cells[cell])
+                    continue
+                wanted.add(self._request_key(cell))
+                self._request(cell, math.hypot(target.center().x() - center.x(),
+                                               target.center().y() - center.y()))
+                self._paint_fallback(painter, cell, target)
+
+        # 화면에서 벗어난 같은 레벨의 대기 요청은 취소한다
+        prefix = self._layer_key
+        self.loader.cancel_pending_requests(
+            lambda key: isinstance(key, tuple) and key[0] == prefix
+            and key[2] == level and key not in wanted)
+
+    def _request_key(self, cell: Tuple[int, int, int]) -> Tuple:
+        """셀 요청 키 (레이어, 세대, 레벨, 열, 행)를 반환합니다."""
+        return (self._layer_key, self._generation) + cell
+
+    def _request(self, cell: Tuple[int, int, int], priority: float) -> None:
+        """셀 이미지 생성을 현재 세대의 스냅숏으로 백그라운드 로더에 요청합니다."""
+        level, col, row = cell
+        snapshot = self._current_snapshot()
+        self.loader.queue_tile_load(
+            self._request_key(cell), lambda: self._build_cell(snapshot, level, col, row),
+            priority, lambda key, image: self.cell_ready.emit(key, image))
+
+    def _current_snapshot(self) -> _Snapshot:
+        """현재 세대의 읽기 전용 스냅숏을 반환합니다 (세대가 바뀐 뒤 처음 요청할 때 만듦)."""
+        snapshot = self._snapshot
+        if snapshot is None or snapshot.generation != self._generation:
+            # 경계 배열과 도형 목록은 편집 시 제자리에서 바뀌므로 복사한다
+            snapshot = _Snapshot(self._generation, self._index.snapshot(),
+                                 self._boxes.copy(), tuple(self._features))
+            self._snapshot = snapshot
+        return snapshot
+
+    def _paint_fallback(self, painter: QPainter, cell: Tuple[int, int, int],
+                        target: QRectF) -> None:
+        """캐시에 있는 더 거친 레벨 셀의 일부를 확대해 대신 그립니다."""
+        level, col, row = cell
+        for up in range(1, 5):
+            ancestor = (level + up, col >> up, row >> up)
+            if ancestor not in self._cells:
+                continue
+            image = self._cells[ancestor]
+            if image is not None:
+                span = self._span(ancestor[0])
+                s = 2.0 ** ancestor[0]
+                src = QRectF((target.x() - ancestor[1] * span) / s,
+                             (target.y() - ancestor[2] * span) / s,
+                             target.width() / s, target.height() / s)
+                painter.drawImage(target, image, src)
+            return
+
+    def _on_cell_ready(self, key: Tuple, image: Optional[QImage]) -> None:
+        """메인 스레드에서 도착한 셀 이미지를 캐시에 넣고 다시 그립니다.
+
+        요청 이후 도형이 바뀌었으면(세대가 다르면) 버리고 다음 그리기에서 다시 요청합니다.
+        """
+        if key[0] != self._layer_key or key[1] != self._generation:
+            self.update()
+            return
+        cell = key[2:]
+        self._cells[cell] = image
+        while len(self._cells) > self._max_cells:
+            self._cells.popitem(last=False)
+        span = self._span(cell[0])
+        self.update(QRectF(cell[1] * span, cell[2] * span, span, span))
+
+    def _pen(self, style: str, width: float) -> QPen:
+        """스타일별 화면 고정 두께 펜을 반환합니다."""
+        pen = self._pens.get((style, width))
+        if pen is None:
+            pen = QPen(QColor(style), width)
+            pen.setCosmetic(True)
+            pen.setCapStyle(Qt.PenCapStyle.RoundCap)
+            self._pens[(style, width)] = pen
+        return pen
+
+    def _paint_batch(self, painter: QPainter, batch: _StyleBatch) -> None:
+        """묶음을 스타일별로 펜/브러시를 한 번만 바꿔 그립니다.
+
+        큰 QPainterPath 하나로 합치면 스트로크 계산이 도형 수에 비해 급격히
+        느려지므로 도형마다 drawPolyline/drawPolygon을 호출합니다.
+        """
+        painter.setBrush(Qt.BrushStyle.NoBrush)
+        for style, polylines in batch.lines.items():
+            painter.setPen(self._pen(style, 1.5))
+            for polyline in polylines:
+                painter.drawPolyline(polyline)
+        for style, polygons in batch.polygons.items():
+            fill = QColor(style)
+            fill.setAlpha(50)
+            painter.setPen(self._pen(style, 1.5))
+            painter.setBrush(QBrush(fill))
+            for polygon in polygons:
+                painter.drawPolygon(polygon)
+        painter.setBrush(Qt.BrushStyle.NoBrush)
+        for style, points in batch.points.items():
+            painter.setPen(self._pen(style, 5.0))
+            painter.drawPoints(QPolygonF(points))
+
+    def _batch(self, snapshot: _Snapshot, ids: np.ndarray, tolerance: float) -> _StyleBatch:
+        """도형들을 허용 오차로 단순화해 스타일별로 묶습니다 (ID 순서로 그림)."""
+        batch = _StyleBatch()
+        for annotation_id in np.sort(ids).tolist():
+            feature = snapshot.features[annotation_id]
+            if feature is None:
+                continue
+            coords = feature.coords
+            x0, y0, x1, y1 = snapshot.boxes[annotation_id].tolist()
+            if feature.kind == 'point' or max(x1 - x0, y1 - y0) < 2 * tolerance:
+                # 한 픽셀보다 작은 도형은 점으로 그린다
+                batch.points.setdefault(feature.style, []).append(
+                    QPointF((x0 + x1) / 2, (y0 + y1) / 2))
+                continue
+            closed = feature.kind == 'polygon'
+            if len(coords) > 2 and tolerance >= 1.0:
+                coords = cv2.approxPolyDP(coords.astype(np.float32).reshape(-1, 1, 2),
+                                          tolerance, closed).reshape(-1, 2)
+            polygon = QPolygonF([QPointF(x, y) for x, y in coords.tolist()])
+            groups = batch.polygons if closed else batch.lines
+            groups.setdefault(feature.style, []).append(polygon)
+        return batch
+
+    def _build_cell(self, snapshot: _Snapshot, level: int, col: int,
+                    row: int) -> Optional[QImage]:
+        """셀과 겹치는 도형을 레벨 해상도의 투명 이미지로 그립니다. 비어 있으면 None
+
+        작업자 스레드에서 실행되므로 레이어의 색인·경계·도형 대신 스냅숏만 읽습니다.
+        """
+        span = self._span(level)
+        x0, y0 = col * span, row * span
+        ids = snapshot.index.query(x0, y0, x0 + span, y0 + span)
+        if not len(ids):
+            return None
+        image = QImage(self.CELL_PIXELS, self.CELL_PIXELS,
+                       QImage.Format.Format_ARGB32_Premultiplied)
+        image.fill(Qt.GlobalColor.transparent)
+        painter = QPainter(image)
+        painter.setRenderHint(QPainter.RenderHint.Antialiasing, True)
+        painter.scale(2.0 ** -level, 2.0 ** -level)
+        painter.translate(-x0, -y0)
+        self._paint_batch(painter, self._batch(snapshot, ids, 0.5 * 2.0 ** level))
+        painter.end()
+        return image
+
+    def _invalidate_cells(self, ids: Sequence[int]) -> None:
+        """도형 경계와 겹치는 (모든 레벨의) 캐시 셀을 무효화합니다."""
+        self._generation += 1
+        if not self._cells or not len(ids):
+            return
+        bounds = self._boxes[list(ids)]
+        x0, y0 = bounds[:, :2].min(axis=0)
+        x1, y1 = bounds[:, 2:].max(axis=0)
+        for key in list(self._cells):
+            level, col, row = key
+            span = self._span(level)
+            if col * span <= x1 and (col + 1) * span >= x0 and \
+                    row * span <= y1 and (row + 1) * span >= y0:
+                del self._cells[key]
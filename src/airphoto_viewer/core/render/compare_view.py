@@ -0,0 +1,95 @@
+"""
+두 영상 비교(나란히 보기 / 스와이프)를 위한 보조 모듈입니다.
+
+비교 대상 영상도 `TiledImageItem`으로 그려지므로 공유 타일 캐시와
+백그라운드 로더를 함께 사용하며, 두 번째 영상은 화면에 보이는 타일만큼만
+비용이 듭니다.
+"""
+
+from PyQt6.QtCore import QObject, QRectF, Qt
+from PyQt6.QtGui import QPen
+from PyQt6.QtWidgets import QGraphicsItem, QGraphicsRectItem, QGraphicsView
+
+
+class ViewLink(QObject):
+    """두 QGraphicsView의 변환과 스크롤 위치를 동기화합니다.
+
+    어느 쪽 뷰에서 스크롤하든 다른 쪽이 같은 장면 지점을 중심으로 따라가며,
+    확대/축소 후에는 `sync()`를 호출하여 변환을 복사합니다.
+
+    속성:
+        primary (QGraphicsView): 기준 뷰
+        secondary (QGraphicsView): 따라가는 뷰
+    """
+
+    def __init__(self, primary: QGraphicsView, secondary: QGraphicsView, parent=None):
+        """ViewLink 인스턴스를 초기화합니다.
+
+        Args:
+            primary: 기준 뷰
+            secondary: 따라가는 뷰
+            parent: 부모 QObject
+        """
+        super().__init__(parent)
+        self.primary = primary
+        self.secondary = secondary
+        self._syncing = False
+        for source, target in ((primary, secondary), (secondary, primary)):
+            for bar in (source.horizontalScrollBar(), source.verticalScrollBar()):
+                bar.valueChanged.connect(
+                    lambda _value, s=source, t=target: self._follow(s, t))
+
+    def sync(self) -> None:
+        """기준 뷰의 변환과 화면 중심을 따라가는 뷰에 복사합니다."""
+        if self._syncing:
+            return
+        self._syncing = True
+        try:
+            self.secondary.setTransform(self.primary.transform())
+        finally:
+            self._syncing = False
+        self._follow(self.primary, self.secondary)
+
+    def _follow(self, source: QGraphicsView, target: QGraphicsView) -> None:
+        """target 뷰가 source 뷰와 같은 장면 지점을 중심에 두도록 합니다.
+
+        두 뷰의 크기가 다를 수 있으므로 스크롤 값 대신 장면 좌표로 맞춥니다.
+        """
+        if self._syncing or not target.isVisible():
+            return
+        self._syncing = True
+        try:
+            center = source.mapToScene(source.viewport().rect().center())
+            target.centerOn(center)
+        finally:
+            self._syncing = False
+
+
+class SwipeClipItem(QGraphicsRectItem):
+    """자식 아이템을 왼쪽 일부만 보이도록 잘라내는 스와이프용 컨테이너입니다.
+
+    비교 영상 아이템을 자식으로 넣고 `set_position()`으로 경계 위치를 바꿉니다.
+    경계선은 화면 배율과 무관하게 1픽셀 두께로 그려집니다.
+    """
+
+    def __init__(self, width: float, height: float, parent=None):
+        """SwipeClipItem 인스턴스를 초기화합니다.
+
+        Args:
+            width: 비교 영역 전체 너비 (장면 좌표)
+            height: 비교 영역 전체 높이 (장면 좌표)
+            parent: 부모 아이템
+        """
+        super().__init__(0, 0, width, height, parent)
+        self._full = QRectF(0, 0, width, height)
+        self.setFlag(QGraphicsItem.GraphicsItemFlag.ItemClipsChildrenToShape, True)
+        pen = QPen(Qt.GlobalColor.yellow)
+        pen.setCosmetic(True)
+        self.setPen(pen)
+        self.setZValue(1)
+        self.set_position(0.5)
+
+    def set_position(self, fraction: float) -> None:
+        """스와이프 경계를 전체 너비 대비 비율(0.0 ~ 1.0)로 설정합니다."""
+        fraction = min(max(fraction, 0.0), 1.0)
+        self.setRect(QRectF(0, 0, self._full.width() * fraction, self._full.height()))
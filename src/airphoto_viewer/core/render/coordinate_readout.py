@@ -0,0 +1,70 @@
+"""
+커서 위치의 좌표를 상태 표시줄에 보여주는 모듈입니다.
+
+마우스 이동 이벤트마다 하는 일은 뷰포트 좌표를 저장하고 프레임 타이머를
+켜는 것뿐입니다. 장면 좌표 변환, 좌표계 변환, 문자열 생성은 타이머가
+만료될 때(한 프레임에 최대 한 번) 마지막 커서 위치로 한 번만 수행합니다.
+"""
+
+from typing import Optional
+
+from PyQt6.QtCore import QEvent, QObject, QPointF, QTimer, pyqtSignal
+from PyQt6.QtWidgets import QGraphicsView
+
+from ..measure.coordinates import CoordinateConverter
+
+# 좌표 표시 갱신 간격 (60Hz 한 프레임)
+FRAME_INTERVAL_MS = 16
+
+
+class CoordinateReadout(QObject):
+    """그래픽 뷰의 커서 좌표를 프레임 단위로 묶어 알립니다.
+
+    속성:
+        view (QGraphicsView): 커서를 추적할 뷰
+        converter (CoordinateConverter): 픽셀 → 지상 좌표 변환기
+    """
+
+    # 표시할 좌표 문자열 (커서가 영상을 벗어나면 빈 문자열)
+    text_changed = pyqtSignal(str)
+
+    def __init__(self, view: QGraphicsView, parent=None):
+        super().__init__(parent)
+        self.view = view
+        self.converter = CoordinateConverter()
+        self._position: Optional[QPointF] = None
+        self._timer = QTimer(self)
+        self._timer.setSingleShot(True)
+        self._timer.setInterval(FRAME_INTERVAL_MS)
+        self._timer.timeout.connect(self._flush)
+        view.viewport().setMouseTracking(True)
+        view.viewport().installEventFilter(self)
+
+    def set_converter(self, converter: CoordinateConverter) -> None:
+        """새 영상의 좌표 변환기를 설정합니다."""
+        self.converter = converter
+
+    def eventFilter(self, obj, event) -> bool:
+        """마우스 이동은 위치만 기록하고, 다음 프레임에 한 번 갱신합니다."""
+        kind = event.type()
+        if kind == QEvent.Type.MouseMove:
+            self._position = event.position()
+            if not self._timer.isActive():
+                self._timer.start()
+        elif kind == QEvent.Type.Leave:
+            self._position = None
+            if not self._timer.isActive():
+                self._timer.start()
+        return False
+
+    def _flush(self) -> None:
+        """마지막 커서 위치의 좌표 문자열을 알립니다."""
+        if self._position is None:
+            self.text_changed.emit("")
+            return
+        point = self.view.mapToScene(self._position.toPoint())
+        rect = self.view.sceneRect()
+        if not rect.contains(point):
+            self.text_changed.emit("")
+            return
+        self.text_changed.emit(self.converter.format(point.x(), point.y()))
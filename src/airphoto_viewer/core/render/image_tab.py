@@ -0,0 +1,883 @@
+"""
+뷰어 탭 하나에 해당하는 이미지 문서 위젯 모듈입니다.
+
+각 탭은 자신의 피라미드, 필터 파이프라인, 그래픽 뷰, 비교 영상을 가지며,
+타일 캐시·백그라운드 로더(디코더 풀)는 모든 탭이 공유합니다. 백그라운드로
+전환된 탭은 화면 타일 고정을 풀고 원본 픽셀을 해제하며, 가장 거친 개요
+타일만 고정해 두어 다시 선택하면 캐시된 거친 레벨로 즉시 복원됩니다.
+열린 영상 파일은 감시(Linux에서는 inotify)하며, 파일이 다시 쓰이면 바뀐
+타일/스트립 영역의 캐시만 무효화하고 확대·필터·주석 상태는 그대로 둡니다.
+"""
+
+import os
+import threading
+from dataclasses import dataclass
+from typing import List, Optional, Tuple
+
+from PyQt6.QtCore import QFileSystemWatcher, QPoint, QRectF, Qt, QTimer, pyqtSignal
+from PyQt6.QtGui import QPainter
+from PyQt6.QtWidgets import (QGraphicsScene, QGraphicsView, QInputDialog, QSlider,
+                             QSplitter, QVBoxLayout, QWidget)
+
+from ..image.file_changes import (TiffBlocks, changed_block_indices, changed_pixels,
+                                  patch_blocks, read_tiff_blocks)
+from ..image.image_data import ImageData
+from ..image.thumbnails import get_shared_thumbnail_database
+from ..measure.coordinates import CoordinateConverter
+from ..tile.band_composite import BandCompositeSource, BandIndexSource, BandStretch
+from ..tile.cog_writer import write_cog
+from ..tile.decode_pool import get_shared_decode_pool
+from ..tile.filter_pipeline import FilterPipeline
+from ..tile.mosaic import MOSAIC_EXTENSIONS, MosaicSource
+from ..tile.pyramid import ImagePyramid
+from ..tile.region_export import export_region
+from ..tile.reproject import ReprojectedSource
+from ..tile.tile_source import TileSource
+from .annotation_layer import AnnotationLayer
+from .compare_view import SwipeClipItem, ViewLink
+from .coordinate_readout import CoordinateReadout
+from .tile_layer import TiledImageItem
+
+
+@dataclass
+class ImageViewerState:
+    """이미지 뷰어의 현재 상태를 저장하는 데이터 클래스"""
+    scale_factor: float = 1.0
+    rotation: float = 0.0
+    is_flipped_h: bool = False
+    is_flipped_v: bool = False
+    last_mouse_pos: Optional[QPoint] = None
+
+
+@dataclass
+class ReloadResult:
+    """다시 쓰인 원본 파일을 백그라운드에서 읽은 결과입니다.
+
+    속성:
+        generation (int): 감시를 시작한 시점의 세대 (다른 영상을 열면 무시됨)
+        blocks (Optional[TiffBlocks]): 새 파일의 TIFF 블록 서명
+        image_data (Optional[ImageData]): 다시 읽은 이미지 (바뀐 것이 없으면 None)
+        rects (Optional[List[Tuple[int, int, int, int]]]): 바뀐 영역. None이면 전체
+        error (Optional[str]): 읽기 실패 메시지
+        stat (Optional[os.stat_result]): 블록 서명을 읽기 직전의 파일 상태
+    """
+    generation: int
+    blocks: Optional[TiffBlocks] = None
+    image_data: Optional[ImageData] = None
+    rects: Optional[List[Tuple[int, int, int, int]]] = None
+    error: Optional[str] = None
+    stat: Optional[os.stat_result] = None
+
+
+def create_view(scene: QGraphicsScene) -> QGraphicsView:
+    """공통 설정이 적용된 그래픽 뷰를 생성합니다.
+
+    Args:
+        scene: 뷰가 표시할 씬
+    """
+    view = QGraphicsView(scene)
+    view.setRenderHint(QPainter.RenderHint.SmoothPixmapTransform)
+    view.setDragMode(QGraphicsView.DragMode.ScrollHandDrag)
+    view.setTransformationAnchor(QGraphicsView.ViewportAnchor.AnchorUnderMouse)
+    view.setResizeAnchor(QGraphicsView.ViewportAnchor.AnchorUnderMouse)
+    view.setHorizontalScrollBarPolicy(Qt.ScrollBarPolicy.ScrollBarAsNeeded)
+    view.setVerticalScrollBarPolicy(Qt.ScrollBarPolicy.ScrollBarAsNeeded)
+    view.setFrameShape(QGraphicsView.Shape.NoFrame)
+    return view
+
+
+class ImageTab(QWidget):
+    """이미지 하나와 그 비교 영상을 표시하는 탭 위젯입니다.
+
+    속성:
+        file_path (Optional[str]): 표시 중인 이미지 경로
+        state (ImageViewerState): 확대율/회전 상태
+        image_data (Optional[ImageData]): 원본 이미지 데이터 (모자이크는 None)
+        pyramid (Optional[TileSource]): 표시 기준 타일 소스 (피라미드, 모자이크 또는 재투영)
+        filter_pipeline (Optional[FilterPipeline]): 표시용 파이프라인
+        image_item (Optional[TiledImageItem]): 타일 아이템
+        annotation_layer (Optional[AnnotationLayer]): 주석/측정 오버레이
+        coordinate_readout (CoordinateReadout): 커서 좌표 표시
+    """
+
+    # 상태 표시줄에 보여줄 메시지
+    status_message = pyqtSignal(str)
+    # 표시 파이프라인이 바뀜 (미니맵 갱신용)
+    pipeline_changed = pyqtSignal()
+    # 뷰포트(스크롤/확대)가 바뀜
+    viewport_changed = pyqtSignal()
+    # 원본 파일 다시 읽기 완료 (작업자 스레드 → 메인 스레드)
+    _reload_ready = pyqtSignal(object)
+
+    # 파일 변경 알림 후 다시 읽기까지 기다리는 시간 (쓰기가 끝나기를 기다림)
+    RELOAD_DELAY_MS = 300
+
+    def __init__(self, parent=None):
+        super().__init__(parent)
+        self.file_path: Optional[str] = None
+        self.state = ImageViewerState()
+        self.image_data = None
+        self.pyramid = None
+        self.band_sources = {}
+        self.band_stretch = None
+        self.filter_pipeline = None
+        self.adjustments = []
+        self.filters = []
+        self.image_item = None
+        self.annotation_layer = None
+        self._unprojected = None
+        self.active = True
+
+        # 비교 영상 상태 ('off', 'side', 'swipe')
+        self.compare_mode = 'off'
+        self.compare_data = None
+        self.compare_pipeline = None
+        self.compare_item = None
+        self.swipe_clip = None
+
+        # 원본 파일 감시 상태
+        self._watcher = QFileSystemWatcher(self)
+        self._watcher.fileChanged.connect(self._on_file_changed)
+        self._reload_timer = QTimer(self)
+        self._reload_timer.setSingleShot(True)
+        self._reload_timer.setInterval(self.RELOAD_DELAY_MS)
+        self._reload_timer.timeout.connect(self._start_reload)
+        self._reload_ready.connect(self._apply_reload)
+        self._watch_generation = 0
+        self._file_blocks: Optional[TiffBlocks] = None
+        self._file_stat: Optional[os.stat_result] = None
+        self._reloading = False
+
+        self.init_ui()
+
+    def init_ui(self):
+        """탭 내부 위젯 초기화"""
+        # 그래픽 뷰와 씬 설정
+        self.scene = QGraphicsScene(self)
+        self.view = create_view(self.scene)
+        self.coordinate_readout = CoordinateReadout(self.view, self)
+
+        # 나란히 비교용 두 번째 뷰 (평소에는 숨김)
+        self.compare_scene = QGraphicsScene(self)
+        self.compare_view = create_view(self.compare_scene)
+        self.compare_view.hide()
+        self.view_link = ViewLink(self.view, self.compare_view, self)
+
+        self.splitter = QSplitter(Qt.Orientation.Horizontal)
+        self.splitter.addWidget(self.view)
+        self.splitter.addWidget(self.compare_view)
+
+        # 스와이프 경계 슬라이더 (스와이프 비교 시에만 표시)
+        self.swipe_slider = QSlider(Qt.Orientation.Horizontal)
+        self.swipe_slider.setRange(0, 1000)
+        self.swipe_slider.setValue(500)
+        self.swipe_slider.valueChanged.connect(self.set_swipe_position)
+        self.swipe_slider.hide()
+
+        # 레이아웃 설정
+        layout = QVBoxLayout(self)
+        layout.setContentsMargins(0, 0, 0, 0)
+        layout.addWidget(self.splitter)
+        layout.addWidget(self.swipe_slider)
+
+        for bar in (self.view.horizontalScrollBar(), self.view.verticalScrollBar()):
+            bar.valueChanged.connect(self._on_scrolled)
+            bar.rangeChanged.connect(self._on_scrolled)
+
+    @property
+    def title(self) -> str:
+        """탭 제목 (파일 이름)을 반환합니다."""
+        return os.path.basename(self.file_path) if self.file_path else "새 탭"
+
+    def load_image(self, file_path: str) -> None:
+        """이미지 파일 또는 모자이크 매니페스트를 로드하여 표시합니다.
+
+        확장자가 .json/.yaml/.yml이면 가상 모자이크로 엽니다.
+
+        Args:
+            file_path: 이미지 파일 또는 매니페스트 경로
+
+        Raises:
+            FileNotFoundError: 파일이 존재하지 않는 경우
+            IOError: 이미지 로딩에 실패한 경우
+            ValueError: 매니페스트 형식이 잘못된 경우
+        """
+        # 원본 타일 소스 생성 (모자이크는 프레임 헤더만 읽음)
+        image_data = None
+        blocks, stat = None, None
+        if os.path.splitext(file_path)[1].lower() in MOSAIC_EXTENSIONS:
+            source = MosaicSource.from_manifest(file_path,
+                                                decode_pool=get_shared_decode_pool(),
+                                                thumbnails=get_shared_thumbnail_database())
+        else:
+            # 변경 비교 기준은 디코딩 전에 읽는다. 그 사이 다시 쓰인 블록은
+            # 기준과 달라 다음 다시 읽기에서 바뀐 것으로 잡힌다
+            stat = os.stat(file_path)
+            blocks = read_tiff_blocks(file_path)
+            image_data = ImageData()
+            image_data.load(file_path)
+            source = ImagePyramid(image_data)
+
+        # 기존 씬 정리 (비교 영상도 함께 해제)
+        self.release()
+        self.set_compare_mode('off')
+        self.compare_data = None
+        self.compare_pipeline = None
+        self.scene.clear()
+
+        self.file_path = file_path
+        self.image_data = image_data
+        self._unprojected = source
+        self._show_source(source)
+        if image_data is not None:
+            self._watch(file_path, blocks, stat)
+
+        # 커서 좌표 변환기 (변환기 생성 비용은 로드 시 한 번만 지불)
+        self.coordinate_readout.set_converter(self._coordinate_converter(image_data))
+
+        self.pipeline_changed.emit()
+        self.status_message.emit(f"로드 완료: {os.path.basename(file_path)} "
+                                 f"({source.width}x{source.height})")
+
+        # 창에 맞게 조정
+        self.fit_to_window()
+
+    def _show_source(self, source: TileSource) -> None:
+        """원본 타일 소스로 파이프라인, 타일 아이템, 오버레이를 새로 구성합니다."""
+        # 필터 파이프라인 구성 (타일은 화면에 보일 때 계산됨)
+        self.pyramid = source
+        self.band_sources = {}
+        self.band_stretch = None
+        display_source = self.pyramid
+        if self.pyramid.channels > 4:
+            # 다중분광 영상은 앞의 세 밴드를 (B, G, R) 순서로 보고 기본 합성한다
+            display_source = self.band_source("composite", (2, 1, 0))
+        self.filter_pipeline = FilterPipeline(display_source,
+                                              self.adjustments + self.filters)
+
+        # 타일 아이템 생성 및 추가
+        self.image_item = TiledImageItem(self.filter_pipeline)
+        self.image_item.pin_overview()
+        self.scene.addItem(self.image_item)
+        self.scene.setSceneRect(self.image_item.boundingRect())
+
+        # 주석/측정 오버레이 (타일 위에 그려짐)
+        self.annotation_layer = AnnotationLayer(self.image_item.boundingRect())
+        self.scene.addItem(self.annotation_layer)
+
+        # 뷰 리셋
+        self.view.resetTransform()
+        self.state.scale_factor = 1.0
+        self.state.rotation = 0.0
+
+    def reproject(self, target_crs: Optional[str] = None) -> None:
+        """표시 좌표계를 바꿉니다. 화면에 보이는 타일만 재투영됩니다.
+
+        재투영된 격자는 픽셀 좌표가 달라지므로 비교 영상과 주석은 해제됩니다.
+
+        Args:
+            target_crs: 대상 좌표계 (예: 'EPSG:4326'). None이면 원본 격자로 되돌림
+        """
+        if self._unprojected is None:
+            return
+        metadata = self.image_data.metadata if self.image_data is not None else None
+        if target_crs is None:
+            source = self._unprojected
+            converter = self._coordinate_converter(self.image_data)
+        else:
+            if metadata is None or metadata.geotransform is None or not metadata.crs:
+                self.status_message.emit("오류: 지리참조가 없는 영상은 재투영할 수 없습니다.")
+                return
+            try:
+                source = ReprojectedSource(self._unprojected, metadata.geotransform,
+                                           metadata.crs, target_crs)
+                converter = CoordinateConverter(source.geotransform, target_crs)
+            except Exception as e:
+                self.status_message.emit(f"오류: {str(e)}")
+                return
+
+        blocks, stat = self._file_blocks, self._file_stat
+        self.release()
+        self.set_compare_mode('off')
+        self.compare_data = None
+        self.compare_pipeline = None
+        self.scene.clear()
+        self._show_source(source)
+        if self.image_data is not None:
+            # 같은 픽셀을 계속 보므로 로드 때의 비교 기준을 이어 쓴다
+            self._watch(self.file_path, blocks, stat)
+        self.coordinate_readout.set_converter(converter)
+        self.pipeline_changed.emit()
+        self.status_message.emit(f"좌표계: {target_crs or '원본'} ({source.width}x{source.height})")
+        self.fit_to_window()
+
+    def _coordinate_converter(self, image_data: Optional[ImageData]) -> CoordinateConverter:
+        """영상 메타데이터의 지리참조로 좌표 변환기를 만듭니다."""
+        if image_data is None:
+            return CoordinateConverter()
+        metadata = image_data.metadata
+        try:
+            return CoordinateConverter(metadata.geotransform, metadata.crs)
+        except Exception:
+            # 해석할 수 없는 좌표계는 투영 좌표만 표시한다
+            return CoordinateConverter(metadata.geotransform)
+
+    def activate(self) -> None:
+        """탭이 화면에 표시될 때 호출됩니다.
+
+        해제된 원본 픽셀은 첫 타일 요청 시 작업자 스레드에서 다시 읽히며,
+        그동안에는 캐시에 남아 있는 거친 레벨 타일이 대신 그려집니다.
+        """
+        self.active = True
+        if self.image_item is not None:
+            self.image_item.update()
+            self._pin_visible()
+
+    def deactivate(self) -> None:
+        """탭이 백그라운드로 전환될 때 호출됩니다.
+
+        화면 타일 고정과 대기 중인 요청을 해제하고, 원본 픽셀과 축소 레벨
+        배열을 메모리에서 내립니다. 개요 타일 고정은 유지됩니다.
+        """
+        self.active = False
+        for item in (self.image_item, self.compare_item):
+            if item is not None:
+                item.release_visible()
+        for pyramid in (self.pyramid, self._compare_pyramid()):
+            if pyramid is not None:
+                pyramid.release()
+        if self.annotation_layer is not None:
+            self.annotation_layer.release_cache()
+
+    def release(self) -> None:
+        """탭을 닫거나 다른 이미지를 열 때 모든 고정과 캐시 타일을 해제합니다."""
+        for item in (self.image_item, self.compare_item):
+            if item is not None:
+                item.release_visible()
+                item.unpin_overview()
+        for pyramid in {self.pyramid, self._unprojected, self._compare_pyramid()}:
+            if pyramid is not None:
+                pyramid.cache.invalidate_source(pyramid.cache_key)
+        self._unwatch()
+
+    def _watch(self, path: str, blocks: Optional[TiffBlocks],
+               stat: Optional[os.stat_result]) -> None:
+        """원본 파일 감시를 시작합니다.
+
+        Args:
+            path: 원본 파일 경로
+            blocks: 로드 직전에 읽은 블록 서명 (비교 기준)
+            stat: 로드 직전의 파일 상태. 감시 시작 전에 파일이 바뀌었으면 바로 다시 읽는다
+        """
+        self._unwatch()
+        self._watcher.addPath(path)
+        self._file_blocks = blocks
+        self._file_stat = stat
+        try:
+            current = os.stat(path)
+        except OSError:
+            current = None
+        if stat is not None and (current is None or (current.st_mtime_ns, current.st_size)
+                                 != (stat.st_mtime_ns, stat.st_size)):
+            self._reload_timer.start()
+
+    def _unwatch(self) -> None:
+        """원본 파일 감시를 멈추고 진행 중인 다시 읽기 결과를 무효로 만듭니다."""
+        files = self._watcher.files()
+        if files:
+            self._watcher.removePaths(files)
+        self._reload_timer.stop()
+        self._watch_generation += 1
+        self._file_blocks = None
+        self._file_stat = None
+
+    def _on_file_changed(self, _path: str) -> None:
+        """파일 변경 알림을 모아 쓰기가 잠잠해진 뒤 한 번만 다시 읽습니다."""
+        self._reload_timer.start()
+
+    def _start_reload(self) -> None:
+        """바뀐 원본 파일을 백그라운드 스레드에서 읽고 바뀐 영역을 찾습니다."""
+        path = self.file_path
+        pyramid = self._unprojected
+        if path is None or not isinstance(pyramid, ImagePyramid):
+            return
+        if self._reloading:
+            # 진행 중인 읽기가 끝나면 다시 확인한다
+            self._reload_timer.start()
+            return
+        if not os.path.exists(path):
+            self.status_message.emit(f"원본 파일이 사라졌습니다: {os.path.basename(path)}")
+            return
+        # 원자적 교체(새 파일로 이름 바꾸기)는 감시가 풀리므로 다시 등록한다
+        if path not in self._watcher.files():
+            self._watcher.addPath(path)
+        self._reloading = True
+        generation = self._watch_generation
+        old_blocks = self._file_blocks
+        old_data = pyramid.image_data.data
+
+        def run():
+            try:
+                stat = os.stat(path)
+                # 바이트 수가 달라진 블록은 읽지 않고 바뀐 것으로 본다
+                blocks = read_tiff_blocks(path, old_blocks)
+                changed = None
+                if old_blocks is not None and blocks is not None:
+                    changed = changed_block_indices(old_blocks, blocks)
+                    if changed == []:
+                        # 블록 내용이 그대로면 디코딩하지 않는다 (태그만 바뀐 경우 등)
+                        self._reload_ready.emit(
+                            ReloadResult(generation, blocks, None, [], stat=stat))
+                        return
+                if changed and old_data is not None:
+                    # 바뀐 블록만 디코딩해 기존 배열 사본에 덮어쓴다
+                    patched = patch_blocks(path, blocks, changed, old_data)
+                    if patched is not None:
+                        data, blocks = patched
+                        rects = sorted({blocks.block_rect(index) for _, index in changed},
+                                       key=lambda r: (r[1], r[0]))
+                        self._reload_ready.emit(ReloadResult(
+                            generation, blocks, ImageData.from_array(path, data), rects,
+                            stat=stat))
+                        return
+                # 전체 디코딩: 비교 기준은 디코딩 전에 모든 블록을 읽어 둔다
+                stat = os.stat(path)
+                blocks = read_tiff_blocks(path)
+                image_data = ImageData()
+                image_data.load(path)
+                rects = None
+                if old_data is not None:
+                    rects = changed_pixels(old_data, image_data.data, pyramid.tile_size)
+                self._reload_ready.emit(
+                    ReloadResult(generation, blocks, image_data, rects, stat=stat))
+            except Exception as e:
+                self._reload_ready.emit(ReloadResult(generation, error=str(e)))
+
+        threading.Thread(target=run, name="file-reload", daemon=True).start()
+
+    def _apply_reload(self, result: ReloadResult) -> None:
+        """메인 스레드에서 다시 읽은 픽셀을 반영하고 바뀐 타일만 다시 그립니다."""
+        self._reloading = False
+        if result.generation != self._watch_generation:
+            return
+        name = os.path.basename(self.file_path)
+        if result.error is not None:
+            self.status_message.emit(f"오류: {name} 다시 읽기 실패: {result.error}")
+            return
+        self._file_blocks = result.blocks
+        self._file_stat = result.stat
+        if result.image_data is None or result.rects == []:
+            self.status_message.emit(f"{name}: 바뀐 픽셀이 없습니다.")
+            return
+
+        pyramid = self._unprojected
+        rects = result.rects
+        if rects is None:
+            rects = [(0, 0, pyramid.width, pyramid.height)]
+        margin = self.filter_pipeline.halo + 1
+        try:
+            removed = pyramid.replace_data(result.image_data, rects, margin)
+        except ValueError:
+            # 크기·밴드가 바뀌면 다시 연다 (확대·필터 상태는 초기화됨)
+            try:
+                self.load_image(self.file_path)
+            except Exception as e:
+                self.status_message.emit(f"오류: {str(e)}")
+            return
+        self.image_data = result.image_data
+        self.image_item.invalidate(pyramid.changed_tile_predicate(rects, margin))
+        if not self.active:
+            pyramid.release()
+        self.pipeline_changed.emit()
+        self.status_message.emit(f"{name} 갱신: 바뀐 영역 {len(rects)}개, "
+                                 f"타일 {removed}개 다시 계산")
+
+    def _compare_pyramid(self) -> Optional[TileSource]:
+        """비교 영상의 피라미드를 반환합니다."""
+        return self.compare_pipeline.source if self.compare_pipeline is not None else None
+
+    def _on_scrolled(self, *_):
+        """스크롤 시 화면 타일 고정을 갱신하고 뷰포트 변경을 알립니다."""
+        if self.active:
+            self._pin_visible()
+        self.viewport_changed.emit()
+
+    def _pin_visible(self) -> None:
+        """현재 화면에 보이는 타일을 캐시에 고정합니다."""
+        if self.image_item is None:
+            return
+        rect = self.visible_rect()
+        scale = self.view.transform().m11()
+        self.image_item.pin_visible(rect, scale)
+        if self.compare_item is not None:
+            self.compare_item.pin_visible(rect, scale)
+
+    def visible_rect(self) -> QRectF:
+        """메인 뷰에 보이는 장면(레벨 0) 사각형을 반환합니다."""
+        return self.view.mapToScene(self.view.viewport().rect()).boundingRect()
+
+    def zoom_by(self, factor: float) -> None:
+        """현재 확대율에 배율을 곱합니다."""
+        if self.image_item:
+            self.view.scale(factor, factor)
+            self.state.scale_factor *= factor
+            self.view_changed()
+
+    def zoom_in(self):
+        """이미지 확대"""
+        self.zoom_by(1.25)
+
+    def zoom_out(self):
+        """이미지 축소"""
+        self.zoom_by(0.8)
+
+    def normal_size(self):
+        """이미지를 원본 크기로 표시"""
+        if self.image_item:
+            self.view.resetTransform()
+            self.state.scale_factor = 1.0
+            self.view_changed()
+
+    def fit_to_window(self):
+        """이미지를 창에 맞게 조정"""
+        if self.image_item:
+            # 뷰포트 크기 가져오기
+            view_rect = self.view.viewport().rect()
+            view_size = view_rect.size()
+
+            # 이미지 크기 가져오기
+            image_size = self.image_item.boundingRect().size()
+
+            # 종횡비 유지하며 맞출 스케일 계산
+            scale_x = view_size.width() / image_size.width()
+            scale_y = view_size.height() / image_size.height()
+            scale = min(scale_x, scale_y) * 0.95  # 약간의 여백 추가
+
+            # 변환 적용
+            self.view.resetTransform()
+            self.view.scale(scale, scale)
+            self.state.scale_factor = scale
+
+            # 이미지를 뷰포트 중앙에 배치
+            self.view.centerOn(self.image_item)
+
+            self.view_changed()
+
+    def view_changed(self):
+        """확대/축소 후 비교 뷰를 동기화하고 변경을 알립니다."""
+        if self.compare_mode == 'side':
+            self.view_link.sync()
+        self._on_scrolled()
+        self.status_message.emit(self.zoom_message())
+
+    def zoom_message(self) -> str:
+        """상태 표시줄용 확대율/회전 문자열을 반환합니다."""
+        zoom_percent = int(self.state.scale_factor * 100)
+        return f"확대율: {zoom_percent}% | 회전: {int(self.state.rotation)}°"
+
+    def georeference(self):
+        """표시 격자의 (지오트랜스폼, 좌표계)를 반환합니다. 없으면 (None, None)."""
+        if isinstance(self.pyramid, ReprojectedSource):
+            return self.pyramid.geotransform, self.pyramid.crs
+        if self.image_data is not None:
+            metadata = self.image_data.metadata
+            return metadata.geotransform, metadata.crs
+        return None, None
+
+    def export_region(self, path: str, scale: float = 1.0,
+                      rect: Optional[QRectF] = None, format: Optional[str] = None,
+                      compression: str = "deflate") -> Optional[threading.Thread]:
+        """영역을 현재 조정/필터를 반영해 파일로 내보냅니다.
+
+        렌더링과 압축은 백그라운드 스레드에서 행 띠 단위로 진행되며,
+        진행률과 결과는 상태 표시줄 메시지로 알립니다.
+
+        Args:
+            path: 출력 경로 (.tif/.png/.jpg)
+            scale: 출력 배율
+            rect: 레벨 0 장면 사각형. None이면 화면에 보이는 영역
+            format: 'tiff', 'cog', 'png', 'jpeg'. None이면 확장자로 결정
+            compression: COG 압축 방식
+
+        Returns:
+            Optional[threading.Thread]: 내보내기 스레드. 영상이 없으면 None
+        """
+        if self.filter_pipeline is None:
+            return None
+        rect = (rect or self.visible_rect()).intersected(self.image_item.boundingRect())
+        region = (rect.x(), rect.y(), rect.width(), rect.height())
+        geotransform, crs = self.georeference()
+        pipeline = self.filter_pipeline
+        name = os.path.basename(path)
+        report = self._progress_reporter(f"내보내는 중: {name}")
+
+        def run():
+            try:
+                width, height = export_region(pipeline, path, region, scale, format,
+                                              compression=compression,
+                                              geotransform=geotransform, crs=crs,
+                                              progress=report)
+                self.status_message.emit(f"내보내기 완료: {name} ({width}x{height})")
+            except Exception as e:
+                self.status_message.emit(f"오류: {str(e)}")
+
+        thread = threading.Thread(target=run, name="region-export", daemon=True)
+        thread.start()
+        return thread
+
+    def export_cog(self, path: str, compression: str = "deflate") -> Optional[threading.Thread]:
+        """영상 전체를 현재 조정/필터를 반영해 COG로 저장합니다.
+
+        타일 읽기와 압축은 백그라운드 스레드에서 진행되며, 진행률과 결과는
+        상태 표시줄 메시지로 알립니다.
+
+        Args:
+            path: 출력 경로 (.tif)
+            compression: 'deflate', 'zstd', 'jpeg', 'webp', 'none'
+
+        Returns:
+            Optional[threading.Thread]: 저장 스레드. 영상이 없으면 None
+        """
+        if self.filter_pipeline is None:
+            return None
+        geotransform, crs = self.georeference()
+        nodata = self.image_data.metadata.nodata if self.image_data is not None else None
+        pipeline = self.filter_pipeline
+        name = os.path.basename(path)
+        report = self._progress_reporter(f"COG 저장 중: {name}")
+
+        def run():
+            try:
+                sizes = write_cog(pipeline, path, compression, geotransform=geotransform,
+                                  crs=crs, nodata=nodata, progress=report)
+                self.status_message.emit(
+                    f"COG 저장 완료: {name} ({sizes[0][0]}x{sizes[0][1]}, "
+                    f"오버뷰 {len(sizes) - 1}개)")
+            except Exception as e:
+                self.status_message.emit(f"오류: {str(e)}")
+
+        thread = threading.Thread(target=run, name="cog-export", daemon=True)
+        thread.start()
+        return thread
+
+    def _progress_reporter(self, label: str):
+        """백분율이 바뀔 때만 상태 메시지를 보내는 진행률 함수를 만듭니다."""
+        last_percent = [-1]
+
+        def report(done: int, total: int):
+            percent = done * 100 // total
+            if percent != last_percent[0]:
+                last_percent[0] = percent
+                self.status_message.emit(f"{label} {percent}%")
+
+        return report
+
+    def set_filters(self, stages):
+        """이웃 필터 단계를 교체합니다.
+
+        Args:
+            stages: 적용할 FilterStage 목록 (빈 목록이면 필터 해제)
+        """
+        self.filters = list(stages)
+        self.update_pipeline()
+
+    def add_adjustment(self, op):
+        """점 연산 조정을 추가합니다.
+
+        Args:
+            op: 추가할 PointOp
+        """
+        self.adjustments.append(op)
+        self.update_pipeline()
+
+    def clear_adjustments(self):
+        """모든 점 연산 조정을 해제합니다."""
+        self.adjustments = []
+        self.update_pipeline()
+
+    def update_pipeline(self):
+        """조정(점 연산)과 필터를 파이프라인에 반영합니다.
+
+        파이프라인 버전이 바뀌므로 화면에 보이는 타일만 다시 계산됩니다.
+        """
+        if self.filter_pipeline is None:
+            return
+        self.filter_pipeline.set_stages(self.adjustments + self.filters)
+        self._source_changed(self.image_item)
+        if self.compare_pipeline is not None:
+            self.compare_pipeline.set_stages(self.adjustments + self.filters)
+            if self.compare_item is not None:
+                self._source_changed(self.compare_item)
+        self.pipeline_changed.emit()
+
+    def _source_changed(self, item: TiledImageItem) -> None:
+        """파이프라인 키가 바뀐 아이템의 고정을 새 키로 옮기고 다시 그립니다."""
+        item.release_visible()
+        item.unpin_overview()
+        item.pin_overview()
+        item.update()
+        if self.active:
+            self._pin_visible()
+
+    def band_source(self, kind: str, bands: Tuple[int, ...]):
+        """밴드 합성/지수 소스를 만들거나 재사용합니다.
+
+        같은 밴드 조합의 소스는 재사용되므로 캐시된 타일도 그대로 쓰입니다.
+        합성 스트레치 범위는 모든 조합이 공유하며, 첫 타일을 만드는 작업자
+        스레드에서 계산되므로 여기서는 픽셀을 읽지 않습니다.
+
+        Args:
+            kind: 'composite' (RGB 합성) 또는 'ndvi' (정규화 차이 지수)
+            bands: 합성은 (R, G, B), 지수는 (NIR, Red) 밴드 인덱스
+        """
+        key = (kind, tuple(bands))
+        source = self.band_sources.get(key)
+        if source is None:
+            if kind == "composite":
+                if self.band_stretch is None:
+                    self.band_stretch = BandStretch(self.pyramid)
+                source = BandCompositeSource(self.pyramid, bands, self.band_stretch)
+            else:
+                source = BandIndexSource.ndvi(self.pyramid, *bands)
+            self.band_sources[key] = source
+        return source
+
+    def _ask_bands(self, title: str, label: str, count: int) -> Optional[Tuple[int, ...]]:
+        """사용자에게 쉼표로 구분한 밴드 번호를 입력받습니다."""
+        text, ok = QInputDialog.getText(self, title, label)
+        if not ok:
+            return None
+        try:
+            bands = tuple(int(part) for part in text.split(","))
+        except ValueError:
+            bands = ()
+        if len(bands) != count:
+            self.status_message.emit(f"오류: 밴드 번호 {count}개를 입력하세요.")
+            return None
+        return bands
+
+    def show_band_composite(self, bands: Optional[Tuple[int, int, int]] = None):
+        """임의의 세 밴드를 RGB로 합성해 표시합니다.
+
+        Args:
+            bands: (R, G, B) 밴드 인덱스. None인 경우 사용자에게 입력받음
+        """
+        if self.pyramid is None:
+            return
+        if bands is None:
+            bands = self._ask_bands("밴드 합성", "R,G,B 밴드 번호 (0부터):", 3)
+            if bands is None:
+                return
+        self._set_display_source(lambda: self.band_source("composite", bands))
+
+    def show_ndvi(self, bands: Optional[Tuple[int, int]] = None):
+        """NDVI 지수를 컬러맵으로 표시합니다.
+
+        Args:
+            bands: (NIR, Red) 밴드 인덱스. None인 경우 사용자에게 입력받음
+        """
+        if self.pyramid is None:
+            return
+        if bands is None:
+            bands = self._ask_bands("NDVI", "NIR,Red 밴드 번호 (0부터):", 2)
+            if bands is None:
+                return
+        self._set_display_source(lambda: self.band_source("ndvi", bands))
+
+    def show_original_bands(self):
+        """밴드 합성을 해제하고 원본 채널을 표시합니다."""
+        if self.pyramid is None:
+            return
+        if self.pyramid.channels > 4:
+            self.show_band_composite((2, 1, 0))
+        else:
+            self._set_display_source(lambda: self.pyramid)
+
+    def _set_display_source(self, make_source):
+        """파이프라인 입력 소스를 교체합니다. 잘못된 밴드 조합은 상태 표시줄에 알립니다."""
+        try:
+            source = make_source()
+        except ValueError as e:
+            self.status_message.emit(f"오류: {str(e)}")
+            return
+        self.filter_pipeline.set_source(source)
+        self._source_changed(self.image_item)
+        self.pipeline_changed.emit()
+
+    def load_compare_image(self, file_path: str, mode: str = 'side'):
+        """비교할 이미지를 로드하고 비교 모드를 켭니다.
+
+        두 영상은 같은 픽셀 격자(레벨 0 좌표)에 겹쳐 있다고 가정합니다.
+
+        Args:
+            file_path: 비교 이미지 경로
+            mode: 'side' (나란히) 또는 'swipe' (스와이프)
+        """
+        if self.image_item is None:
+            self.status_message.emit("먼저 기준 이미지를 여세요.")
+            return
+        try:
+            self.set_compare_mode('off')
+            compare_data = ImageData()
+            compare_data.load(file_path)
+            # 이전 비교 영상의 캐시 타일은 다시 쓰이지 않으므로 바로 내린다
+            old = self._compare_pyramid()
+            if old is not None:
+                old.cache.invalidate_source(old.cache_key)
+            self.compare_data = compare_data
+            self.compare_pipeline = FilterPipeline(ImagePyramid(self.compare_data),
+                                                   self.adjustments + self.filters)
+            self.set_compare_mode(mode)
+            self.status_message.emit(f"비교 이미지 로드: {os.path.basename(file_path)}")
+        except Exception as e:
+            self.status_message.emit(f"오류: {str(e)}")
+
+    def set_compare_mode(self, mode: str):
+        """비교 모드를 전환합니다.
+
+        Args:
+            mode: 'off', 'side' (나란히 보기), 'swipe' (스와이프)
+        """
+        # 기존 비교 아이템 제거
+        if self.compare_item is not None:
+            self.compare_item.release_visible()
+            self.compare_item.unpin_overview()
+            if self.swipe_clip is not None:
+                self.scene.removeItem(self.swipe_clip)
+            else:
+                self.compare_scene.removeItem(self.compare_item)
+            self.compare_item = None
+            self.swipe_clip = None
+        self.compare_view.hide()
+        self.swipe_slider.hide()
+        self.compare_mode = 'off'
+
+        if mode == 'off' or self.compare_pipeline is None or self.image_item is None:
+            return
+
+        self.compare_item = TiledImageItem(self.compare_pipeline)
+        self.compare_item.pin_overview()
+        bounds = self.image_item.boundingRect().united(self.compare_item.boundingRect())
+        if mode == 'swipe':
+            # 같은 씬에서 비교 영상을 왼쪽 일부만 보이도록 잘라서 위에 겹친다
+            self.swipe_clip = SwipeClipItem(bounds.width(), bounds.height())
+            self.swipe_clip.set_position(self.swipe_slider.value() / 1000.0)
+            self.compare_item.setParentItem(self.swipe_clip)
+            self.scene.addItem(self.swipe_clip)
+            self.scene.setSceneRect(bounds)
+            self.swipe_slider.show()
+        else:
+            # 같은 장면 범위를 가진 두 번째 뷰에 표시하고 변환/스크롤을 연결한다
+            self.compare_scene.addItem(self.compare_item)
+            self.scene.setSceneRect(bounds)
+            self.compare_scene.setSceneRect(bounds)
+            self.compare_view.show()
+            half = max(1, self.splitter.width() // 2)
+            self.splitter.setSizes([half, half])
+            self.view_link.sync()
+        self.compare_mode = mode
+
+    def set_swipe_position(self, value: int):
+        """스와이프 경계 위치를 갱신합니다 (슬라이더 값 0 ~ 1000)."""
+        if self.swipe_clip is not None:
+            self.swipe_clip.set_position(value / 1000.0)
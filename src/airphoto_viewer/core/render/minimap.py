@@ -0,0 +1,130 @@
+"""
+전체 영상 개요(미니맵) 위젯 모듈입니다.
+
+타일 소스의 가장 거친 레벨 타일 하나만으로 전체 영상을 그리고, 현재
+뷰포트 위치를 사각형으로 표시합니다. 클릭/드래그하면 해당 지점으로
+메인 뷰를 이동시킵니다. 개요 타일은 공유 캐시에 있으면 즉시 표시하고,
+없으면 백그라운드 로더에 최우선으로 요청합니다.
+"""
+
+from typing import Hashable, Optional
+
+from PyQt6.QtCore import QPointF, QRectF, QSize, Qt, pyqtSignal
+from PyQt6.QtGui import QColor, QImage, QPainter, QPen
+from PyQt6.QtWidgets import QSizePolicy, QWidget
+
+from ..tile.background_loader import BackgroundLoader, get_shared_loader
+from ..tile.tile import TileCoord
+from ..tile.tile_source import TileSource
+from .tile_layer import array_to_qimage
+
+
+class MinimapWidget(QWidget):
+    """전체 영상 개요와 현재 뷰포트를 보여주는 위젯입니다.
+
+    속성:
+        source (Optional[TileSource]): 개요를 만들 타일 소스
+        view_rect (QRectF): 현재 뷰포트 (레벨 0 좌표)
+    """
+
+    # 사용자가 이동을 요청한 지점 (레벨 0 좌표)
+    navigate_requested = pyqtSignal(QPointF)
+    # 작업자 스레드에서 개요 타일이 준비되면 발생 (메인 스레드로 큐잉됨)
+    _overview_ready = pyqtSignal(object, object)
+
+    def __init__(self, loader: Optional[BackgroundLoader] = None, parent=None):
+        """MinimapWidget 인스턴스를 초기화합니다.
+
+        Args:
+            loader: 백그라운드 로더. None인 경우 공유 로더 사용
+            parent: 부모 위젯
+        """
+        super().__init__(parent)
+        self.loader = loader or get_shared_loader()
+        self.source: Optional[TileSource] = None
+        self.view_rect = QRectF()
+        self._image: Optional[QImage] = None
+        self._key: Optional[Hashable] = None
+        self.setSizePolicy(QSizePolicy.Policy.Expanding, QSizePolicy.Policy.Expanding)
+        self.setMouseTracking(False)
+        self._overview_ready.connect(self._on_overview_ready)
+
+    def sizeHint(self) -> QSize:
+        return QSize(220, 220)
+
+    def set_source(self, source: Optional[TileSource]) -> None:
+        """개요를 그릴 타일 소스를 설정합니다.
+
+        Args:
+            source: 타일 소스. None이면 미니맵을 비움
+        """
+        self.source = source
+        self._image = None
+        self._key = None
+        if source is not None:
+            coord = TileCoord(source.num_levels - 1, 0, 0)
+            self._key = source.tile_key(coord)
+            tile = source.cached_tile(coord)
+            if tile is not None:
+                self._image = array_to_qimage(tile)
+            else:
+                self.loader.queue_tile_load(
+                    self._key, lambda: source.get_tile(coord), -2.0,
+                    lambda key, tile: self._overview_ready.emit(key, tile))
+        self.update()
+
+    def set_view_rect(self, rect: QRectF) -> None:
+        """현재 뷰포트 사각형(레벨 0 좌표)을 갱신합니다."""
+        if rect != self.view_rect:
+            self.view_rect = QRectF(rect)
+            self.update()
+
+    def _image_rect(self) -> QRectF:
+        """위젯 안에서 종횡비를 유지한 개요 영상 영역을 반환합니다."""
+        if self.source is None:
+            return QRectF()
+        scale = min(self.width() / self.source.width, self.height() / self.source.height)
+        w, h = self.source.width * scale, self.source.height * scale
+        return QRectF((self.width() - w) / 2, (self.height() - h) / 2, w, h)
+
+    def paintEvent(self, event) -> None:
+        painter = QPainter(self)
+        painter.fillRect(self.rect(), QColor(40, 40, 40))
+        if self.source is None:
+            return
+        target = self._image_rect()
+        if self._image is not None:
+            painter.setRenderHint(QPainter.RenderHint.SmoothPixmapTransform)
+            painter.drawImage(target, self._image)
+        if not self.view_rect.isEmpty():
+            scale = target.width() / self.source.width
+            rect = QRectF(target.x() + self.view_rect.x() * scale,
+                          target.y() + self.view_rect.y() * scale,
+                          self.view_rect.width() * scale, self.view_rect.height() * scale)
+            painter.setPen(QPen(QColor(255, 60, 60), 2))
+            painter.drawRect(rect.intersected(target.adjusted(-1, -1, 1, 1)))
+
+    def mousePressEvent(self, event) -> None:
+        if event.button() == Qt.MouseButton.LeftButton:
+            self._navigate(event.position())
+
+    def mouseMoveEvent(self, event) -> None:
+        if event.buttons() & Qt.MouseButton.LeftButton:
+            self._navigate(event.position())
+
+    def _navigate(self, pos: QPointF) -> None:
+        """위젯 좌표를 레벨 0 좌표로 바꿔 이동 요청 시그널을 발생시킵니다."""
+        target = self._image_rect()
+        if target.isEmpty():
+            return
+        scale = self.source.width / target.width()
+        x = min(max(pos.x() - target.x(), 0.0), target.width()) * scale
+        y = min(max(pos.y() - target.y(), 0.0), target.height()) * scale
+        self.navigate_requested.emit(QPointF(x, y))
+
+    def _on_overview_ready(self, key: Hashable, tile) -> None:
+        """메인 스레드에서 도착한 개요 타일을 표시합니다."""
+        if key != self._key or tile is None:
+            return
+        self._image = array_to_qimage(tile)
+        self.update()
@@ -0,0 +1,223 @@
+"""
+폴더의 영상을 썸네일 격자로 보여주는 가상화 브라우저 위젯 모듈입니다.
+
+모델/뷰 구조라 항목마다 위젯을 만들지 않으며, 뷰가 그리는(화면에 보이는)
+칸에 대해서만 모델이 썸네일을 요청합니다. 캐시에 있는 썸네일은 데이터베이스의
+메모리 맵 뷰를 QImage로 감싸 바로 픽스맵으로 만들고, 없는 썸네일은 썸네일
+서비스에 최근 요청 우선으로 생성을 맡깁니다. 픽스맵은 개수가 제한된 LRU에
+보관되어 스크롤해 지나간 칸의 메모리는 재사용되며, 스크롤하면 화면을 벗어난
+대기 요청은 취소됩니다.
+"""
+
+import itertools
+import os
+from collections import OrderedDict
+from typing import Dict, List, Optional, Sequence
+
+import numpy as np
+from PyQt6.QtCore import QAbstractListModel, QModelIndex, QSize, Qt, pyqtSignal
+from PyQt6.QtGui import QColor, QImage, QPixmap
+from PyQt6.QtWidgets import QListView
+
+from ..image.thumbnails import DEFAULT_THUMBNAIL_SIZE, ThumbnailService, list_images
+from ..tile.completion_queue import CompletionQueue
+
+# 보관할 최대 픽스맵 수 (화면 몇 장 분량)
+PIXMAP_CACHE_SIZE = 1024
+
+
+class ThumbnailModel(QAbstractListModel):
+    """영상 경로 목록과 보이는 칸의 썸네일 픽스맵을 제공하는 모델입니다.
+
+    속성:
+        service (ThumbnailService): 썸네일 서비스
+        paths (List[str]): 영상 경로 목록
+    """
+
+    # 비어 있던 완료 큐에 썸네일이 들어오면 발생 (메인 스레드로 큐잉됨)
+    _thumbnails_ready = pyqtSignal()
+
+    def __init__(self, service: ThumbnailService, parent=None):
+        """ThumbnailModel 인스턴스를 초기화합니다.
+
+        Args:
+            service: 썸네일 서비스
+            parent: 부모 객체
+        """
+        super().__init__(parent)
+        self.service = service
+        self.paths: List[str] = []
+        self._rows: Dict[str, int] = {}
+        self._source_sizes: Dict[str, tuple] = {}
+        self._pixmaps: "OrderedDict[str, QPixmap]" = OrderedDict()
+        self._requested = set()
+        self._sequence = itertools.count()
+        size = service.size
+        self._placeholder = QPixmap(size, size)
+        self._placeholder.fill(QColor(60, 60, 60))
+        self._completed = CompletionQueue(self._thumbnails_ready.emit)
+        self._thumbnails_ready.connect(self._on_thumbnails_ready)
+
+    def set_paths(self, paths: Sequence[str]) -> None:
+        """표시할 영상 경로 목록을 교체합니다."""
+        self.beginResetModel()
+        self.service.cancel_pending()
+        self.paths = list(paths)
+        self._rows = {path: row for row, path in enumerate(self.paths)}
+        self._source_sizes.clear()
+        self._pixmaps.clear()
+        self._requested.clear()
+        self.endResetModel()
+
+    def rowCount(self, parent: QModelIndex = QModelIndex()) -> int:
+        return 0 if parent.isValid() else len(self.paths)
+
+    def data(self, index: QModelIndex, role: int = Qt.ItemDataRole.DisplayRole):
+        if not index.isValid():
+            return None
+        path = self.paths[index.row()]
+        if role == Qt.ItemDataRole.DisplayRole:
+            return os.path.basename(path)
+        if role == Qt.ItemDataRole.DecorationRole:
+            return self._pixmap(path)
+        if role == Qt.ItemDataRole.ToolTipRole:
+            size = self._source_sizes.get(path)
+            return f"{path}\n{size[0]}x{size[1]}" if size else path
+        if role == Qt.ItemDataRole.UserRole:
+            return path
+        return None
+
+    def cancel_requests(self) -> None:
+        """대기 중인 썸네일 요청을 취소합니다 (보이는 칸은 다시 그릴 때 재요청)."""
+        self.service.cancel_pending()
+        self._requested.clear()
+
+    def _pixmap(self, path: str) -> QPixmap:
+        """칸의 픽스맵을 반환합니다. 없으면 요청하고 자리표시자를 반환합니다."""
+        pixmap = self._pixmaps.get(path)
+        if pixmap is not None:
+            self._pixmaps.move_to_end(path)
+            return pixmap
+        if path not in self._requested:
+            # 가장 최근에 그려진 칸(현재 화면)이 먼저 처리되도록 한다
+            result = self.service.request(path, self._thumbnail_loaded,
+                                          priority=-next(self._sequence))
+            if result is not None:
+                return self._store(path, result)
+            self._requested.add(path)
+        return self._placeholder
+
+    def _store(self, path: str, result) -> QPixmap:
+        """썸네일 배열로 픽스맵을 만들어 LRU에 넣습니다."""
+        thumb, source_size = result
+        self._source_sizes[path] = source_size
+        thumb = np.ascontiguousarray(thumb)
+        height, width = thumb.shape[:2]
+        # 메모리 맵 뷰를 복사 없이 감싸고, 픽스맵으로 한 번만 복사한다
+        image = QImage(thumb.data, width, height, thumb.strides[0],
+                       QImage.Format.Format_BGR888)
+        pixmap = QPixmap.fromImage(image)
+        self._pixmaps[path] = pixmap
+        while len(self._pixmaps) > PIXMAP_CACHE_SIZE:
+            self._pixmaps.popitem(last=False)
+        return pixmap
+
+    def _thumbnail_loaded(self, path: str, result) -> None:
+        """작업자 스레드에서 생성된 썸네일을 완료 큐에 넣습니다."""
+        self._completed.push((path, result))
+
+    def _on_thumbnails_ready(self) -> None:
+        """도착한 썸네일들을 칸에 반영하고 바뀐 행 범위를 한 번에 알립니다."""
+        first = last = None
+        for path, result in self._completed.drain():
+            self._requested.discard(path)
+            row = self._rows.get(path)
+            if row is None or result is None:
+                continue
+            self._store(path, result)
+            first = row if first is None else min(first, row)
+            last = row if last is None else max(last, row)
+        if first is not None:
+            self.dataChanged.emit(self.index(first), self.index(last),
+                                  [Qt.ItemDataRole.DecorationRole])
+
+
+class ThumbnailBrowser(QListView):
+    """썸네일 격자 브라우저입니다. 항목을 활성화하면 경로를 알립니다.
+
+    속성:
+        thumbnail_model (Optional[ThumbnailModel]): 썸네일 모델 (첫 목록 설정 시 생성)
+    """
+
+    # 더블클릭/Enter로 활성화한 영상 경로
+    image_activated = pyqtSignal(str)
+
+    def __init__(self, service: Optional[ThumbnailService] = None, parent=None):
+        """ThumbnailBrowser 인스턴스를 초기화합니다.
+
+        Args:
+            service: 썸네일 서비스. None이면 기본 데이터베이스를 쓰는 서비스를 처음 쓸 때 생성
+            parent: 부모 위젯
+        """
+        super().__init__(parent)
+        self._service = service
+        self.thumbnail_model: Optional[ThumbnailModel] = None
+        size = service.size if service is not None else DEFAULT_THUMBNAIL_SIZE
+        self.setViewMode(QListView.ViewMode.IconMode)
+        self.setIconSize(QSize(size, size))
+        self.setGridSize(QSize(size + 16, size + 32))
+        self.setResizeMode(QListView.ResizeMode.Adjust)
+        self.setMovement(QListView.Movement.Static)
+        # 모든 칸이 같은 크기이므로 항목별 크기 계산 없이 배치한다
+        self.setUniformItemSizes(True)
+        self.setLayoutMode(QListView.LayoutMode.Batched)
+        self.setBatchSize(2000)
+        self.setWordWrap(False)
+        self.setTextElideMode(Qt.TextElideMode.ElideMiddle)
+        self.activated.connect(self._on_activated)
+        self.verticalScrollBar().valueChanged.connect(self._on_scrolled)
+
+    @property
+    def service(self) -> ThumbnailService:
+        """썸네일 서비스 (처음 접근할 때 생성)"""
+        if self._service is None:
+            self._service = ThumbnailService()
+        return self._service
+
+    def sizeHint(self) -> QSize:
+        # 썸네일 세 열이 들어가는 너비
+        grid = self.gridSize()
+        return QSize(3 * grid.width() + self.verticalScrollBar().sizeHint().width() + 8, 600)
+
+    def set_directory(self, directory: str) -> int:
+        """폴더의 영상을 표시합니다.
+
+        Returns:
+            int: 표시한 영상 수
+        """
+        paths = list_images(directory)
+        self.set_paths(paths)
+        return len(paths)
+
+    def set_paths(self, paths: Sequence[str]) -> None:
+        """표시할 영상 경로 목록을 설정합니다."""
+        if self.thumbnail_model is None:
+            self.thumbnail_model = ThumbnailModel(self.service, self)
+            self.setModel(self.thumbnail_model)
+        self.thumbnail_model.set_paths(paths)
+        self.scrollToTop()
+
+    def shutdown(self) -> None:
+        """썸네일 작업자를 종료하고 데이터베이스를 닫습니다."""
+        if self._service is not None:
+            self._service.close()
+
+    def _on_scrolled(self, value: int) -> None:
+        """스크롤하면 화면을 벗어난 대기 요청을 취소합니다."""
+        if self.thumbnail_model is not None:
+            self.thumbnail_model.cancel_requests()
+
+    def _on_activated(self, index: QModelIndex) -> None:
+        path = index.data(Qt.ItemDataRole.UserRole)
+        if path:
+            self.image_activated.emit(path)
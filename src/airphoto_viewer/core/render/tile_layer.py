@@ -0,0 +1,275 @@
+"""
+타일 기반 그래픽 아이템 모듈입니다.
+
+`TiledImageItem`은 현재 확대율에 맞는 피라미드 레벨을 골라 화면에 보이는
+타일만 그립니다. 캐시에 없는 타일은 백그라운드 로더에 요청하고, 도착하기
+전까지는 캐시에 있는 더 거친 레벨의 타일을 확대해서 대신 그립니다.
+완료된 타일 키는 작업자 스레드가 완료 큐에 넣고, 메인 스레드는 한 번 깨어날
+때 쌓인 키를 모두 꺼내 다시 그릴 영역을 한 번에 갱신합니다.
+화면에 보이는 타일과 가장 거친 개요 타일은 캐시에 고정(pin)할 수 있으며,
+백그라운드 탭은 화면 타일 고정을 풀어 캐시 예산을 활성 탭에 양보합니다.
+"""
+
+import math
+from collections import OrderedDict
+from typing import Callable, Hashable, Optional
+
+import numpy as np
+from PyQt6.QtCore import QRectF, pyqtSignal
+from PyQt6.QtGui import QImage, QPainter
+from PyQt6.QtWidgets import QGraphicsItem, QGraphicsObject, QStyleOptionGraphicsItem
+
+from ..tile.background_loader import BackgroundLoader, get_shared_loader
+from ..tile.completion_queue import CompletionQueue
+from ..tile.tile import TileCoord
+from ..tile.tile_source import TileSource
+
+
+def array_to_qimage(array: np.ndarray) -> QImage:
+    """OpenCV 배열(그레이/그레이+알파/BGR/BGRA, 8/16비트)을 QImage로 변환합니다.
+
+    반환된 QImage는 배열 메모리를 복사해 소유하므로 배열 수명과 무관합니다.
+
+    Args:
+        array: 변환할 배열
+
+    Returns:
+        QImage: 변환된 이미지
+    """
+    if array.dtype != np.uint8:
+        # 16비트/부동소수 데이터는 표시용으로 8비트로 축소한다
+        if array.dtype == np.uint16:
+            array = (array >> 8).astype(np.uint8)
+        else:
+            array = np.clip(array, 0, 255).astype(np.uint8)
+    if array.ndim == 3 and array.shape[2] == 1:
+        array = array[..., 0]
+    elif array.ndim == 3 and array.shape[2] == 2:
+        # 그레이+알파: 회색을 B, G, R에 복제해 BGRA로 만든다
+        gray, alpha = array[..., 0], array[..., 1]
+        array = np.dstack((gray, gray, gray, alpha))
+    array = np.ascontiguousarray(array)
+    height, width = array.shape[:2]
+    if array.ndim == 2:
+        fmt = QImage.Format.Format_Grayscale8
+    elif array.shape[2] == 4:
+        fmt = QImage.Format.Format_ARGB32  # 리틀 엔디언에서 BGRA 바이트 순서
+    else:
+        array = np.ascontiguousarray(array[..., 2::-1])  # BGR -> RGB
+        fmt = QImage.Format.Format_RGB888
+    image = QImage(array.data, width, height, array.strides[0], fmt)
+    return image.copy()
+
+
+class TiledImageItem(QGraphicsObject):
+    """타일 소스를 화면에 그리는 그래픽 아이템입니다.
+
+    아이템 좌표계는 레벨 0 픽셀 좌표와 같습니다.
+
+    속성:
+        source (TileSource): 그릴 타일 소스
+        loader (BackgroundLoader): 타일 계산에 사용하는 작업자 풀
+    """
+
+    # 비어 있던 완료 큐에 타일이 들어오면 발생 (메인 스레드로 큐잉됨)
+    _tiles_ready = pyqtSignal()
+
+    def __init__(self, source: TileSource, loader: Optional[BackgroundLoader] = None,
+                 max_qimages: int = 768, parent=None):
+        """TiledImageItem 인스턴스를 초기화합니다.
+
+        Args:
+            source: 그릴 타일 소스
+            loader: 백그라운드 로더. None인 경우 공유 로더 사용
+            max_qimages: 변환된 QImage를 보관할 최대 개수
+            parent: 부모 아이템
+        """
+        super().__init__(parent)
+        self.source = source
+        self.loader = loader or get_shared_loader()
+        self._qimages: "OrderedDict[Hashable, QImage]" = OrderedDict()
+        self._max_qimages = max_qimages
+        self._visible_pins = set()
+        self._overview_pin = None
+        # 계산이 실패한 타일 키 (무효화되기 전까지 다시 요청하지 않음)
+        self._failed = set()
+        self.setFlag(QGraphicsItem.GraphicsItemFlag.ItemUsesExtendedStyleOption, True)
+        self._completed = CompletionQueue(self._tiles_ready.emit)
+        self._tiles_ready.connect(self._on_tiles_ready)
+
+    def set_source(self, source: TileSource) -> None:
+        """그릴 타일 소스를 교체합니다 (예: 필터 파이프라인 적용)."""
+        old_key = self.source.cache_key
+        self.loader.cancel_pending_requests(
+            lambda key: isinstance(key, tuple) and key[0] == old_key)
+        self.prepareGeometryChange()
+        self.source = source
+        self._failed = set()
+        self.update()
+
+    def pin_visible(self, rect: QRectF, scale: float) -> None:
+        """화면에 보이는 타일을 캐시에 고정하고, 벗어난 타일의 고정을 풉니다.
+
+        Args:
+            rect: 보이는 영역 (레벨 0 좌표)
+            scale: 화면 확대율
+        """
+        source = self.source
+        level = self.level_for_scale(scale)
+        keys = {source.tile_key(coord) for coord in
+                source.tiles_in_rect(level, rect.left(), rect.top(), rect.right(), rect.bottom())}
+        for key in keys - self._visible_pins:
+            source.cache.pin(key)
+        for key in self._visible_pins - keys:
+            source.cache.unpin(key)
+        self._visible_pins = keys
+
+    def release_visible(self) -> None:
+        """화면 타일 고정, 대기 요청, 변환된 QImage를 모두 해제합니다."""
+        for key in self._visible_pins:
+            self.source.cache.unpin(key)
+        self._visible_pins = set()
+        prefix = self.source.cache_key
+        self.loader.cancel_pending_requests(
+            lambda key: isinstance(key, tuple) and key[0] == prefix)
+        self._qimages.clear()
+
+    def invalidate(self, predicate: Callable[[Hashable], bool]) -> None:
+        """조건을 만족하는 키의 대기 요청과 변환된 QImage를 버리고 다시 그립니다.
+
+        Args:
+            predicate: 타일 키를 받아 제거 여부를 반환하는 함수
+        """
+        self.loader.cancel_pending_requests(predicate)
+        for key in [key for key in self._qimages if predicate(key)]:
+            del self._qimages[key]
+        self._failed = {key for key in list(self._failed) if not predicate(key)}
+        self.update()
+
+    def pin_overview(self) -> None:
+        """가장 거친 레벨의 개요 타일을 고정해 언제든 대체 그리기가 가능하게 합니다."""
+        if self._overview_pin is None:
+            self._overview_pin = self.source.tile_key(TileCoord(self.source.num_levels - 1, 0, 0))
+            self.source.cache.pin(self._overview_pin)
+
+    def unpin_overview(self) -> None:
+        """개요 타일 고정을 해제합니다."""
+        if self._overview_pin is not None:
+            self.source.cache.unpin(self._overview_pin)
+            self._overview_pin = None
+
+    def boundingRect(self) -> QRectF:
+        return QRectF(0, 0, self.source.width, self.source.height)
+
+    def level_for_scale(self, scale: float) -> int:
+        """화면 확대율에 맞는 피라미드 레벨을 반환합니다."""
+        if scale <= 0:
+            return self.source.num_levels - 1
+        level = int(math.floor(math.log2(1.0 / scale))) if scale < 1.0 else 0
+        return max(0, min(level, self.source.num_levels - 1))
+
+    def paint(self, painter: QPainter, option: QStyleOptionGraphicsItem, widget=None) -> None:
+        scale = QStyleOptionGraphicsItem.levelOfDetailFromTransform(painter.worldTransform())
+        level = self.level_for_scale(scale)
+        exposed = option.exposedRect.intersected(self.boundingRect())
+        if exposed.isEmpty():
+            return
+
+        source = self.source
+        center_x, center_y = exposed.center().x(), exposed.center().y()
+        wanted = set()
+        for coord in source.tiles_in_rect(level, exposed.left(), exposed.top(),
+                                          exposed.right(), exposed.bottom()):
+            key = source.tile_key(coord)
+            wanted.add(key)
+            target = self._tile_target(coord)
+            image = self._qimage(key, source.cached_tile(coord))
+            if image is not None:
+                painter.drawImage(target, image)
+                continue
+            if key not in self._failed:
+                self._request(coord, key, target, center_x, center_y)
+            self._paint_fallback(painter, coord, target)
+
+        # 화면에서 벗어난 같은 소스·레벨의 대기 요청은 취소한다
+        prefix = source.cache_key
+        self.loader.cancel_pending_requests(
+            lambda key: isinstance(key, tuple) and key[0] == prefix
+            and key[1] == level and key not in wanted)
+
+    def _tile_target(self, coord: TileCoord) -> QRectF:
+        """타일이 그려질 레벨 0 좌표 사각형을 반환합니다."""
+        x, y, w, h = self.source.tile_rect(coord)
+        s = 1 << coord.level
+        return QRectF(x * s, y * s, w * s, h * s)
+
+    def _qimage(self, key: Hashable, tile: Optional[np.ndarray]) -> Optional[QImage]:
+        """타일 배열에 대응하는 QImage를 변환 캐시에서 찾거나 새로 만듭니다."""
+        image = self._qimages.get(key)
+        if image is not None:
+            self._qimages.move_to_end(key)
+            return image
+        if tile is None:
+            return None
+        image = array_to_qimage(tile)
+        self._qimages[key] = image
+        while len(self._qimages) > self._max_qimages:
+            self._qimages.popitem(last=False)
+        return image
+
+    def _request(self, coord: TileCoord, key: Hashable, target: QRectF,
+                 center_x: float, center_y: float) -> None:
+        """타일 계산을 백그라운드 로더에 요청합니다. 화면 중심에 가까울수록 먼저 처리됩니다."""
+        source = self.source
+        center = target.center()
+        priority = math.hypot(center.x() - center_x, center.y() - center_y)
+        self.loader.queue_tile_load(
+            key, lambda: source.get_tile(coord), priority, self._tile_loaded)
+
+    def _paint_fallback(self, painter: QPainter, coord: TileCoord, target: QRectF) -> None:
+        """캐시에 있는 가장 가까운 거친 레벨 타일의 일부를 확대해 그립니다."""
+        source = self.source
+        ancestor = coord
+        while ancestor.level + 1 < source.num_levels:
+            ancestor = ancestor.parent()
+            key = source.tile_key(ancestor)
+            image = self._qimage(key, source.cached_tile(ancestor))
+            if image is None:
+                continue
+            s = 1 << ancestor.level
+            ax, ay, _, _ = source.tile_rect(ancestor)
+            src = QRectF((target.x() / s) - ax, (target.y() / s) - ay,
+                         target.width() / s, target.height() / s)
+            painter.drawImage(target, image, src)
+            return
+        # 어떤 조상도 없으면 가장 거친 타일을 최우선으로 요청한다
+        top_key = source.tile_key(ancestor)
+        if ancestor != coord and top_key not in self._failed:
+            self.loader.queue_tile_load(
+                top_key, lambda: source.get_tile(ancestor), -1.0, self._tile_loaded)
+
+    def _tile_loaded(self, key: Hashable, tile) -> None:
+        """작업자 스레드에서 완료된 타일 키를 완료 큐에 넣습니다.
+
+        실패한 타일은 다시 그릴 때마다 재계산되지 않도록 실패 목록에 기록합니다.
+        """
+        if tile is None:
+            self._failed.add(key)
+            return
+        self._completed.push(key)
+
+    def _on_tiles_ready(self) -> None:
+        """메인 스레드에서 도착한 타일들의 영역을 한 번에 다시 그립니다."""
+        source = self.source
+        dirty = QRectF()
+        for key in self._completed.drain():
+            if key[0] != source.cache_key:
+                continue
+            coord = TileCoord(key[1], key[2], key[3])
+            if coord.level + 1 == source.num_levels:
+                # 가장 거친 타일은 대체 그리기에 쓰이므로 전체를 다시 그린다
+                self.update()
+                return
+            dirty = dirty.united(self._tile_target(coord))
+        if not dirty.isEmpty():
+            self.update(dirty)
@@ -3,33 +3,51 @@
 """
 이미지 뷰어 엔진 모듈입니다.
 PyQt6를 사용하여 이미지를 표시하는 기능을 제공합니다.
+
+뷰어는 여러 이미지를 탭(`ImageTab`)으로 열 수 있으며, 모든 탭이 하나의
+타일 캐시·백그라운드 로더를 공유합니다. 메뉴 동작은 현재 탭에 전달됩니다.
+
+시작 시에는 Qt만 가져와 창 뼈대(탭, 메뉴, 빈 도크)를 먼저 띄웁니다. NumPy,
+OpenCV, Pillow, pyproj를 쓰는 탭·미니맵·썸네일 모듈은 백그라운드 스레드에서
+미리 가져오고, 끝나면 도크 내용과 첫 빈 탭을 만듭니다. 그 전에 영상을 열면
+필요한 모듈을 그 자리에서 가져옵니다.
 """
 
+import importlib
 import os
 import sys
-import numpy as np
-from typing import Optional, Tuple
-from dataclasses import dataclass
+import threading
+from typing import TYPE_CHECKING, Optional, Tuple
+
+from PyQt6.QtWidgets import (QApplication, QMainWindow, QFileDialog, QDockWidget,
+                             QInputDialog, QLabel, QTabWidget)
+from PyQt6.QtGui import QAction, QKeySequence
+from PyQt6.QtCore import Qt, pyqtSignal
+
+if TYPE_CHECKING:
+    from .image_tab import ImageTab
 
-from PyQt6.QtWidgets import (QApplication, QMainWindow, QLabel, QScrollArea, 
-                           QVBoxLayout, QWidget, QSizePolicy, QFileDialog, QStatusBar)
-from PyQt6.QtGui import QPixmap, QImage, QAction, QKeySequence, QPainter
-from PyQt6.QtCore import Qt, QSize, QRectF, pyqtSignal, QPoint, QPointF
-from PyQt6.QtWidgets import QGraphicsView, QGraphicsScene, QGraphicsPixmapItem
+# 창을 띄운 뒤 백그라운드에서 미리 가져올 모듈 (무거운 의존성 포함)
+_DEFERRED_MODULES = (".image_tab", ".minimap", ".thumbnail_browser")
 
-from ..image.image_data import ImageData
 
-@dataclass
-class ImageViewerState:
-    """이미지 뷰어의 현재 상태를 저장하는 데이터 클래스"""
-    scale_factor: float = 1.0
-    rotation: float = 0.0
-    is_flipped_h: bool = False
-    is_flipped_v: bool = False
-    last_mouse_pos: Optional[QPoint] = None
+def _point_ops():
+    """점 연산 모듈을 반환합니다 (조정 메뉴를 처음 쓸 때 가져옴)."""
+    from ..tile import point_ops
+    return point_ops
+
+
+def _filters():
+    """이웃 필터 모듈을 반환합니다 (필터 메뉴를 처음 쓸 때 가져옴)."""
+    from ..tile import filter_pipeline
+    return filter_pipeline
+
 
 class ImageViewer(QMainWindow):
-    """이미지를 표시하고 기본적인 조작을 제공하는 뷰어 클래스"""
+    """이미지를 탭으로 표시하고 기본적인 조작을 제공하는 뷰어 클래스"""
+    
+    # 백그라운드 모듈 가져오기가 끝나면 발생 (메인 스레드로 큐잉됨)
+    _modules_ready = pyqtSignal()
     
     def __init__(self, parent=None):
         super().__init__(parent)
@@ -38,11 +56,6 @@ class ImageViewer(QMainWindow):
         self.setWindowTitle("항공사진 뷰어")
         self.setMinimumSize(800, 600)
         
-        # 상태 초기화
-        self.state = ImageViewerState()
-        self.image_data = None
-        self.pixmap_item = None
-        
         # UI 초기화
         self.init_ui()
         
@@ -51,31 +64,67 @@ class ImageViewer(QMainWindow):
     
     def init_ui(self):
         """사용자 인터페이스 초기화"""
-        # 중앙 위젯과 레이아웃 설정
-        self.central_widget = QWidget()
-        self.setCentralWidget(self.central_widget)
-        
-        # 그래픽 뷰와 씬 설정
-        self.scene = QGraphicsScene(self)
-        self.view = QGraphicsView(self.scene)
-        self.view.setRenderHint(QPainter.RenderHint.SmoothPixmapTransform)
-        self.view.setDragMode(QGraphicsView.DragMode.ScrollHandDrag)
-        self.view.setTransformationAnchor(QGraphicsView.ViewportAnchor.AnchorUnderMouse)
-        self.view.setResizeAnchor(QGraphicsView.ViewportAnchor.AnchorUnderMouse)
-        self.view.setHorizontalScrollBarPolicy(Qt.ScrollBarPolicy.ScrollBarAsNeeded)
-        self.view.setVerticalScrollBarPolicy(Qt.ScrollBarPolicy.ScrollBarAsNeeded)
-        self.view.setFrameShape(QGraphicsView.Shape.NoFrame)
-        
-        # 레이아웃 설정
-        layout = QVBoxLayout(self.central_widget)
-        layout.setContentsMargins(0, 0, 0, 0)
-        layout.addWidget(self.view)
+        # 탭 위젯 설정 (탭마다 이미지 하나)
+        self.tabs = QTabWidget()
+        self.tabs.setTabsClosable(True)
+        self.tabs.setMovable(True)
+        self.tabs.setDocumentMode(True)
+        self.tabs.tabCloseRequested.connect(self.close_tab)
+        self.tabs.currentChanged.connect(self._on_tab_changed)
+        self.setCentralWidget(self.tabs)
+        self._active_tab: Optional["ImageTab"] = None
+        
+        # 미니맵 도크 (가장 거친 피라미드 레벨로 전체 영상 표시, 내용은 지연 생성)
+        self.minimap = None
+        self.minimap_dock = QDockWidget("미니맵", self)
+        self.addDockWidget(Qt.DockWidgetArea.RightDockWidgetArea, self.minimap_dock)
+        
+        # 썸네일 브라우저 도크 (폴더를 열면 표시, 활성화한 영상을 새 탭에서 연다)
+        self.thumbnail_browser = None
+        self.thumbnail_dock = QDockWidget("썸네일", self)
+        self.addDockWidget(Qt.DockWidgetArea.LeftDockWidgetArea, self.thumbnail_dock)
+        self.thumbnail_dock.hide()
         
         # 메뉴 바 설정
         self.create_menus()
         
-        # 상태 표시줄
+        # 상태 표시줄 (커서 좌표는 메시지에 덮이지 않도록 영구 위젯에 표시)
         self.status_bar = self.statusBar()
+        self.coordinate_label = QLabel()
+        self.status_bar.addPermanentWidget(self.coordinate_label)
+        
+        # 무거운 모듈은 창을 띄운 뒤 가져오고, 끝나면 도크와 첫 번째 빈 탭을 만든다
+        self._modules_ready.connect(self._finish_startup)
+        threading.Thread(target=self._import_deferred_modules, name="startup-import",
+                         daemon=True).start()
+    
+    def _import_deferred_modules(self):
+        """탭/미니맵/썸네일 모듈을 백그라운드에서 미리 가져옵니다."""
+        for name in _DEFERRED_MODULES:
+            importlib.import_module(name, __package__)
+        self._modules_ready.emit()
+    
+    def _ensure_docks(self):
+        """미니맵과 썸네일 브라우저를 처음 필요할 때 만듭니다."""
+        if self.minimap is not None:
+            return
+        from .minimap import MinimapWidget
+        from .thumbnail_browser import ThumbnailBrowser
+        
+        self.minimap = MinimapWidget()
+        self.minimap.navigate_requested.connect(
+            lambda point: self.current_tab and self.current_tab.view.centerOn(point))
+        self.minimap_dock.setWidget(self.minimap)
+        
+        self.thumbnail_browser = ThumbnailBrowser()
+        self.thumbnail_browser.image_activated.connect(self.load_image)
+        self.thumbnail_dock.setWidget(self.thumbnail_browser)
+    
+    def _finish_startup(self):
+        """지연 초기화를 마칩니다. 열린 탭이 없으면 첫 번째 빈 탭을 만듭니다."""
+        self._ensure_docks()
+        if self.tabs.count() == 0:
+            self.new_tab()
     
     def create_menus(self):
         """메뉴 바 생성"""
@@ -90,6 +139,42 @@ class ImageViewer(QMainWindow):
         open_action.triggered.connect(self.open_image)
         file_menu.addAction(open_action)
         
+        # 새 탭에서 열기 액션
+        open_tab_action = QAction("새 탭에서 열기...", self)
+        open_tab_action.setShortcut("Ctrl+T")
+        open_tab_action.triggered.connect(lambda: self.open_image(new_tab=True))
+        file_menu.addAction(open_tab_action)
+        
+        # 폴더 열기 액션 (썸네일 브라우저에 폴더의 영상 표시)
+        open_folder_action = QAction("폴더 열기...", self)
+        open_folder_action.setShortcut("Ctrl+Shift+O")
+        open_folder_action.triggered.connect(self.open_folder)
+        file_menu.addAction(open_folder_action)
+        
+        # 탭 닫기 액션
+        close_tab_action = QAction("탭 닫기", self)
+        close_tab_action.setShortcut(QKeySequence.StandardKey.Close)
+        close_tab_action.triggered.connect(lambda: self.close_tab(self.tabs.currentIndex()))
+        file_menu.addAction(close_tab_action)
+        
+        # 비교 영상 열기 액션
+        open_compare_action = QAction("비교 이미지 열기...", self)
+        open_compare_action.triggered.connect(self.open_compare_image)
+        file_menu.addAction(open_compare_action)
+        
+        # 영역 내보내기 액션 (화면에 보이는 영역을 현재 조정과 함께 저장)
+        export_action = QAction("영역 내보내기...", self)
+        export_action.setShortcut("Ctrl+E")
+        export_action.triggered.connect(self.export_region)
+        file_menu.addAction(export_action)
+        
+        # COG 저장 액션 (영상 전체를 내부 오버뷰가 있는 COG로 저장)
+        export_cog_action = QAction("COG로 저장...", self)
+        export_cog_action.triggered.connect(self.export_cog)
+        file_menu.addAction(export_cog_action)
+        
+        file_menu.addSeparator()
+        
         # 종료 액션
         exit_action = QAction("종료", self)
         exit_action.setShortcut(QKeySequence.StandardKey.Quit)
@@ -121,135 +206,393 @@ class ImageViewer(QMainWindow):
         fit_to_window_action = QAction("창에 맞추기", self)
         fit_to_window_action.triggered.connect(self.fit_to_window)
         view_menu.addAction(fit_to_window_action)
+        
+        view_menu.addSeparator()
+        
+        # 비교 모드 액션
+        side_by_side_action = QAction("비교: 나란히 보기", self)
+        side_by_side_action.triggered.connect(lambda: self.set_compare_mode('side'))
+        view_menu.addAction(side_by_side_action)
+        
+        swipe_action = QAction("비교: 스와이프", self)
+        swipe_action.triggered.connect(lambda: self.set_compare_mode('swipe'))
+        view_menu.addAction(swipe_action)
+        
+        compare_off_action = QAction("비교 끄기", self)
+        compare_off_action.triggered.connect(lambda: self.set_compare_mode('off'))
+        view_menu.addAction(compare_off_action)
+        
+        view_menu.addSeparator()
+        
+        # 재투영 액션 (화면에 보이는 타일만 대상 좌표계로 변환)
+        reproject_action = QAction("좌표계 재투영...", self)
+        reproject_action.triggered.connect(lambda: self.reproject())
+        view_menu.addAction(reproject_action)
+        
+        reproject_off_action = QAction("원본 좌표계", self)
+        reproject_off_action.triggered.connect(lambda: self.reproject(''))
+        view_menu.addAction(reproject_off_action)
+        
+        view_menu.addSeparator()
+        
+        # 미니맵 표시 토글
+        minimap_action = self.minimap_dock.toggleViewAction()
+        minimap_action.setText("미니맵")
+        view_menu.addAction(minimap_action)
+        
+        thumbnail_action = self.thumbnail_dock.toggleViewAction()
+        thumbnail_action.setText("썸네일")
+        view_menu.addAction(thumbnail_action)
+        
+        # 조정 메뉴 (점 연산은 한 번의 메모리 패스로 융합되어 적용)
+        adjust_menu = menubar.addMenu("조정")
+        
+        gamma_action = QAction("감마 보정 (2.2)", self)
+        gamma_action.triggered.connect(lambda: self.add_adjustment(_point_ops().GammaOp(2.2)))
+        adjust_menu.addAction(gamma_action)
+        
+        contrast_action = QAction("대비 강화", self)
+        contrast_action.triggered.connect(lambda: self.add_adjustment(_point_ops().ContrastOp(1.3)))
+        adjust_menu.addAction(contrast_action)
+        
+        saturation_action = QAction("채도 강화", self)
+        saturation_action.triggered.connect(
+            lambda: self.add_adjustment(_point_ops().ColorMatrixOp.saturation(1.3)))
+        adjust_menu.addAction(saturation_action)
+        
+        false_color_action = QAction("의사 컬러", self)
+        false_color_action.triggered.connect(
+            lambda: self.add_adjustment(_point_ops().FalseColorOp()))
+        adjust_menu.addAction(false_color_action)
+        
+        adjust_menu.addSeparator()
+        
+        clear_adjust_action = QAction("조정 해제", self)
+        clear_adjust_action.triggered.connect(self.clear_adjustments)
+        adjust_menu.addAction(clear_adjust_action)
+        
+        # 밴드 메뉴 (다중분광 합성/지수는 화면에 보이는 타일만 계산)
+        band_menu = menubar.addMenu("밴드")
+        
+        composite_action = QAction("RGB 밴드 합성...", self)
+        composite_action.triggered.connect(lambda: self.show_band_composite())
+        band_menu.addAction(composite_action)
+        
+        ndvi_action = QAction("NDVI...", self)
+        ndvi_action.triggered.connect(lambda: self.show_ndvi())
+        band_menu.addAction(ndvi_action)
+        
+        band_menu.addSeparator()
+        
+        original_band_action = QAction("원본 밴드", self)
+        original_band_action.triggered.connect(self.show_original_bands)
+        band_menu.addAction(original_band_action)
+        
+        # 필터 메뉴 (화면에 보이는 타일에만 지연 적용)
+        filter_menu = menubar.addMenu("필터")
+        
+        sharpen_action = QAction("샤프닝", self)
+        sharpen_action.triggered.connect(lambda: self.set_filters([_filters().SharpenFilter()]))
+        filter_menu.addAction(sharpen_action)
+        
+        blur_action = QAction("블러", self)
+        blur_action.triggered.connect(lambda: self.set_filters([_filters().GaussianBlurFilter()]))
+        filter_menu.addAction(blur_action)
+        
+        filter_menu.addSeparator()
+        
+        clear_filter_action = QAction("필터 해제", self)
+        clear_filter_action.triggered.connect(lambda: self.set_filters([]))
+        filter_menu.addAction(clear_filter_action)
+    
+    @property
+    def current_tab(self) -> Optional["ImageTab"]:
+        """현재 선택된 탭을 반환합니다."""
+        return self.tabs.currentWidget()
+    
+    # 단일 이미지 API 호환용 속성 (현재 탭에 위임)
+    @property
+    def view(self):
+        return self.current_tab.view if self.current_tab else None
     
-    def open_image(self):
-        """이미지 파일 열기"""
+    @property
+    def image_item(self):
+        return self.current_tab.image_item if self.current_tab else None
+    
+    @property
+    def image_data(self):
+        return self.current_tab.image_data if self.current_tab else None
+    
+    @property
+    def filter_pipeline(self):
+        return self.current_tab.filter_pipeline if self.current_tab else None
+    
+    @property
+    def state(self):
+        from .image_tab import ImageViewerState
+        return self.current_tab.state if self.current_tab else ImageViewerState()
+    
+    def new_tab(self) -> "ImageTab":
+        """빈 탭을 만들어 선택합니다."""
+        from .image_tab import ImageTab
+        
+        self._ensure_docks()
+        tab = ImageTab()
+        tab.status_message.connect(self._on_tab_status)
+        tab.pipeline_changed.connect(lambda t=tab: self._on_pipeline_changed(t))
+        tab.viewport_changed.connect(lambda t=tab: self._on_viewport_changed(t))
+        tab.coordinate_readout.text_changed.connect(
+            lambda text, t=tab: t is self.current_tab and self.coordinate_label.setText(text))
+        index = self.tabs.addTab(tab, tab.title)
+        self.tabs.setCurrentIndex(index)
+        return tab
+    
+    def close_tab(self, index: int):
+        """탭을 닫고 해당 탭의 캐시 타일과 고정을 해제합니다.
+        
+        Args:
+            index: 닫을 탭 인덱스
+        """
+        tab = self.tabs.widget(index)
+        if tab is None:
+            return
+        tab.release()
+        if tab is self._active_tab:
+            self._active_tab = None
+        self.tabs.removeTab(index)
+        tab.deleteLater()
+        if self.tabs.count() == 0:
+            self.new_tab()
+    
+    def _on_tab_changed(self, index: int):
+        """탭 전환 시 이전 탭을 백그라운드로 내리고 새 탭을 활성화합니다."""
+        tab = self.tabs.widget(index)
+        if self._active_tab is not None and self._active_tab is not tab:
+            self._active_tab.deactivate()
+        self._active_tab = tab
+        if tab is None:
+            return
+        tab.activate()
+        self.coordinate_label.clear()
+        self.minimap.set_source(tab.filter_pipeline)
+        self._on_viewport_changed(tab)
+        if tab.image_item is not None:
+            self.status_bar.showMessage(tab.zoom_message())
+    
+    def _on_tab_status(self, message: str):
+        """탭이 보낸 메시지를 상태 표시줄에 표시합니다 (현재 탭만)."""
+        if self.sender() is self.current_tab:
+            self.status_bar.showMessage(message)
+    
+    def _on_pipeline_changed(self, tab: "ImageTab"):
+        """탭의 파이프라인이 바뀌면 제목과 미니맵을 갱신합니다."""
+        self.tabs.setTabText(self.tabs.indexOf(tab), tab.title)
+        if tab is self.current_tab:
+            self.minimap.set_source(tab.filter_pipeline)
+    
+    def _on_viewport_changed(self, tab: "ImageTab"):
+        """현재 탭의 뷰포트 사각형을 미니맵에 반영합니다."""
+        if tab is self.current_tab and tab.image_item is not None:
+            self.minimap.set_view_rect(tab.visible_rect())
+    
+    def _with_tab(self, action):
+        """현재 탭이 있으면 동작을 실행합니다."""
+        tab = self.current_tab
+        if tab is not None:
+            action(tab)
+    
+    def open_image(self, new_tab: bool = False):
+        """이미지 파일 열기
+        
+        Args:
+            new_tab: True이면 항상 새 탭에서 연다
+        """
         file_name, _ = QFileDialog.getOpenFileName(
             self, 
             "이미지 열기", 
             "", 
-            "이미지 파일 (*.png *.jpg *.jpeg *.bmp *.tif *.tiff);;모든 파일 (*.*)"
+            "이미지 파일 (*.png *.jpg *.jpeg *.bmp *.tif *.tiff);;"
+            "모자이크 매니페스트 (*.json *.yaml *.yml);;모든 파일 (*.*)"
         )
         
         if file_name:
-            self.load_image(file_name)
+            self.load_image(file_name, new_tab)
+    
+    def open_folder(self, directory: Optional[str] = None):
+        """폴더의 영상을 썸네일 브라우저에 표시합니다.
+        
+        Args:
+            directory: 폴더 경로. None이면 사용자에게 선택받는다
+        """
+        if directory is None:
+            directory = QFileDialog.getExistingDirectory(self, "폴더 열기")
+            if not directory:
+                return
+        self._ensure_docks()
+        try:
+            count = self.thumbnail_browser.set_directory(directory)
+        except Exception as e:
+            self.status_bar.showMessage(f"오류: {str(e)}")
+            return
+        self.thumbnail_dock.show()
+        self.status_bar.showMessage(f"{directory}: 영상 {count}개")
     
-    def load_image(self, file_path: str):
-        """이미지 파일을 로드하여 표시"""
+    def load_image(self, file_path: str, new_tab: bool = True):
+        """이미지 파일을 로드하여 표시
+        
+        현재 탭이 비어 있으면 그 탭에, 아니면 새 탭에 엽니다.
+        
+        Args:
+            file_path: 이미지 파일 경로
+            new_tab: False이면 현재 탭의 이미지를 교체한다
+        """
+        tab = self.current_tab
+        if tab is None or (new_tab and tab.image_item is not None):
+            tab = self.new_tab()
         try:
-            # 이미지 데이터 로드
-            self.image_data = ImageData()
-            self.image_data.load(file_path)
-            
-            # OpenCV 이미지를 QImage로 변환
-            height, width, channel = self.image_data.data.shape
-            bytes_per_line = 3 * width
-            
-            # BGR을 RGB로 변환 (OpenCV는 BGR, QImage는 RGB 사용)
-            rgb_image = self.image_data.data[..., ::-1]  # BGR to RGB
-            
-            qimage = QImage(
-                rgb_image.data, 
-                width, 
-                height, 
-                bytes_per_line, 
-                QImage.Format.Format_RGB888
-            )
-            
-            # QPixmap으로 변환
-            pixmap = QPixmap.fromImage(qimage)
-            
-            # 기존 씬 정리
-            self.scene.clear()
-            
-            # 새 픽스맵 아이템 생성 및 추가
-            self.pixmap_item = QGraphicsPixmapItem(pixmap)
-            self.scene.addItem(self.pixmap_item)
-            
-            # 뷰 리셋
-            self.view.resetTransform()
-            self.state.scale_factor = 1.0
-            self.state.rotation = 0.0
-            
-            # 상태 표시줄 업데이트
-            self.status_bar.showMessage(f"로드 완료: {os.path.basename(file_path)} ({width}x{height})")
-            
-            # 창에 맞게 조정
-            self.fit_to_window()
-            
+            tab.load_image(file_path)
         except Exception as e:
             self.status_bar.showMessage(f"오류: {str(e)}")
     
+    def open_compare_image(self):
+        """비교할 이미지 파일 열기"""
+        file_name, _ = QFileDialog.getOpenFileName(
+            self, 
+            "비교 이미지 열기", 
+            "", 
+            "이미지 파일 (*.png *.jpg *.jpeg *.bmp *.tif *.tiff);;모든 파일 (*.*)"
+        )
+        
+        if file_name:
+            self.load_compare_image(file_name)
+    
+    def export_region(self):
+        """현재 탭의 보이는 영역을 선택한 해상도로 파일에 내보냅니다."""
+        tab = self.current_tab
+        if tab is None or tab.image_item is None:
+            return
+        cog_filter = "Cloud Optimized GeoTIFF (*.tif)"
+        file_name, selected_filter = QFileDialog.getSaveFileName(
+            self,
+            "영역 내보내기",
+            "",
+            f"타일 TIFF (*.tif);;{cog_filter};;PNG (*.png);;JPEG (*.jpg)"
+        )
+        if not file_name:
+            return
+        scale, ok = QInputDialog.getDouble(self, "영역 내보내기", "출력 배율 (원본 = 1.0):",
+                                           1.0, 0.01, 8.0, 3)
+        if not ok:
+            return
+        if selected_filter != cog_filter:
+            tab.export_region(file_name, scale)
+            return
+        compression, ok = QInputDialog.getItem(self, "영역 내보내기", "압축 방식:",
+                                               ["deflate", "zstd", "jpeg", "webp", "none"],
+                                               0, False)
+        if ok:
+            tab.export_region(file_name, scale, format="cog", compression=compression)
+    
+    def export_cog(self):
+        """현재 탭의 영상 전체를 Cloud Optimized GeoTIFF로 저장합니다."""
+        tab = self.current_tab
+        if tab is None or tab.image_item is None:
+            return
+        file_name, _ = QFileDialog.getSaveFileName(
+            self,
+            "COG로 저장",
+            "",
+            "Cloud Optimized GeoTIFF (*.tif)"
+        )
+        if not file_name:
+            return
+        compression, ok = QInputDialog.getItem(self, "COG로 저장", "압축 방식:",
+                                               ["deflate", "zstd", "jpeg", "webp", "none"],
+                                               0, False)
+        if ok:
+            tab.export_cog(file_name, compression)
+    
+    def load_compare_image(self, file_path: str, mode: str = 'side'):
+        """현재 탭에 비교 이미지를 로드합니다."""
+        self._with_tab(lambda tab: tab.load_compare_image(file_path, mode))
+    
+    def set_compare_mode(self, mode: str):
+        """현재 탭의 비교 모드를 전환합니다."""
+        self._with_tab(lambda tab: tab.set_compare_mode(mode))
+    
+    def reproject(self, target_crs: Optional[str] = None):
+        """현재 탭을 다른 좌표계로 재투영해 표시합니다.
+        
+        Args:
+            target_crs: 대상 좌표계. None이면 사용자에게 입력받고, 빈 문자열이면 원본 좌표계
+        """
+        if target_crs is None:
+            target_crs, ok = QInputDialog.getText(self, "좌표계 재투영",
+                                                  "대상 좌표계 (예: EPSG:4326):",
+                                                  text="EPSG:4326")
+            if not ok:
+                return
+        target_crs = target_crs.strip() or None
+        self._with_tab(lambda tab: tab.reproject(target_crs))
+    
     def wheelEvent(self, event):
         """마우스 휠 이벤트 핸들러 (줌 기능)"""
-        if self.pixmap_item is None:
-            return
-            
         # 휠 델타에 따라 확대/축소
         zoom_factor = 1.15  # 15% 씩 확대/축소
-        
-        if event.angleDelta().y() > 0:
-            # 확대
-            self.view.scale(zoom_factor, zoom_factor)
-            self.state.scale_factor *= zoom_factor
-        else:
-            # 축소
-            self.view.scale(1.0 / zoom_factor, 1.0 / zoom_factor)
-            self.state.scale_factor /= zoom_factor
-        
-        self.update_status_bar()
+        factor = zoom_factor if event.angleDelta().y() > 0 else 1.0 / zoom_factor
+        self._with_tab(lambda tab: tab.zoom_by(factor))
     
     def zoom_in(self):
         """이미지 확대"""
-        if self.pixmap_item:
-            self.view.scale(1.25, 1.25)
-            self.state.scale_factor *= 1.25
-            self.update_status_bar()
+        self._with_tab(lambda tab: tab.zoom_in())
     
     def zoom_out(self):
         """이미지 축소"""
-        if self.pixmap_item:
-            self.view.scale(0.8, 0.8)
-            self.state.scale_factor *= 0.8
-            self.update_status_bar()
+        self._with_tab(lambda tab: tab.zoom_out())
     
     def normal_size(self):
         """이미지를 원본 크기로 표시"""
-        if self.pixmap_item:
-            self.view.resetTransform()
-            self.state.scale_factor = 1.0
-            self.update_status_bar()
+        self._with_tab(lambda tab: tab.normal_size())
     
     def fit_to_window(self):
         """이미지를 창에 맞게 조정"""
-        if self.pixmap_item:
-            # 뷰포트 크기 가져오기
-            view_rect = self.view.viewport().rect()
-            view_size = view_rect.size()
-            
-            # 이미지 크기 가져오기
-            pixmap_size = self.pixmap_item.pixmap().size()
-            
-            # 종횡비 유지하며 맞출 스케일 계산
-            scale_x = view_size.width() / pixmap_size.width()
-            scale_y = view_size.height() / pixmap_size.height()
-            scale = min(scale_x, scale_y) * 0.95  # 약간의 여백 추가
-            
-            # 변환 적용
-            self.view.resetTransform()
-            self.view.scale(scale, scale)
-            self.state.scale_factor = scale
-            
-            # 이미지를 뷰포트 중앙에 배치
-            self.view.centerOn(self.pixmap_item)
-            
-            self.update_status_bar()
+        self._with_tab(lambda tab: tab.fit_to_window())
+    
+    def set_filters(self, stages):
+        """현재 탭의 이웃 필터 단계를 교체합니다."""
+        self._with_tab(lambda tab: tab.set_filters(stages))
+    
+    def add_adjustment(self, op):
+        """현재 탭에 점 연산 조정을 추가합니다."""
+        self._with_tab(lambda tab: tab.add_adjustment(op))
+    
+    def clear_adjustments(self):
+        """현재 탭의 점 연산 조정을 해제합니다."""
+        self._with_tab(lambda tab: tab.clear_adjustments())
+    
+    def show_band_composite(self, bands: Optional[Tuple[int, int, int]] = None):
+        """현재 탭에 밴드 합성을 표시합니다."""
+        self._with_tab(lambda tab: tab.show_band_composite(bands))
+    
+    def show_ndvi(self, bands: Optional[Tuple[int, int]] = None):
+        """현재 탭에 NDVI를 표시합니다."""
+        self._with_tab(lambda tab: tab.show_ndvi(bands))
+    
+    def show_original_bands(self):
+        """현재 탭의 밴드 합성을 해제합니다."""
+        self._with_tab(lambda tab: tab.show_original_bands())
+    
+    def closeEvent(self, event):
+        """창을 닫을 때 썸네일 작업자를 정리합니다."""
+        if self.thumbnail_browser is not None:
+            self.thumbnail_browser.shutdown()
+        super().closeEvent(event)
     
     def update_status_bar(self):
         """상태 표시줄 업데이트"""
-        if self.pixmap_item:
-            zoom_percent = int(self.state.scale_factor * 100)
-            self.status_bar.showMessage(f"확대율: {zoom_percent}% | 회전: {int(self.state.rotation)}°")
+        tab = self.current_tab
+        if tab is not None and tab.image_item:
+            self.status_bar.showMessage(tab.zoom_message())
 
 def main():
     """애플리케이션 진입점"""
@@ -4,4 +4,56 @@
 이 모듈은 대용량 이미지를 효율적으로 표시하기 위한 타일 생성 및 관리 기능을 제공합니다.
 """
 
-__all__ = []
+from ...utils.lazy_import import lazy_exports
+
+# 공개 이름은 처음 사용할 때 해당 하위 모듈만 가져온다 (시작 시간 단축)
+__getattr__, __dir__ = lazy_exports(__name__, {
+    'BackgroundLoader': '.background_loader',
+    'get_shared_loader': '.background_loader',
+    'BandCompositeSource': '.band_composite',
+    'BandIndexSource': '.band_composite',
+    'BandStretch': '.band_composite',
+    'band_statistics': '.band_composite',
+    'normalized_difference': '.band_composite',
+    'AsyncImage': '.async_source',
+    'open_image': '.async_source',
+    'open_images': '.async_source',
+    'write_cog': '.cog_writer',
+    'DecodePool': '.decode_pool',
+    'get_shared_decode_pool': '.decode_pool',
+    'FilterPipeline': '.filter_pipeline',
+    'FilterStage': '.filter_pipeline',
+    'GaussianBlurFilter': '.filter_pipeline',
+    'MedianFilter': '.filter_pipeline',
+    'SharpenFilter': '.filter_pipeline',
+    'ColorMatrixOp': '.point_ops',
+    'ContrastOp': '.point_ops',
+    'FalseColorOp': '.point_ops',
+    'GammaOp': '.point_ops',
+    'IccTransformOp': '.point_ops',
+    'PointOp': '.point_ops',
+    'WhiteBalanceOp': '.point_ops',
+    'compile_point_ops': '.point_ops',
+    'MosaicFrame': '.mosaic',
+    'MosaicSource': '.mosaic',
+    'ImagePyramid': '.pyramid',
+    'RegionSource': '.region_export',
+    'export_region': '.region_export',
+    'ReprojectedSource': '.reproject',
+    'suggest_warp_output': '.reproject',
+    'TileCoord': '.tile',
+    'TileCache': '.tile_cache',
+    'get_shared_cache': '.tile_cache',
+    'TileSource': '.tile_source',
+})
+
+__all__ = [
+    'BackgroundLoader', 'get_shared_loader', 'BandCompositeSource', 'BandIndexSource',
+    'BandStretch', 'band_statistics', 'normalized_difference', 'AsyncImage', 'open_image',
+    'open_images', 'write_cog', 'DecodePool', 'get_shared_decode_pool',
+    'FilterPipeline', 'FilterStage', 'GaussianBlurFilter', 'MedianFilter',
+    'SharpenFilter', 'ColorMatrixOp', 'ContrastOp', 'FalseColorOp', 'GammaOp',
+    'IccTransformOp', 'PointOp', 'WhiteBalanceOp', 'compile_point_ops', 'MosaicFrame',
+    'MosaicSource', 'ImagePyramid', 'RegionSource', 'export_region', 'ReprojectedSource',
+    'suggest_warp_output', 'TileCoord', 'TileCache', 'get_shared_cache', 'TileSource',
+]
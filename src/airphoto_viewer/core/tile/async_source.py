@@ -0,0 +1,213 @@
+"""
+스크립트와 헤드리스 분석을 위한 asyncio 로딩 API 모듈입니다.
+
+GUI 밖에서 여러 영상의 영역을 asyncio로 동시에 읽을 수 있도록, 영상 열기와
+영역/타일 읽기를 실행기(executor)에서 실행하고 결과를 기다릴 수 있게 합니다.
+디코딩은 OpenCV/네이티브 커널처럼 GIL을 해제하므로 실행기 스레드 수만큼
+병렬로 진행되며, 모자이크 프레임은 공유 디코딩 풀이 켜져 있으면 작업자
+프로세스에서 디코딩합니다.
+
+사용 예::
+
+    async with await open_image("ortho.tif") as image:
+        region = await image.read_region(0, 1000, 1000, 512, 512)
+        async for coord, tile in image.tiles(level=2):
+            ...
+"""
+
+import asyncio
+import os
+from concurrent.futures import Executor, ThreadPoolExecutor
+from typing import AsyncIterator, Callable, List, Optional, Tuple, TypeVar
+
+import numpy as np
+
+from ..image.image_data import ImageData
+from ..image.thumbnails import get_shared_thumbnail_database
+from .decode_pool import get_shared_decode_pool
+from .mosaic import MOSAIC_EXTENSIONS, MosaicSource
+from .pyramid import ImagePyramid
+from .tile import TileCoord
+from .tile_cache import TileCache
+from .tile_source import TileSource
+
+T = TypeVar("T")
+
+# 영상 열기·영역 읽기에 쓰는 기본 실행기 (처음 사용할 때 생성)
+_default_executor: Optional[ThreadPoolExecutor] = None
+
+
+def get_default_executor() -> ThreadPoolExecutor:
+    """비동기 API가 기본으로 쓰는 스레드 풀을 반환합니다.
+
+    디스크 대기와 GIL을 해제하는 디코딩이 섞이므로 코어 수보다 넉넉하게 잡습니다.
+    """
+    global _default_executor
+    if _default_executor is None:
+        _default_executor = ThreadPoolExecutor(
+            max_workers=min(32, 2 * (os.cpu_count() or 1) + 4),
+            thread_name_prefix="async-tile")
+    return _default_executor
+
+
+class AsyncImage:
+    """타일 소스를 기다릴 수 있는 메서드로 감싼 영상입니다.
+
+    속성:
+        source (TileSource): 픽셀을 제공하는 타일 소스
+        image_data (Optional[ImageData]): 원본 이미지 데이터 (모자이크는 None)
+        path (str): 영상 또는 매니페스트 경로
+    """
+
+    def __init__(self, source: TileSource, path: str,
+                 image_data: Optional[ImageData] = None,
+                 executor: Optional[Executor] = None):
+        """AsyncImage 인스턴스를 초기화합니다.
+
+        Args:
+            source: 타일 소스
+            path: 영상 또는 매니페스트 경로
+            image_data: 원본 이미지 데이터
+            executor: 블로킹 읽기를 실행할 실행기. None인 경우 기본 스레드 풀
+        """
+        self.source = source
+        self.path = path
+        self.image_data = image_data
+        self._executor = executor or get_default_executor()
+
+    @property
+    def size(self) -> Tuple[int, int]:
+        """레벨 0 (너비, 높이)"""
+        return self.source.width, self.source.height
+
+    @property
+    def num_levels(self) -> int:
+        return self.source.num_levels
+
+    async def _run(self, func: Callable[..., T], *args) -> T:
+        return await asyncio.get_running_loop().run_in_executor(self._executor, func, *args)
+
+    async def read_region(self, level: int, x: int, y: int, w: int, h: int) -> np.ndarray:
+        """레벨 좌표계의 사각형 영역 픽셀을 읽습니다.
+
+        Args:
+            level: 피라미드 레벨
+            x, y: 좌상단 좌표
+            w, h: 영역 크기
+
+        Returns:
+            np.ndarray: (h, w[, channels]) 형태의 읽기 전용 픽셀 배열.
+                수정하려면 복사해서 사용합니다.
+
+        Raises:
+            ValueError: 영역이 레벨 경계를 벗어난 경우
+        """
+        self.source.check_region(level, x, y, w, h)
+        # 피라미드 레벨 메모리를 가리킬 수 있으므로 쓰기 불가 뷰로 돌려준다
+        return await self._run(self.source.region_view, level, x, y, w, h)
+
+    async def get_tile(self, coord: TileCoord) -> np.ndarray:
+        """타일을 읽습니다 (타일 캐시를 거침).
+
+        반환값은 캐시 메모리 위의 읽기 전용 뷰이며, 뷰가 살아 있는 동안 타일은
+        캐시에서 축출되지 않습니다. 수정하려면 복사해서 사용합니다.
+        """
+        if self.source.cached_tile(coord) is not None:
+            return self.source.tile_view(coord)
+        return await self._run(self.source.tile_view, coord)
+
+    async def tiles(self, level: int,
+                    rect: Optional[Tuple[float, float, float, float]] = None,
+                    concurrency: int = 16) -> AsyncIterator[Tuple[TileCoord, np.ndarray]]:
+        """레벨의 타일을 완료되는 순서대로 내보내는 비동기 반복자입니다.
+
+        동시에 진행하는 읽기는 concurrency개로 제한되며, 반복을 중단하면 아직
+        시작하지 않은 읽기는 취소됩니다.
+
+        Args:
+            level: 피라미드 레벨
+            rect: 레벨 0 좌표 (x0, y0, x1, y1). None인 경우 전체 영상
+            concurrency: 동시에 진행할 최대 읽기 수
+
+        Yields:
+            Tuple[TileCoord, np.ndarray]: 타일 좌표와 픽셀
+        """
+        if rect is None:
+            rect = (0, 0, self.source.width, self.source.height)
+        coords = iter(self.source.tiles_in_rect(level, *rect))
+        running = set()
+
+        async def read(coord: TileCoord):
+            return coord, await self.get_tile(coord)
+
+        def refill() -> None:
+            while len(running) < max(1, concurrency):
+                coord = next(coords, None)
+                if coord is None:
+                    return
+                running.add(asyncio.ensure_future(read(coord)))
+
+        refill()
+        try:
+            while running:
+                done, _ = await asyncio.wait(running, return_when=asyncio.FIRST_COMPLETED)
+                for task in done:
+                    running.discard(task)
+                    refill()
+                    yield task.result()
+        finally:
+            for task in running:
+                task.cancel()
+
+    def close(self) -> None:
+        """캐시 타일과 원본 픽셀, 디코딩해 둔 배열을 해제합니다."""
+        self.source.cache.invalidate_source(self.source.cache_key)
+        if isinstance(self.source, (ImagePyramid, MosaicSource)):
+            self.source.release()
+
+    async def __aenter__(self) -> "AsyncImage":
+        return self
+
+    async def __aexit__(self, *exc) -> None:
+        self.close()
+
+
+def _open_source(path: str, cache: Optional[TileCache]
+                 ) -> Tuple[TileSource, Optional[ImageData]]:
+    """영상이나 모자이크 매니페스트를 열어 타일 소스를 만듭니다 (블로킹)."""
+    if os.path.splitext(path)[1].lower() in MOSAIC_EXTENSIONS:
+        return MosaicSource.from_manifest(path, cache,
+                                          decode_pool=get_shared_decode_pool(),
+                                          thumbnails=get_shared_thumbnail_database()), None
+    image_data = ImageData()
+    image_data.load(path)
+    return ImagePyramid(image_data, cache=cache), image_data
+
+
+async def open_image(path: str, cache: Optional[TileCache] = None,
+                     executor: Optional[Executor] = None) -> AsyncImage:
+    """영상 또는 모자이크 매니페스트를 비동기로 엽니다.
+
+    Args:
+        path: 영상 또는 매니페스트 경로
+        cache: 사용할 타일 캐시. None인 경우 공유 캐시 사용
+        executor: 블로킹 읽기를 실행할 실행기. None인 경우 기본 스레드 풀
+
+    Returns:
+        AsyncImage: 열린 영상
+
+    Raises:
+        FileNotFoundError: 파일이 존재하지 않는 경우
+        IOError: 이미지 로딩에 실패한 경우
+        ValueError: 매니페스트 형식이 잘못된 경우
+    """
+    executor = executor or get_default_executor()
+    source, image_data = await asyncio.get_running_loop().run_in_executor(
+        executor, _open_source, path, cache)
+    return AsyncImage(source, path, image_data, executor)
+
+
+async def open_images(paths: List[str], cache: Optional[TileCache] = None,
+                      executor: Optional[Executor] = None) -> List[AsyncImage]:
+    """여러 영상을 동시에 엽니다. 하나라도 실패하면 예외를 전달합니다."""
+    return list(await asyncio.gather(*(open_image(path, cache, executor) for path in paths)))
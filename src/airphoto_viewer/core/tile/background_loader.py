@@ -0,0 +1,151 @@
+"""
+우선순위 기반 백그라운드 타일 로더 모듈입니다.
+
+작업자 스레드 풀이 우선순위 큐에서 작업을 꺼내 실행합니다. 같은 키의
+작업은 한 번만 대기열에 들어가며, 화면에서 벗어난 요청은 취소할 수 있습니다.
+실패한 작업은 로그에 남기고 콜백에 결과 None으로 알려 호출자가 대기 상태를
+정리할 수 있게 합니다.
+OpenCV/NumPy 연산은 GIL을 해제하므로 스레드만으로도 병렬 처리가 됩니다.
+"""
+
+import heapq
+import itertools
+import logging
+import os
+import threading
+from typing import Any, Callable, Dict, Hashable, List, Optional
+
+logger = logging.getLogger(__name__)
+
+
+class BackgroundLoader:
+    """우선순위 큐를 사용하는 작업자 스레드 풀입니다.
+
+    우선순위 값이 작을수록 먼저 실행됩니다.
+    """
+
+    def __init__(self, max_workers: Optional[int] = None):
+        """BackgroundLoader 인스턴스를 초기화합니다.
+
+        Args:
+            max_workers: 작업자 스레드 수. None인 경우 CPU 코어 수 사용
+        """
+        self._heap: List[tuple] = []
+        self._pending: Dict[Hashable, list] = {}
+        self._counter = itertools.count()
+        self._cond = threading.Condition()
+        self._shutdown = False
+        self._workers = []
+        for index in range(max_workers or os.cpu_count() or 4):
+            worker = threading.Thread(target=self._run, name=f"tile-loader-{index}",
+                                      daemon=True)
+            worker.start()
+            self._workers.append(worker)
+
+    def queue_tile_load(self, key: Hashable, load: Callable[[], Any],
+                        priority: float = 0.0,
+                        callback: Optional[Callable[[Hashable, Any], None]] = None) -> bool:
+        """작업을 대기열에 추가합니다.
+
+        같은 키가 이미 대기 중이면 콜백만 추가하고, 더 높은 우선순위로 갱신합니다.
+
+        Args:
+            key: 작업 식별 키 (일반적으로 타일 캐시 키)
+            load: 작업자 스레드에서 실행할 함수
+            priority: 우선순위 (작을수록 먼저 실행)
+            callback: 작업 완료 시 (key, 결과)로 호출되는 함수. 작업자 스레드에서 호출되며,
+                작업이 예외로 실패하면 결과는 None입니다.
+
+        Returns:
+            bool: 새로 대기열에 추가되었으면 True
+        """
+        with self._cond:
+            entry = self._pending.get(key)
+            if entry is not None:
+                if callback is not None:
+                    entry[4].append(callback)
+                if priority < entry[0]:
+                    # 기존 항목을 무효화하고 더 높은 우선순위로 다시 넣는다
+                    entry[-1] = False
+                    self._push_locked(key, entry[3], priority, entry[4])
+                return False
+            self._push_locked(key, load, priority, [callback] if callback else [])
+            return True
+
+    def cancel_pending_requests(self, predicate: Optional[Callable[[Hashable], bool]] = None) -> int:
+        """아직 시작되지 않은 작업을 취소합니다.
+
+        Args:
+            predicate: 키를 받아 취소 여부를 반환하는 함수. None이면 전체 취소
+
+        Returns:
+            int: 취소된 작업 수
+        """
+        with self._cond:
+            doomed = [key for key in self._pending if predicate is None or predicate(key)]
+            for key in doomed:
+                self._pending.pop(key)[-1] = False
+            return len(doomed)
+
+    def is_pending(self, key: Hashable) -> bool:
+        """키의 작업이 대기 중인지 여부를 반환합니다."""
+        with self._cond:
+            return key in self._pending
+
+    def shutdown(self, wait: bool = False) -> None:
+        """대기 중인 작업을 버리고 작업자 스레드를 종료합니다.
+
+        Args:
+            wait: True이면 실행 중인 작업이 끝날 때까지 기다린다
+        """
+        with self._cond:
+            self._shutdown = True
+            self._pending.clear()
+            self._heap.clear()
+            self._cond.notify_all()
+        if wait:
+            for worker in self._workers:
+                worker.join()
+
+    def _push_locked(self, key, load, priority, callbacks) -> None:
+        entry = [priority, next(self._counter), key, load, callbacks, True]
+        self._pending[key] = entry
+        heapq.heappush(self._heap, entry)
+        self._cond.notify()
+
+    def _run(self) -> None:
+        """작업자 스레드 루프"""
+        while True:
+            with self._cond:
+                while not self._heap and not self._shutdown:
+                    self._cond.wait()
+                if self._shutdown:
+                    return
+                entry = heapq.heappop(self._heap)
+                _, _, key, load, callbacks, alive = entry
+                if not alive:
+                    continue
+                self._pending.pop(key, None)
+            try:
+                result = load()
+            except Exception:
+                logger.exception("백그라운드 작업이 실패했습니다: %r", key)
+                result = None
+            for callback in callbacks:
+                try:
+                    callback(key, result)
+                except Exception:
+                    logger.exception("백그라운드 작업 콜백이 실패했습니다: %r", key)
+
+
+_shared_loader: Optional[BackgroundLoader] = None
+_shared_lock = threading.Lock()
+
+
+def get_shared_loader() -> BackgroundLoader:
+    """애플리케이션 전체가 공유하는 기본 백그라운드 로더를 반환합니다."""
+    global _shared_loader
+    with _shared_lock:
+        if _shared_loader is None:
+            _shared_loader = BackgroundLoader()
+        return _shared_loader
@@ -0,0 +1,217 @@
+"""
+다중분광 밴드 합성 및 분광 지수 타일 소스 모듈입니다.
+
+4~8밴드 다중분광 영상에서 임의의 3개 밴드를 RGB로 합성하거나, NDVI 같은
+정규화 차이 지수를 타일 단위로 계산해 컬러맵으로 표시합니다. 파생 래스터를
+전체 해상도로 만들지 않고, 화면에 보이는 타일만 원본 피라미드 타일에서
+계산합니다. 캐시 키에 밴드 조합이 포함되므로 이전 조합으로 되돌아가면
+캐시된 타일이 즉시 재사용됩니다. 표시용 스트레치 범위도 첫 타일을 만드는
+작업자 스레드에서 처음 필요할 때 계산하므로, 조합을 바꿔도 화면 스레드는
+기다리지 않습니다.
+"""
+
+import threading
+from typing import Hashable, Optional, Sequence, Tuple, Union
+
+import cv2
+import numpy as np
+
+from .tile import TileCoord
+from .tile_cache import TileCache
+from .tile_source import TileSource
+
+
+def band_statistics(source: TileSource, low: float = 2.0,
+                    high: float = 98.0) -> Tuple[np.ndarray, np.ndarray]:
+    """가장 거친 레벨에서 밴드별 하위/상위 백분위수를 계산합니다.
+
+    표시용 선형 스트레치 범위로 사용합니다. 가장 거친 레벨은 타일 하나이므로
+    타일 캐시를 거쳐 읽어, 이미 캐시된 개요 타일이 있으면 그대로 사용합니다.
+
+    Args:
+        source: 입력 타일 소스
+        low: 하위 백분위수
+        high: 상위 백분위수
+
+    Returns:
+        Tuple[np.ndarray, np.ndarray]: 밴드별 (하한, 상한) 배열
+    """
+    sample = source.get_tile(TileCoord(source.num_levels - 1, 0, 0))
+    sample = sample.reshape(-1, source.channels)
+    lo = np.percentile(sample, low, axis=0).astype(np.float32)
+    hi = np.percentile(sample, high, axis=0).astype(np.float32)
+    return lo, np.maximum(hi, lo + 1e-6)
+
+
+class BandStretch:
+    """입력 소스의 밴드별 스트레치 범위를 처음 필요할 때 한 번만 계산합니다.
+
+    여러 밴드 조합 소스가 공유하며, 계산은 처음 `get()`을 부른 스레드(보통 첫
+    타일을 만드는 작업자 스레드)에서 일어납니다.
+
+    속성:
+        source (TileSource): 다중밴드 입력 타일 소스
+    """
+
+    def __init__(self, source: TileSource, low: float = 2.0, high: float = 98.0,
+                 value: Optional[Tuple[np.ndarray, np.ndarray]] = None):
+        """BandStretch 인스턴스를 초기화합니다.
+
+        Args:
+            source: 다중밴드 입력 타일 소스
+            low: 하위 백분위수
+            high: 상위 백분위수
+            value: 이미 알고 있는 (하한, 상한). 주어지면 계산하지 않음
+        """
+        self.source = source
+        self._percentiles = (low, high)
+        self._value = value
+        self._lock = threading.Lock()
+
+    def get(self) -> Tuple[np.ndarray, np.ndarray]:
+        """밴드별 (하한, 상한)을 반환합니다. 처음 호출 시 계산합니다."""
+        with self._lock:
+            if self._value is None:
+                self._value = band_statistics(self.source, *self._percentiles)
+            return self._value
+
+
+def normalized_difference(a: np.ndarray, b: np.ndarray) -> np.ndarray:
+    """정규화 차이 (a - b) / (a + b)를 float32로 계산합니다. 분모가 0이면 0입니다."""
+    a = a.astype(np.float32)
+    b = b.astype(np.float32)
+    num = a - b
+    den = a + b
+    return np.divide(num, den, out=np.zeros_like(num), where=den != 0)
+
+
+class BandCompositeSource(TileSource):
+    """임의의 세 밴드를 RGB로 합성하는 8비트 BGR 타일 소스입니다.
+
+    속성:
+        source (TileSource): 다중밴드 입력 타일 소스
+        bands (Tuple[int, int, int]): (R, G, B)로 사용할 입력 밴드 인덱스
+    """
+
+    def __init__(self, source: TileSource, bands: Sequence[int],
+                 stretch: Union[Tuple[np.ndarray, np.ndarray], BandStretch, None] = None,
+                 cache: Optional[TileCache] = None):
+        """BandCompositeSource 인스턴스를 초기화합니다.
+
+        Args:
+            source: 다중밴드 입력 타일 소스
+            bands: (R, G, B)로 사용할 밴드 인덱스 3개
+            stretch: 밴드별 (하한, 상한) 또는 공유 `BandStretch`. None인 경우 첫 타일을
+                만들 때 `band_statistics()`로 계산
+            cache: 사용할 타일 캐시. None인 경우 입력 소스의 캐시 사용
+
+        Raises:
+            ValueError: 밴드 수가 3이 아니거나 범위를 벗어난 경우
+        """
+        bands = tuple(int(b) for b in bands)
+        if len(bands) != 3 or not all(0 <= b < source.channels for b in bands):
+            raise ValueError(f"잘못된 밴드 조합입니다: {bands} (밴드 수 {source.channels})")
+        super().__init__(source.width, source.height, 3, np.uint8, source.tile_size,
+                         cache if cache is not None else source.cache)
+        self.source = source
+        self.bands = bands
+        if not isinstance(stretch, BandStretch):
+            stretch = BandStretch(source, value=stretch)
+        self._stretch = stretch
+        # 출력은 BGR 순서이므로 (B, G, R) 밴드 순서로 스트레치 계수를 준비한다
+        self._order = list(reversed(bands))
+        self._coefficients: Optional[Tuple[np.ndarray, np.ndarray]] = None
+
+    @property
+    def cache_key(self) -> Hashable:
+        return ("composite", self.source.cache_key, self.bands)
+
+    def read_region(self, level: int, x: int, y: int, w: int, h: int) -> np.ndarray:
+        offset, scale = self._stretch_coefficients()
+        region = self.source.read_region(level, x, y, w, h)
+        picked = region[..., self._order].astype(np.float32)
+        picked -= offset
+        picked *= scale
+        return np.clip(picked, 0, 255).astype(np.uint8)
+
+    def _stretch_coefficients(self) -> Tuple[np.ndarray, np.ndarray]:
+        """(B, G, R) 순서의 (오프셋, 배율)을 반환합니다. 처음 호출 시 계산합니다."""
+        coefficients = self._coefficients
+        if coefficients is None:
+            lo, hi = self._stretch.get()
+            order = self._order
+            coefficients = (lo[order], 255.0 / (hi[order] - lo[order]))
+            self._coefficients = coefficients
+        return coefficients
+
+
+class BandIndexSource(TileSource):
+    """두 밴드의 정규화 차이 지수를 컬러맵으로 표시하는 타일 소스입니다.
+
+    속성:
+        source (TileSource): 다중밴드 입력 타일 소스
+        name (str): 지수 이름 (예: 'NDVI')
+        bands (Tuple[int, int]): (a, b) 밴드 인덱스, 지수 = (a - b) / (a + b)
+        value_range (Tuple[float, float]): 컬러맵 양 끝에 대응하는 지수 값
+    """
+
+    def __init__(self, source: TileSource, name: str, bands: Sequence[int],
+                 colormap: int = cv2.COLORMAP_TURBO,
+                 value_range: Tuple[float, float] = (-1.0, 1.0),
+                 cache: Optional[TileCache] = None):
+        """BandIndexSource 인스턴스를 초기화합니다.
+
+        Args:
+            source: 다중밴드 입력 타일 소스
+            name: 지수 이름
+            bands: (a, b) 밴드 인덱스
+            colormap: OpenCV 컬러맵 상수
+            value_range: 컬러맵에 대응하는 지수 값 범위
+            cache: 사용할 타일 캐시. None인 경우 입력 소스의 캐시 사용
+
+        Raises:
+            ValueError: 밴드 인덱스가 범위를 벗어난 경우
+        """
+        bands = tuple(int(b) for b in bands)
+        if len(bands) != 2 or not all(0 <= b < source.channels for b in bands):
+            raise ValueError(f"잘못된 밴드 조합입니다: {bands} (밴드 수 {source.channels})")
+        super().__init__(source.width, source.height, 3, np.uint8, source.tile_size,
+                         cache if cache is not None else source.cache)
+        self.source = source
+        self.name = name
+        self.bands = bands
+        self.colormap = colormap
+        self.value_range = value_range
+
+    @classmethod
+    def ndvi(cls, source: TileSource, nir: int, red: int, **kwargs) -> "BandIndexSource":
+        """NDVI = (NIR - Red) / (NIR + Red) 소스를 만듭니다."""
+        return cls(source, "NDVI", (nir, red), **kwargs)
+
+    @classmethod
+    def ndwi(cls, source: TileSource, green: int, nir: int, **kwargs) -> "BandIndexSource":
+        """NDWI = (Green - NIR) / (Green + NIR) 소스를 만듭니다."""
+        return cls(source, "NDWI", (green, nir), **kwargs)
+
+    @classmethod
+    def ndre(cls, source: TileSource, nir: int, red_edge: int, **kwargs) -> "BandIndexSource":
+        """NDRE = (NIR - RedEdge) / (NIR + RedEdge) 소스를 만듭니다."""
+        return cls(source, "NDRE", (nir, red_edge), **kwargs)
+
+    @property
+    def cache_key(self) -> Hashable:
+        return ("index", self.source.cache_key, self.name, self.bands,
+                self.colormap, self.value_range)
+
+    def index_region(self, level: int, x: int, y: int, w: int, h: int) -> np.ndarray:
+        """컬러맵 적용 전의 float32 지수 값을 반환합니다 (분석용)."""
+        region = self.source.read_region(level, x, y, w, h)
+        return normalized_difference(region[..., self.bands[0]], region[..., self.bands[1]])
+
+    def read_region(self, level: int, x: int, y: int, w: int, h: int) -> np.ndarray:
+        index = self.index_region(level, x, y, w, h)
+        lo, hi = self.value_range
+        index -= lo
+        index *= 255.0 / (hi - lo)
+        gray = np.clip(index, 0, 255).astype(np.uint8)
+        return cv2.applyColorMap(gray, self.colormap)
@@ -0,0 +1,182 @@
+"""
+타일 소스를 Cloud Optimized GeoTIFF(COG)로 저장하는 모듈입니다.
+
+COG는 원격 저장소에서 HTTP 범위 요청 몇 번으로 원하는 레벨의 타일을 읽을 수
+있도록 다음 배치를 따릅니다 (GDAL COG 드라이버와 같은 배치).
+
+1. TIFF 헤더와 GDAL 구조 메타데이터(ghost 영역)
+2. 모든 IFD: 전체 해상도 IFD 다음에 내부 오버뷰 IFD가 해상도 순으로 이어짐
+3. 타일 데이터: 가장 작은 오버뷰부터 전체 해상도까지, 레벨마다 행 우선 순서
+
+타일마다 앞에 4바이트 크기(leader), 뒤에 마지막 4바이트 반복(trailer)을
+붙입니다. IFD 크기는 타일 수만으로 정해지므로 자리를 먼저 비워 두고 타일을
+순서대로 쓴 뒤, 실제 타일 위치로 IFD를 다시 씁니다. 임시 파일이 필요 없습니다.
+
+오버뷰는 소스의 피라미드 레벨(2배씩 축소)을 그대로 사용합니다. 필터 파이프라인,
+모자이크, 재투영 소스처럼 어떤 타일 소스든 저장할 수 있습니다. 타일 읽기와
+압축은 작업자 스레드에서 병렬로, 파일 쓰기는 배치 순서대로 진행됩니다.
+"""
+
+import os
+import struct
+from collections import deque
+from concurrent.futures import ThreadPoolExecutor
+from typing import Callable, List, Optional, Tuple
+
+from ..image.georef import GeoTransform
+from ..image.tiff_ifd import TIFF_ASCII, TIFF_LONG, TIFF_LONG8, encode_ifd
+from .raster_writer import CLASSIC_TIFF_LIMIT, TileEncoder, geotiff_entries
+from .region_export import to_rgb
+from .tile_source import TileSource
+
+# COG 기본 타일 크기 (GDAL COG 드라이버 기본값)
+COG_BLOCK_SIZE = 512
+
+# GDAL이 COG 여부와 타일 leader/trailer를 판단하는 구조 메타데이터
+_STRUCTURAL_METADATA = ("LAYOUT=IFDS_BEFORE_DATA\n"
+                        "BLOCK_ORDER=ROW_MAJOR\n"
+                        "BLOCK_LEADER=SIZE_AS_UINT4\n"
+                        "BLOCK_TRAILER=LAST_4_BYTES_REPEATED\n"
+                        "KNOWN_INCOMPATIBLE_EDITION=NO\n ")
+
+
+def write_cog(source: TileSource, path: str, compression: str = "deflate",
+              block_size: int = COG_BLOCK_SIZE, level: Optional[int] = None,
+              quality: int = 75, geotransform: Optional[GeoTransform] = None,
+              crs: Optional[str] = None, nodata: Optional[float] = None,
+              bigtiff: Optional[bool] = None, workers: Optional[int] = None,
+              progress: Optional[Callable[[int, int], None]] = None,
+              cancelled: Optional[Callable[[], bool]] = None) -> List[Tuple[int, int]]:
+    """타일 소스 전체를 내부 오버뷰가 있는 COG로 저장합니다.
+
+    Args:
+        source: 타일 소스 (현재 조정을 반영하려면 필터 파이프라인)
+        path: 출력 경로
+        compression: 'deflate', 'zstd', 'jpeg', 'webp', 'none'
+        block_size: 타일 크기 (16의 배수)
+        level: Deflate/ZSTD 압축 수준. None이면 기본값
+        quality: JPEG/WebP 품질 (WebP는 100이면 무손실)
+        geotransform: 레벨 0 지오트랜스폼 (GeoTIFF 태그로 기록)
+        crs: 좌표계
+        nodata: NoData 값 (GDAL_NODATA 태그로 기록)
+        bigtiff: BigTIFF 사용 여부. None이면 비압축 크기로 결정
+        workers: 읽기/압축 작업자 수. None이면 CPU 코어 수
+        progress: (완료 타일 행 수, 전체 타일 행 수)로 호출되는 함수
+        cancelled: True를 반환하면 중단하는 함수
+
+    Returns:
+        List[Tuple[int, int]]: 저장한 레벨별 (너비, 높이). 첫 항목이 전체 해상도
+
+    Raises:
+        ValueError: 압축 방식이나 형식을 지원하지 않는 경우
+        IOError: 파일 쓰기에 실패했거나 중단된 경우
+    """
+    encoder = TileEncoder(compression, source.dtype, source.channels, block_size,
+                          level, quality)
+    levels = _overview_levels(source, block_size)
+    sizes = [source.level_size(lv) for lv in levels]
+    rows = [-(-h // block_size) for _, h in sizes]
+    counts = [-(-w // block_size) * r for (w, _), r in zip(sizes, rows)]
+    raw_bytes = sum(w * h for w, h in sizes) * source.channels * encoder.dtype.itemsize
+    if bigtiff is None:
+        bigtiff = raw_bytes > CLASSIC_TIFF_LIMIT
+    location = TIFF_LONG8 if bigtiff else TIFF_LONG
+
+    def ifd(index: int, offsets, byte_counts, at: int, next_ifd: int) -> bytes:
+        w, h = sizes[index]
+        entries = encoder.tags(w, h)
+        if index == 0:
+            entries += geotiff_entries(geotransform, crs)
+        else:
+            # NewSubfileType=1: 축소 해상도 영상
+            entries.append((254, TIFF_LONG, (1,)))
+        if nodata is not None:
+            entries.append((42113, TIFF_ASCII, f"{nodata:g}"))
+        entries += [(324, location, offsets), (325, location, byte_counts)]
+        return encode_ifd(entries, at, bigtiff, next_ifd)
+
+    ghost = _STRUCTURAL_METADATA.encode("ascii")
+    header_size = 16 if bigtiff else 8
+    ghost = f"GDAL_STRUCTURAL_METADATA_SIZE={len(ghost):06d} bytes\n".encode("ascii") + ghost
+
+    # IFD 자리 잡기: 값 개수만 같으면 크기가 같으므로 0으로 채워 크기를 잰다
+    positions = []
+    position = _even(header_size + len(ghost))
+    for index in range(len(levels)):
+        positions.append(position)
+        zeros = (0,) * counts[index]
+        position = _even(position + len(ifd(index, zeros, zeros, position, 0)))
+    data_start = position
+
+    # 작은 오버뷰부터 전체 해상도 순서로 타일 행을 나열한다
+    jobs = [(index, row) for index in reversed(range(len(levels)))
+            for row in range(rows[index])]
+    offsets: List[List[int]] = [[] for _ in levels]
+    byte_counts: List[List[int]] = [[] for _ in levels]
+
+    def encode(job: Tuple[int, int]) -> List[bytes]:
+        index, row = job
+        w, h = sizes[index]
+        y0 = row * block_size
+        band = source.read_region(levels[index], 0, y0, w, min(block_size, h - y0))
+        return encoder.encode_band(to_rgb(band), w)
+
+    workers = workers or os.cpu_count() or 4
+    try:
+        with open(path, "wb") as f:
+            f.write(b"II" + (struct.pack("<HHHQ", 43, 8, 0, positions[0]) if bigtiff
+                             else struct.pack("<HI", 42, positions[0])))
+            f.write(ghost)
+            f.seek(data_start)
+            with ThreadPoolExecutor(max_workers=workers, thread_name_prefix="cog") as pool:
+                queue = deque()
+                submitted = 0
+                for done, (index, _) in enumerate(jobs, 1):
+                    # 처리 중인 타일 행 수를 제한해 메모리를 일정하게 유지한다
+                    while submitted < len(jobs) and len(queue) < 2 * workers:
+                        queue.append(pool.submit(encode, jobs[submitted]))
+                        submitted += 1
+                    if cancelled is not None and cancelled():
+                        for future in queue:
+                            future.cancel()
+                        raise IOError("COG 저장이 취소되었습니다.")
+                    for data in queue.popleft().result():
+                        f.write(struct.pack("<I", len(data)))
+                        offsets[index].append(f.tell())
+                        byte_counts[index].append(len(data))
+                        f.write(data)
+                        f.write(data[-4:])
+                    if progress is not None:
+                        progress(done, len(jobs))
+            if not bigtiff and f.tell() > 2 ** 32:
+                raise IOError(f"압축된 크기가 4GB를 넘어 클래식 TIFF로 저장할 수 없습니다: {path}")
+
+            # 실제 타일 위치로 IFD를 다시 쓴다
+            for index, at in enumerate(positions):
+                next_ifd = positions[index + 1] if index + 1 < len(positions) else 0
+                f.seek(at)
+                f.write(ifd(index, offsets[index], byte_counts[index], at, next_ifd))
+    except Exception:
+        if os.path.exists(path):
+            os.remove(path)
+        raise
+    return sizes
+
+
+def _overview_levels(source: TileSource, block_size: int) -> List[int]:
+    """저장할 피라미드 레벨 목록을 반환합니다.
+
+    가장 작은 오버뷰가 타일 하나에 들어갈 때까지 레벨을 더합니다 (소스 레벨 수 이내).
+    """
+    levels = [0]
+    while levels[-1] + 1 < source.num_levels:
+        w, h = source.level_size(levels[-1])
+        if w <= block_size and h <= block_size:
+            break
+        levels.append(levels[-1] + 1)
+    return levels
+
+
+def _even(offset: int) -> int:
+    """TIFF 워드 경계(짝수)로 올린 위치를 반환합니다."""
+    return offset + (offset % 2)
@@ -0,0 +1,59 @@
+"""
+작업자 스레드의 완료 통지를 모아 소비자 스레드에 한꺼번에 넘기는 큐 모듈입니다.
+
+타일마다 Qt 시그널을 보내면 타일 수만큼 이벤트가 메인 스레드 이벤트 루프에
+쌓입니다. `CompletionQueue`는 여러 생산자(작업자 스레드)가 항목을 넣고 단일
+소비자(메인 스레드)가 `drain()`으로 한 번에 꺼내는 MPSC 큐로, 비어 있던 큐에
+첫 항목이 들어올 때만 깨우기 콜백을 호출합니다. 소비자가 한 번 깨어나는 동안
+도착한 항목은 모두 한 묶음으로 처리됩니다.
+
+CPython의 `collections.deque` append/popleft는 원자적이므로 잠금 없이 동작합니다.
+깨우기 플래그는 소비자가 꺼내기 *전에* 내리므로, 생산자가 넣은 항목은 이번
+꺼내기에 포함되거나 새 깨우기를 일으킵니다 (중복 깨우기는 빈 묶음이 될 뿐임).
+"""
+
+from collections import deque
+from typing import Any, Callable, List
+
+
+class CompletionQueue:
+    """다중 생산자·단일 소비자 완료 큐입니다.
+
+    속성:
+        wakeups (int): 깨우기 콜백 호출 횟수 (통계용)
+    """
+
+    def __init__(self, wake: Callable[[], None]):
+        """CompletionQueue 인스턴스를 초기화합니다.
+
+        Args:
+            wake: 비어 있던 큐에 항목이 들어오면 호출할 함수 (어느 스레드에서든 호출됨,
+                예: 메인 스레드로 큐잉되는 시그널의 emit)
+        """
+        self._items: deque = deque()
+        self._wake = wake
+        self._scheduled = False
+        self.wakeups = 0
+
+    def push(self, item: Any) -> None:
+        """항목을 넣습니다 (어느 스레드에서든 호출 가능)."""
+        self._items.append(item)
+        if not self._scheduled:
+            self._scheduled = True
+            self.wakeups += 1
+            self._wake()
+
+    def drain(self) -> List[Any]:
+        """지금까지 들어온 항목을 모두 꺼냅니다 (소비자 스레드에서 호출)."""
+        self._scheduled = False
+        items = []
+        popleft = self._items.popleft
+        try:
+            while True:
+                items.append(popleft())
+        except IndexError:
+            pass
+        return items
+
+    def __len__(self) -> int:
+        return len(self._items)
@@ -0,0 +1,225 @@
+"""
+공유 메모리로 결과를 넘기는 다중 프로세스 디코딩 풀 모듈입니다.
+
+OpenCV 디코더는 GIL을 해제하지만 Pillow 경로나 파이썬 수준 파싱은 GIL에
+묶여 스레드를 늘려도 한 코어만 씁니다. `DecodePool`은 작업자 프로세스에서
+영상을 디코딩하고, 픽셀을 피클링하는 대신 부모가 만든 공유 메모리 영역(arena)의
+슬롯에 써서 (모양, 자료형) 설명자만 돌려받습니다.
+
+- 슬롯은 부모가 작업을 보낼 때 배정하며, 빈 슬롯이 없으면 제출이 대기합니다
+  (작업자 수의 두 배가 기본값이라 디코딩과 복사가 겹침)
+- 슬롯보다 큰 결과는 작업자가 전용 공유 메모리 세그먼트를 만들어 넘기고,
+  부모가 읽은 뒤 해제합니다
+- 부모는 슬롯 내용을 호출자 소유 배열로 한 번 복사한 뒤 곧바로 슬롯을 반납하므로,
+  결과 배열을 캐시에 오래 보관해도 공유 메모리가 묶이지 않습니다
+
+작업자는 spawn 방식으로 시작해 Qt 등 부모의 스레드 상태를 물려받지 않으며,
+이 모듈과 OpenCV/NumPy/Pillow만 가져옵니다.
+"""
+
+import atexit
+import multiprocessing
+import os
+import threading
+from concurrent.futures import Future, ProcessPoolExecutor
+from multiprocessing import shared_memory
+from typing import Dict, List, Optional, Tuple
+
+import cv2
+import numpy as np
+
+# 축소 배율별 OpenCV 디코딩 플래그 (JPEG은 DCT 단계에서 축소되어 빠름)
+REDUCED_FLAGS = {
+    1: cv2.IMREAD_COLOR,
+    2: cv2.IMREAD_REDUCED_COLOR_2,
+    4: cv2.IMREAD_REDUCED_COLOR_4,
+    8: cv2.IMREAD_REDUCED_COLOR_8,
+}
+
+# 공유 디코딩 풀의 작업자 프로세스 수 (설정하지 않거나 0이면 풀을 쓰지 않음)
+PROCESSES_ENV = "AIRPHOTO_DECODE_PROCESSES"
+
+
+def decode_reduced(path: str, reduce: int = 1) -> np.ndarray:
+    """영상을 1/reduce 해상도의 8비트 BGR 배열로 디코딩합니다.
+
+    OpenCV가 읽지 못하는 형식은 Pillow로 읽어 축소합니다.
+
+    Args:
+        path: 영상 파일 경로
+        reduce: 축소 배율 (1, 2, 4, 8)
+
+    Raises:
+        ValueError: 지원하지 않는 축소 배율인 경우
+        IOError: 디코딩에 실패한 경우
+    """
+    if reduce not in REDUCED_FLAGS:
+        raise ValueError(f"지원하지 않는 축소 배율입니다: {reduce}")
+    array = cv2.imread(path, REDUCED_FLAGS[reduce])
+    if array is not None:
+        return array
+    try:
+        from PIL import Image
+
+        with Image.open(path) as image:
+            # OpenCV 축소 디코딩과 같은 올림 크기
+            size = (-(-image.width // reduce), -(-image.height // reduce))
+            image.draft("RGB", size)
+            image = image.convert("RGB")
+            if image.size != size:
+                image = image.resize(size, Image.Resampling.BOX)
+            return np.ascontiguousarray(np.asarray(image)[..., ::-1])
+    except Exception:
+        raise IOError(f"이미지를 로드할 수 없습니다: {path}")
+
+
+# 작업자 프로세스가 붙어 있는 공유 메모리 (이름 → 세그먼트, 프로세스마다 한 번만 연다)
+_attached: Dict[str, shared_memory.SharedMemory] = {}
+
+
+def _decode_job(path: str, reduce: int, arena: str, offset: int,
+                capacity: int) -> Tuple[Optional[str], tuple, str]:
+    """작업자 프로세스에서 디코딩해 결과를 공유 메모리에 씁니다.
+
+    Returns:
+        Tuple: (전용 세그먼트 이름 또는 슬롯을 썼으면 None, 모양, 자료형 문자열)
+    """
+    array = decode_reduced(path, reduce)
+    if array.nbytes <= capacity:
+        segment = _attached.get(arena)
+        if segment is None:
+            segment = _attached[arena] = shared_memory.SharedMemory(name=arena)
+        np.ndarray(array.shape, array.dtype, buffer=segment.buf, offset=offset)[...] = array
+        return None, array.shape, array.dtype.str
+    # 슬롯보다 큰 결과: 전용 세그먼트를 만들고 해제는 부모에게 맡긴다
+    segment = shared_memory.SharedMemory(create=True, size=array.nbytes)
+    np.ndarray(array.shape, array.dtype, buffer=segment.buf)[...] = array
+    segment.close()
+    return segment.name, array.shape, array.dtype.str
+
+
+class DecodePool:
+    """작업자 프로세스에서 영상을 디코딩하는 풀입니다.
+
+    속성:
+        workers (int): 작업자 프로세스 수
+        slot_bytes (int): 공유 메모리 슬롯 하나의 크기
+    """
+
+    def __init__(self, workers: Optional[int] = None, slot_mb: int = 32,
+                 slots: Optional[int] = None):
+        """DecodePool 인스턴스를 초기화합니다.
+
+        Args:
+            workers: 작업자 프로세스 수. None인 경우 CPU 코어 수 사용
+            slot_mb: 슬롯 하나의 크기 (MB 단위, 이보다 큰 결과는 전용 세그먼트 사용)
+            slots: 슬롯 수 (동시에 진행할 수 있는 작업 수). None인 경우 작업자 수의 두 배
+        """
+        self.workers = workers or os.cpu_count() or 1
+        self.slot_bytes = slot_mb * 1024 * 1024
+        count = slots or 2 * self.workers
+        self._arena = shared_memory.SharedMemory(create=True, size=count * self.slot_bytes)
+        self._free: List[int] = list(range(count))
+        self._cond = threading.Condition()
+        self._closed = False
+        self._executor = ProcessPoolExecutor(
+            self.workers, mp_context=multiprocessing.get_context("spawn"))
+
+    def submit(self, path: str, reduce: int = 1) -> Future:
+        """디코딩 작업을 제출합니다. 빈 슬롯이 없으면 생길 때까지 대기합니다.
+
+        Args:
+            path: 영상 파일 경로
+            reduce: 축소 배율 (1, 2, 4, 8)
+
+        Returns:
+            Future: 결과 배열(호출자 소유)을 담을 Future. 실패하면 IOError 등을 전달
+        """
+        with self._cond:
+            while not self._free and not self._closed:
+                self._cond.wait()
+            if self._closed:
+                raise RuntimeError("닫힌 디코딩 풀입니다.")
+            slot = self._free.pop()
+        future: Future = Future()
+        try:
+            job = self._executor.submit(_decode_job, path, reduce, self._arena.name,
+                                        slot * self.slot_bytes, self.slot_bytes)
+        except BaseException:
+            self._release(slot)
+            raise
+        job.add_done_callback(lambda job: self._finish(job, slot, future))
+        return future
+
+    def decode(self, path: str, reduce: int = 1) -> np.ndarray:
+        """영상을 디코딩할 때까지 기다려 결과 배열을 반환합니다.
+
+        Raises:
+            IOError: 디코딩에 실패한 경우
+        """
+        return self.submit(path, reduce).result()
+
+    def close(self) -> None:
+        """작업자를 종료하고 공유 메모리를 해제합니다."""
+        with self._cond:
+            if self._closed:
+                return
+            self._closed = True
+            self._cond.notify_all()
+        self._executor.shutdown(wait=True, cancel_futures=True)
+        self._arena.close()
+        self._arena.unlink()
+
+    def _release(self, slot: int) -> None:
+        with self._cond:
+            self._free.append(slot)
+            self._cond.notify()
+
+    def _finish(self, job: Future, slot: int, future: Future) -> None:
+        """작업 결과 설명자를 배열로 옮기고 슬롯을 반납합니다."""
+        try:
+            name, shape, dtype = job.result()
+            if name is None:
+                view = np.ndarray(shape, np.dtype(dtype), buffer=self._arena.buf,
+                                  offset=slot * self.slot_bytes)
+                array = view.copy()
+                del view
+            else:
+                segment = shared_memory.SharedMemory(name=name)
+                try:
+                    view = np.ndarray(shape, np.dtype(dtype), buffer=segment.buf)
+                    array = view.copy()
+                    del view
+                finally:
+                    segment.close()
+                    segment.unlink()
+        except BaseException as e:
+            self._release(slot)
+            future.set_exception(e)
+            return
+        self._release(slot)
+        future.set_result(array)
+
+
+_shared_pool: Optional[DecodePool] = None
+_shared_lock = threading.Lock()
+
+
+def get_shared_decode_pool() -> Optional[DecodePool]:
+    """환경 변수로 켠 공유 디코딩 풀을 반환합니다. 꺼져 있으면 None을 반환합니다.
+
+    `AIRPHOTO_DECODE_PROCESSES`에 작업자 프로세스 수를 지정하면 처음 호출할 때
+    풀을 만들고, 프로세스 종료 시 정리합니다.
+    """
+    global _shared_pool
+    try:
+        workers = int(os.environ.get(PROCESSES_ENV) or 0)
+    except ValueError:
+        workers = 0
+    if workers <= 0:
+        return None
+    with _shared_lock:
+        if _shared_pool is None:
+            _shared_pool = DecodePool(workers)
+            atexit.register(_shared_pool.close)
+        return _shared_pool
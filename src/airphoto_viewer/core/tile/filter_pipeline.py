@@ -0,0 +1,183 @@
+"""
+타일 단위 지연 필터 파이프라인 모듈입니다.
+
+샤프닝, 블러처럼 이웃 픽셀을 참조하는 필터는 타일 경계 밖의 픽셀이
+필요합니다. 각 단계는 커널 반경을 선언하고, 파이프라인은 모든 단계
+반경의 합만큼 헤일로(halo)를 붙여 원본 타일 소스에서 영역을 읽은 뒤
+필터를 순서대로 적용하고 헤일로를 잘라냅니다. 결과는 파이프라인 버전이
+포함된 키로 캐시되므로, 필터를 바꾸면 화면에 보이는 타일만 다시 계산됩니다.
+버전은 입력 소스와 단계 구성(매개변수 포함)으로 정해지므로, 이전 구성으로
+되돌아가면 캐시된 타일이 그대로 재사용됩니다.
+연속된 점 연산(`point_ops`)은 하나의 단계로 융합되어 실행됩니다.
+"""
+
+import math
+from typing import Hashable, Iterable, List, Optional
+
+import cv2
+import numpy as np
+
+from .filter_stage import FilterStage
+from .point_ops import fuse_stages
+from .tile_cache import TileCache
+from .tile_source import TileSource
+
+
+class GaussianBlurFilter(FilterStage):
+    """가우시안 블러 필터입니다."""
+    name = "blur"
+
+    def __init__(self, sigma: float = 1.5):
+        """GaussianBlurFilter 인스턴스를 초기화합니다.
+
+        Args:
+            sigma: 가우시안 표준편차 (픽셀 단위)
+        """
+        self.sigma = sigma
+        self.radius = max(1, math.ceil(3 * sigma))
+
+    def apply(self, array: np.ndarray) -> np.ndarray:
+        ksize = 2 * self.radius + 1
+        return cv2.GaussianBlur(array, (ksize, ksize), self.sigma)
+
+    def describe(self) -> Hashable:
+        return (self.name, self.sigma)
+
+
+class SharpenFilter(FilterStage):
+    """언샤프 마스크 방식의 샤프닝 필터입니다."""
+    name = "sharpen"
+
+    def __init__(self, amount: float = 1.0, sigma: float = 1.0):
+        """SharpenFilter 인스턴스를 초기화합니다.
+
+        Args:
+            amount: 샤프닝 강도
+            sigma: 블러 마스크의 표준편차
+        """
+        self.amount = amount
+        self.sigma = sigma
+        self.radius = max(1, math.ceil(3 * sigma))
+
+    def apply(self, array: np.ndarray) -> np.ndarray:
+        ksize = 2 * self.radius + 1
+        blurred = cv2.GaussianBlur(array, (ksize, ksize), self.sigma)
+        return cv2.addWeighted(array, 1.0 + self.amount, blurred, -self.amount, 0)
+
+    def describe(self) -> Hashable:
+        return (self.name, self.amount, self.sigma)
+
+
+class MedianFilter(FilterStage):
+    """미디언 필터입니다 (잡음 제거)."""
+    name = "median"
+
+    def __init__(self, ksize: int = 3):
+        """MedianFilter 인스턴스를 초기화합니다.
+
+        Args:
+            ksize: 커널 크기 (홀수)
+
+        Raises:
+            ValueError: 커널 크기가 3 이상의 홀수가 아닌 경우
+        """
+        if ksize < 3 or ksize % 2 == 0:
+            raise ValueError(f"미디언 커널 크기는 3 이상의 홀수여야 합니다: {ksize}")
+        self.ksize = ksize
+        self.radius = ksize // 2
+
+    def apply(self, array: np.ndarray) -> np.ndarray:
+        return cv2.medianBlur(array, self.ksize)
+
+    def describe(self) -> Hashable:
+        return (self.name, self.ksize)
+
+
+class FilterPipeline(TileSource):
+    """원본 타일 소스 위에 필터 단계를 지연 적용하는 타일 소스입니다.
+
+    필터는 요청된 타일에만 적용되며, 반경은 해당 레벨의 픽셀 단위로
+    해석됩니다 (즉, 화면에 보이는 해상도 기준으로 필터가 적용됩니다).
+
+    속성:
+        source (TileSource): 입력 타일 소스
+        stages (List[FilterStage]): 적용할 필터 단계 목록
+        version (int): 단계 구성이나 입력 소스가 바뀔 때마다 증가하는 버전
+    """
+
+    def __init__(self, source: TileSource, stages: Iterable[FilterStage] = (),
+                 cache: Optional[TileCache] = None):
+        """FilterPipeline 인스턴스를 초기화합니다.
+
+        Args:
+            source: 입력 타일 소스
+            stages: 초기 필터 단계 목록
+            cache: 사용할 타일 캐시. None인 경우 입력 소스의 캐시 사용
+        """
+        super().__init__(source.width, source.height, source.channels, source.dtype,
+                         source.tile_size, cache if cache is not None else source.cache)
+        self.source = source
+        self.stages: List[FilterStage] = list(stages)
+        self.version = 0
+        self._plan: List[FilterStage] = fuse_stages(self.stages)
+        self._signature = tuple(stage.describe() for stage in self.stages)
+
+    @property
+    def cache_key(self) -> Hashable:
+        return ("filter", self.source.cache_key, self._signature)
+
+    @property
+    def halo(self) -> int:
+        """모든 단계의 반경 합 (필요한 헤일로 폭)을 반환합니다."""
+        return sum(stage.radius for stage in self.stages)
+
+    def set_stages(self, stages: Iterable[FilterStage]) -> None:
+        """필터 단계를 교체하고 버전을 올립니다.
+
+        이전 버전의 타일은 캐시 키가 달라지므로 더 이상 조회되지 않으며,
+        LRU에 의해 자연스럽게 축출됩니다.
+
+        Args:
+            stages: 새 필터 단계 목록
+        """
+        self.stages = list(stages)
+        self._plan = fuse_stages(self.stages)
+        self._signature = tuple(stage.describe() for stage in self.stages)
+        self.version += 1
+
+    def set_source(self, source: TileSource) -> None:
+        """입력 타일 소스를 교체하고 버전을 올립니다 (예: 밴드 조합 변경).
+
+        Args:
+            source: 새 입력 타일 소스 (크기와 타일 크기가 같아야 합니다)
+        """
+        self.source = source
+        self.channels = source.channels
+        self.dtype = source.dtype
+        self.version += 1
+
+    def add_stage(self, stage: FilterStage) -> None:
+        """필터 단계를 끝에 추가하고 버전을 올립니다."""
+        self.set_stages(self.stages + [stage])
+
+    def read_region(self, level: int, x: int, y: int, w: int, h: int) -> np.ndarray:
+        if not self.stages:
+            return self.source.read_region(level, x, y, w, h)
+
+        halo = self.halo
+        lw, lh = self.level_size(level)
+        # 레벨 경계 안에서 읽을 수 있는 헤일로 영역
+        sx0, sy0 = max(0, x - halo), max(0, y - halo)
+        sx1, sy1 = min(lw, x + w + halo), min(lh, y + h + halo)
+        region = self.source.read_region(level, sx0, sy0, sx1 - sx0, sy1 - sy0)
+
+        # 이미지 경계에서 모자란 헤일로는 반사 패딩으로 채운다
+        top, left = halo - (y - sy0), halo - (x - sx0)
+        bottom, right = halo - (sy1 - y - h), halo - (sx1 - x - w)
+        if top or left or bottom or right:
+            region = cv2.copyMakeBorder(region, top, bottom, left, right,
+                                        cv2.BORDER_REFLECT_101)
+
+        for stage in self._plan:
+            region = stage.apply(region)
+        return np.ascontiguousarray(region[halo:halo + h, halo:halo + w])
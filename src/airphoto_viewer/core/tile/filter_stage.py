@@ -0,0 +1,28 @@
+"""
+필터 단계의 기반 클래스를 정의하는 모듈입니다.
+
+이웃 필터(`filter_pipeline`)와 점 연산(`point_ops`)이 모두 이 클래스를 상속합니다.
+"""
+
+from typing import Hashable
+
+import numpy as np
+
+
+class FilterStage:
+    """필터 단계의 기반 클래스입니다.
+
+    속성:
+        name (str): 필터 이름
+        radius (int): 출력 픽셀 하나를 계산하는 데 필요한 이웃 반경 (레벨 픽셀 단위)
+    """
+    name = "identity"
+    radius = 0
+
+    def apply(self, array: np.ndarray) -> np.ndarray:
+        """헤일로가 포함된 배열에 필터를 적용합니다. 출력 크기는 입력과 같아야 합니다."""
+        return array
+
+    def describe(self) -> Hashable:
+        """캐시 구분에 사용할 단계 설명(이름과 매개변수)을 반환합니다."""
+        return (self.name, self.radius)
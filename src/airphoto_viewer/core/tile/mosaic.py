@@ -0,0 +1,285 @@
+"""
+여러 영상을 하나의 표면으로 보여주는 가상 모자이크 타일 소스 모듈입니다.
+
+매니페스트(JSON 또는 YAML)에 나열된 프레임과 그 배치 위치로 하나의 큰
+레벨 0 좌표계를 만들고, 타일 요청 시 R-트리 공간 색인으로 겹치는 프레임만 골라
+해당 레벨 해상도로 읽어 붙입니다. 거친 레벨에서는 JPEG 축소 디코딩
+(IMREAD_REDUCED_*)을 사용하므로 전체 해상도로 디코딩하지 않습니다.
+프레임이 썸네일보다 작게 보이는 개요 레벨은 영구 썸네일 데이터베이스의
+썸네일로 그리므로, 수천 프레임의 개요 타일도 프레임을 디코딩하지 않고
+(처음 한 번은 EXIF 썸네일/DCT 축소로 만들어 기록) 만들어집니다.
+
+매니페스트 형식::
+
+    tile_size: 256            # 선택
+    frames:
+      - {path: DSC0001.JPG, x: 0, y: 0}
+      - {path: DSC0002.JPG, x: 4200, y: 0, width: 6000, height: 4000}
+
+경로는 매니페스트 파일 기준 상대 경로일 수 있으며, 크기를 생략하면
+파일 헤더에서 읽습니다. 위치(x, y)를 생략하면 프레임의 지리참조(GeoTIFF 태그,
+월드 파일 등)로 첫 지리참조 프레임의 픽셀 격자에 배치합니다. 겹치는 영역은 목록의 뒤쪽 프레임이 위에 그려집니다.
+"""
+
+import os
+import threading
+from dataclasses import dataclass
+from typing import Hashable, List, Optional, Sequence, Tuple
+
+import numpy as np
+import yaml
+from PIL import Image
+
+from ...utils.spatial_index import PackedRTree
+from ..image.georef import GeoTransform
+from ..image.geotags import read_georeference
+from ..image.thumbnails import ThumbnailDatabase, make_thumbnail
+from .decode_pool import DecodePool, decode_reduced
+from .pyramid import downsample
+from .tile_cache import TileCache
+from .tile_source import TileSource
+
+# 가상 모자이크 매니페스트로 여는 확장자
+MOSAIC_EXTENSIONS = ('.json', '.yaml', '.yml')
+
+
+@dataclass(frozen=True)
+class MosaicFrame:
+    """모자이크를 구성하는 프레임 하나의 배치 정보입니다.
+
+    속성:
+        path (str): 영상 파일 경로
+        x (int): 레벨 0 좌표계의 좌상단 x
+        y (int): 레벨 0 좌표계의 좌상단 y
+        width (int): 프레임 너비
+        height (int): 프레임 높이
+    """
+    path: str
+    x: int
+    y: int
+    width: int
+    height: int
+
+    @property
+    def bounds(self) -> Tuple[int, int, int, int]:
+        """(x0, y0, x1, y1) 경계를 반환합니다."""
+        return (self.x, self.y, self.x + self.width, self.y + self.height)
+
+
+class MosaicSource(TileSource):
+    """매니페스트의 프레임들을 하나의 8비트 BGR 영상처럼 제공하는 타일 소스입니다.
+
+    디코딩한 프레임 배열은 소스 키를 포함한 (프레임, 레벨) 키로 타일 캐시에
+    함께 보관되어(다른 탭과 같은 메모리 예산), 인접 타일이 같은 프레임을 다시
+    디코딩하지 않습니다. 디코딩 풀을 주면 프레임 디코딩을 작업자 프로세스에서
+    실행합니다.
+
+    속성:
+        frames (List[MosaicFrame]): 프레임 목록 (그리기 순서)
+        origin (Tuple[int, int]): 매니페스트 좌표에서 모자이크 좌상단의 위치
+        thumbnails (Optional[ThumbnailDatabase]): 개요 레벨에 쓰는 썸네일 데이터베이스
+    """
+
+    def __init__(self, frames: Sequence[MosaicFrame], tile_size: int = 256,
+                 cache: Optional[TileCache] = None,
+                 decode_pool: Optional[DecodePool] = None,
+                 thumbnails: Optional[ThumbnailDatabase] = None):
+        """MosaicSource 인스턴스를 초기화합니다.
+
+        Args:
+            frames: 프레임 목록
+            tile_size: 타일 한 변의 픽셀 수
+            cache: 사용할 타일 캐시. None인 경우 공유 캐시 사용
+            decode_pool: 프레임을 디코딩할 다중 프로세스 풀. None인 경우 호출 스레드에서 디코딩
+            thumbnails: 개요 레벨 썸네일 데이터베이스. None인 경우 개요 레벨도 프레임을 디코딩
+
+        Raises:
+            ValueError: 프레임이 없는 경우
+        """
+        if not frames:
+            raise ValueError("모자이크에 프레임이 없습니다.")
+        # 음수 좌표를 허용하고 전체 경계의 좌상단을 원점으로 옮긴다
+        ox = min(f.x for f in frames)
+        oy = min(f.y for f in frames)
+        self.origin = (ox, oy)
+        self.frames = [MosaicFrame(f.path, f.x - ox, f.y - oy, f.width, f.height)
+                       for f in frames]
+        width = max(f.bounds[2] for f in self.frames)
+        height = max(f.bounds[3] for f in self.frames)
+        super().__init__(width, height, 3, np.uint8, tile_size, cache)
+        # 프레임 픽셀 경계를 닫힌 구간으로 색인한다 (x1, y1은 마지막 픽셀)
+        bounds = np.array([f.bounds for f in self.frames], dtype=np.float64)
+        bounds[:, 2:] -= 1
+        self._index = PackedRTree(bounds)
+        # 프레임 배열 캐시 키 접두어 (invalidate_source로 타일과 함께 제거됨)
+        self._frames_key = ("frames", self.cache_key)
+        self.decode_pool = decode_pool
+        self.thumbnails = thumbnails
+        # 인접 타일을 처리하는 작업자들이 같은 프레임을 중복 디코딩하지 않도록 한다
+        self._decode_locks = [threading.Lock() for _ in range(32)]
+
+    @classmethod
+    def from_manifest(cls, path: str, cache: Optional[TileCache] = None,
+                      decode_pool: Optional[DecodePool] = None,
+                      thumbnails: Optional[ThumbnailDatabase] = None) -> "MosaicSource":
+        """매니페스트 파일에서 모자이크를 만듭니다.
+
+        Args:
+            path: JSON 또는 YAML 매니페스트 경로
+            cache: 사용할 타일 캐시. None인 경우 공유 캐시 사용
+            decode_pool: 프레임을 디코딩할 다중 프로세스 풀
+            thumbnails: 개요 레벨 썸네일 데이터베이스
+
+        Raises:
+            FileNotFoundError: 매니페스트나 프레임 파일이 없는 경우
+            ValueError: 매니페스트 형식이 잘못된 경우
+        """
+        if not os.path.exists(path):
+            raise FileNotFoundError(f"파일을 찾을 수 없습니다: {path}")
+        with open(path, "r", encoding="utf-8") as f:
+            manifest = yaml.safe_load(f)
+        if isinstance(manifest, list):
+            manifest = {"frames": manifest}
+        if not isinstance(manifest, dict) or not isinstance(manifest.get("frames"), list):
+            raise ValueError(f"모자이크 매니페스트 형식이 잘못되었습니다: {path}")
+
+        base = os.path.dirname(os.path.abspath(path))
+        frames = []
+        reference: Optional[GeoTransform] = None
+        for entry in manifest["frames"]:
+            try:
+                frame_path = os.path.join(base, entry["path"])
+                placed = "x" in entry and "y" in entry
+                if placed:
+                    x, y = int(entry["x"]), int(entry["y"])
+            except (KeyError, TypeError, ValueError):
+                raise ValueError(f"잘못된 프레임 항목입니다: {entry}")
+            if not os.path.exists(frame_path):
+                raise FileNotFoundError(f"파일을 찾을 수 없습니다: {frame_path}")
+            if not placed:
+                reference, x, y = _georeferenced_position(frame_path, reference)
+            if "width" in entry and "height" in entry:
+                width, height = int(entry["width"]), int(entry["height"])
+            else:
+                # 헤더만 읽어 크기를 얻는다 (픽셀은 디코딩하지 않음)
+                with Image.open(frame_path) as image:
+                    width, height = image.size
+            frames.append(MosaicFrame(frame_path, x, y, width, height))
+        return cls(frames, int(manifest.get("tile_size", 256)), cache,
+                   decode_pool=decode_pool, thumbnails=thumbnails)
+
+    @property
+    def cache_key(self) -> Hashable:
+        return ("mosaic", self.token)
+
+    def frames_in_rect(self, x0: int, y0: int, x1: int, y1: int) -> List[int]:
+        """레벨 0 사각형과 겹치는 프레임 인덱스를 그리기 순서대로 반환합니다."""
+        return np.sort(self._index.query(x0, y0, x1 - 1, y1 - 1)).tolist()
+
+    def _frame_span(self, frame: MosaicFrame, level: int) -> Tuple[int, int, int, int]:
+        """레벨 좌표계에서 프레임이 차지하는 (x0, y0, x1, y1)을 반환합니다.
+
+        인접 프레임 사이에 틈이 생기지 않도록 양 끝을 각각 내림/올림합니다.
+        """
+        scale = 1 << level
+        return (frame.x // scale, frame.y // scale,
+                max(frame.x // scale + 1, -(-(frame.x + frame.width) // scale)),
+                max(frame.y // scale + 1, -(-(frame.y + frame.height) // scale)))
+
+    def frame_array(self, index: int, level: int) -> np.ndarray:
+        """프레임을 레벨 해상도로 디코딩한 배열을 반환합니다.
+
+        Args:
+            index: 프레임 인덱스
+            level: 피라미드 레벨
+
+        Raises:
+            IOError: 프레임 디코딩에 실패한 경우
+        """
+        key = (self._frames_key, index, level)
+        array = self.cache.get_tile(key)
+        if array is not None:
+            return array
+        with self._decode_locks[hash(key) % len(self._decode_locks)]:
+            array = self.cache.peek(key)
+            if array is not None:
+                return array
+            frame = self.frames[index]
+            x0, y0, x1, y1 = self._frame_span(frame, level)
+            array = None
+            if self.thumbnails is not None and max(x1 - x0, y1 - y0) <= self.thumbnails.size:
+                array = self._thumbnail(frame)
+            if array is None:
+                reduce = min(1 << level, 8)
+                if self.decode_pool is not None:
+                    array = self.decode_pool.decode(frame.path, reduce)
+                else:
+                    array = decode_reduced(frame.path, reduce)
+            if array.shape[1] != x1 - x0 or array.shape[0] != y1 - y0:
+                array = downsample(array, (x1 - x0, y1 - y0))
+            self.cache.put_tile(key, array)
+            return array
+
+    def _thumbnail(self, frame: MosaicFrame) -> Optional[np.ndarray]:
+        """프레임 썸네일을 데이터베이스에서 꺼내거나 만들어 기록합니다. 실패하면 None"""
+        try:
+            stat = os.stat(frame.path)
+            cached = self.thumbnails.get(frame.path, stat)
+            if cached is not None:
+                thumb = cached[0]
+            else:
+                thumb, source_size = make_thumbnail(frame.path, self.thumbnails.size)
+                self.thumbnails.put(frame.path, stat, thumb, source_size)
+        except (OSError, IOError):
+            return None
+        # EXIF 방향 회전으로 가로·세로가 바뀐 썸네일은 프레임 배치와 맞지 않는다
+        if (thumb.shape[1] >= thumb.shape[0]) != (frame.width >= frame.height):
+            return None
+        return thumb
+
+    def read_region(self, level: int, x: int, y: int, w: int, h: int) -> np.ndarray:
+        out = np.zeros((h, w, 3), dtype=np.uint8)
+        scale = 1 << level
+        candidates = self.frames_in_rect(x * scale, y * scale,
+                                         (x + w) * scale, (y + h) * scale)
+        for index in candidates:
+            fx0, fy0, fx1, fy1 = self._frame_span(self.frames[index], level)
+            ix0, iy0 = max(x, fx0), max(y, fy0)
+            ix1, iy1 = min(x + w, fx1), min(y + h, fy1)
+            if ix0 >= ix1 or iy0 >= iy1:
+                continue
+            array = self.frame_array(index, level)
+            out[iy0 - y:iy1 - y, ix0 - x:ix1 - x] = \
+                array[iy0 - fy0:iy1 - fy0, ix0 - fx0:ix1 - fx0]
+        return out
+
+    def release(self) -> None:
+        """디코딩해 둔 프레임 배열을 모두 해제합니다 (필요 시 다시 디코딩)."""
+        prefix = self._frames_key
+        self.cache.invalidate(lambda key: isinstance(key, tuple) and key[0] == prefix)
+
+
+def _georeferenced_position(path: str, reference: Optional[GeoTransform]
+                            ) -> Tuple[GeoTransform, int, int]:
+    """지리참조로 프레임의 좌상단 위치를 기준 격자의 픽셀 좌표로 계산합니다.
+
+    Args:
+        path: 프레임 파일 경로
+        reference: 기준 격자. None이면 이 프레임이 기준이 됨
+
+    Returns:
+        Tuple[GeoTransform, int, int]: (기준 격자, x, y)
+
+    Raises:
+        ValueError: 지리참조가 없거나 기준 격자와 해상도/방향이 다른 경우
+    """
+    georef = read_georeference(path)
+    if georef is None:
+        raise ValueError(f"위치가 없고 지리참조도 없는 프레임입니다: {path}")
+    transform = georef.geotransform
+    if reference is None:
+        return transform, 0, 0
+    if not np.allclose(transform.matrix[:, :2], reference.matrix[:, :2], rtol=1e-3):
+        raise ValueError(f"기준 프레임과 해상도 또는 방향이 다른 프레임입니다: {path}")
+    x, y = reference.ground_to_pixel(transform.matrix[:, 2])
+    return reference, int(round(x)), int(round(y))
@@ -0,0 +1,532 @@
+"""
+점 연산(픽셀 단위 조정) 및 융합 컴파일러 모듈입니다.
+
+감마, 대비, 화이트 밸런스, 색 행렬, 의사 컬러, ICC 변환처럼 이웃 픽셀을
+참조하지 않는 연산을 `PointOp`으로 표현합니다. 연속된 점 연산은
+`compile_point_ops()`가 다음 규칙으로 융합하여 타일당 메모리 패스 수를
+연산 개수와 무관하게 최소화합니다.
+
+- 채널별 곡선(감마, 대비, 화이트 밸런스 등)은 하나의 LUT로 합성 → 1패스
+- 연속된 색 행렬은 행렬 곱으로 합성 → 1패스 (`cv2.transform`)
+- 의사 컬러 뒤의 곡선은 컬러 테이블에 합성
+- ICC 변환처럼 일반적인 3차원 매핑은 융합 경계(barrier)로 별도 패스
+
+LUT는 8비트에서는 256개, 16비트에서는 65536개 항목을 사용하며,
+합성은 [0, 1] 정규화된 실수 영역에서 수행하고 마지막에 한 번만 양자화합니다.
+따라서 융합된 행렬 사이의 중간 클리핑은 생략되어, 연산을 하나씩 적용할
+때와 결과가 약간 다를 수 있습니다 (중간 양자화 손실이 없는 쪽이 더 정확합니다).
+배열의 채널 순서는 OpenCV와 같은 BGR(A)입니다.
+"""
+
+import hashlib
+import io
+from typing import Hashable, List, Optional, Sequence
+
+import cv2
+import numpy as np
+
+from ...utils import native
+from .filter_stage import FilterStage
+
+# BGR 순서의 휘도 계수 (ITU-R BT.601)
+LUMA_BGR = (0.114, 0.587, 0.299)
+
+
+class PointOp(FilterStage):
+    """점 연산의 기반 클래스입니다.
+
+    하위 클래스는 `kind`에 따라 다음 중 하나를 구현합니다.
+
+    - "curve": `curve(x, channel)` — 정규화된 값 x를 채널별로 매핑
+    - "matrix": `matrix(channels)` — (채널 x 채널) 선형 변환 행렬
+    - "colormap": `table(size)` — 단일 채널 값을 BGR 색으로 매핑하는 (size, 3) 테이블
+    - "barrier": `apply_barrier(array)` — 융합할 수 없는 일반 연산
+    """
+    radius = 0
+    kind = "curve"
+
+    def curve(self, x: np.ndarray, channel: int) -> np.ndarray:
+        """정규화된 [0, 1] 값을 매핑합니다. channel은 BGR 순서 인덱스입니다."""
+        return x
+
+    def matrix(self, channels: int) -> Optional[np.ndarray]:
+        """채널 수에 맞는 변환 행렬을 반환합니다. 적용할 수 없으면 None"""
+        return None
+
+    def table(self, size: int) -> np.ndarray:
+        """[0, 1] 범위를 size 단계로 나눈 BGR 컬러 테이블을 반환합니다."""
+        raise NotImplementedError
+
+    def apply_barrier(self, array: np.ndarray) -> np.ndarray:
+        """융합 경계 연산을 적용합니다."""
+        raise NotImplementedError
+
+    def apply(self, array: np.ndarray) -> np.ndarray:
+        return compile_point_ops([self], array.dtype,
+                                 1 if array.ndim == 2 else array.shape[2]).apply(array)
+
+
+class GammaOp(PointOp):
+    """감마 보정 연산입니다."""
+    name = "gamma"
+
+    def __init__(self, gamma: float = 2.2):
+        """GammaOp 인스턴스를 초기화합니다.
+
+        Args:
+            gamma: 감마 값 (1.0보다 크면 어두운 영역을 밝게)
+
+        Raises:
+            ValueError: 감마가 0 이하인 경우
+        """
+        if gamma <= 0:
+            raise ValueError(f"감마 값은 0보다 커야 합니다: {gamma}")
+        self.gamma = gamma
+
+    def curve(self, x, channel):
+        return np.power(x, 1.0 / self.gamma)
+
+    def describe(self) -> Hashable:
+        return (self.name, self.gamma)
+
+
+class ContrastOp(PointOp):
+    """밝기/대비 조정 연산입니다 (중간값 0.5 기준)."""
+    name = "contrast"
+
+    def __init__(self, contrast: float = 1.0, brightness: float = 0.0):
+        """ContrastOp 인스턴스를 초기화합니다.
+
+        Args:
+            contrast: 대비 배율 (1.0 = 변화 없음)
+            brightness: 밝기 오프셋 (정규화 값, -1.0 ~ 1.0)
+        """
+        self.contrast = contrast
+        self.brightness = brightness
+
+    def curve(self, x, channel):
+        return (x - 0.5) * self.contrast + 0.5 + self.brightness
+
+    def describe(self) -> Hashable:
+        return (self.name, self.contrast, self.brightness)
+
+
+class WhiteBalanceOp(PointOp):
+    """채널별 이득을 적용하는 화이트 밸런스 연산입니다."""
+    name = "white_balance"
+
+    def __init__(self, red: float = 1.0, green: float = 1.0, blue: float = 1.0):
+        """WhiteBalanceOp 인스턴스를 초기화합니다.
+
+        Args:
+            red: 빨강 채널 이득
+            green: 초록 채널 이득
+            blue: 파랑 채널 이득
+        """
+        self.gains_bgr = (blue, green, red)
+
+    def curve(self, x, channel):
+        if channel >= 3:
+            return x
+        return x * self.gains_bgr[channel]
+
+    def describe(self) -> Hashable:
+        return (self.name, self.gains_bgr)
+
+
+class ColorMatrixOp(PointOp):
+    """3x3 색 변환 행렬 연산입니다 (BGR 순서)."""
+    name = "color_matrix"
+    kind = "matrix"
+
+    def __init__(self, matrix: Sequence[Sequence[float]]):
+        """ColorMatrixOp 인스턴스를 초기화합니다.
+
+        Args:
+            matrix: BGR 순서의 3x3 행렬
+
+        Raises:
+            ValueError: 행렬 형태가 3x3이 아닌 경우
+        """
+        self._matrix = np.asarray(matrix, dtype=np.float64)
+        if self._matrix.shape != (3, 3):
+            raise ValueError(f"색 행렬은 3x3이어야 합니다: {self._matrix.shape}")
+
+    @classmethod
+    def saturation(cls, factor: float) -> "ColorMatrixOp":
+        """휘도를 유지하며 채도를 조정하는 행렬을 만듭니다."""
+        luma = np.tile(np.asarray(LUMA_BGR), (3, 1))
+        return cls(luma + factor * (np.eye(3) - luma))
+
+    def matrix(self, channels):
+        if channels < 3:
+            return None
+        full = np.eye(channels)
+        full[:3, :3] = self._matrix
+        return full
+
+    def describe(self) -> Hashable:
+        return (self.name, tuple(self._matrix.ravel()))
+
+
+class FalseColorOp(PointOp):
+    """휘도를 OpenCV 컬러맵으로 표시하는 의사 컬러 연산입니다."""
+    name = "false_color"
+    kind = "colormap"
+
+    def __init__(self, colormap: int = cv2.COLORMAP_JET):
+        """FalseColorOp 인스턴스를 초기화합니다.
+
+        Args:
+            colormap: OpenCV 컬러맵 상수 (예: cv2.COLORMAP_JET)
+        """
+        self.colormap = colormap
+
+    def table(self, size):
+        ramp = np.arange(256, dtype=np.uint8).reshape(256, 1)
+        colors = cv2.applyColorMap(ramp, self.colormap).reshape(256, 3) / 255.0
+        if size == 256:
+            return colors
+        # 16비트 입력은 256단계 테이블을 선형 보간하여 확장한다
+        xs = np.linspace(0.0, 1.0, size)
+        grid = np.linspace(0.0, 1.0, 256)
+        return np.stack([np.interp(xs, grid, colors[:, c]) for c in range(3)], axis=1)
+
+    def describe(self) -> Hashable:
+        return (self.name, self.colormap)
+
+
+def _profile_bytes(profile) -> bytes:
+    """ICC 프로파일(경로, 바이트, ImageCms 프로파일)의 직렬화 바이트를 반환합니다."""
+    from PIL import ImageCms
+
+    if isinstance(profile, bytes):
+        return profile
+    if isinstance(profile, ImageCms.ImageCmsProfile):
+        return profile.tobytes()
+    if isinstance(profile, ImageCms.core.CmsProfile):
+        return ImageCms.ImageCmsProfile(profile).tobytes()
+    with open(profile, "rb") as f:
+        return f.read()
+
+
+class IccTransformOp(PointOp):
+    """ICC 프로파일 간 색 변환 연산입니다 (BGR, 융합 경계).
+
+    변환은 8비트로 수행하므로 16비트/실수 입력은 8비트로 양자화한 뒤 변환하고
+    원래 자료형 범위로 되돌립니다. 3채널 미만 입력은 그대로 반환합니다.
+    """
+    name = "icc"
+    kind = "barrier"
+
+    def __init__(self, source_profile, target_profile=None, intent: int = 0):
+        """IccTransformOp 인스턴스를 초기화합니다.
+
+        Args:
+            source_profile: 입력 ICC 프로파일 (경로, 바이트 또는 ImageCms 프로파일)
+            target_profile: 출력 ICC 프로파일. None인 경우 sRGB
+            intent: 렌더링 의도 (ImageCms.Intent, 기본 지각적)
+        """
+        from PIL import ImageCms
+
+        if target_profile is None:
+            target_profile = ImageCms.createProfile("sRGB")
+        source_bytes = _profile_bytes(source_profile)
+        target_bytes = _profile_bytes(target_profile)
+        self._transform = ImageCms.buildTransform(
+            ImageCms.ImageCmsProfile(io.BytesIO(source_bytes)),
+            ImageCms.ImageCmsProfile(io.BytesIO(target_bytes)),
+            "RGB", "RGB", renderingIntent=intent)
+        # 타일 캐시 키에 들어가므로 변환 객체가 아닌 프로파일 내용으로 식별한다
+        self._key = (hashlib.sha1(source_bytes).hexdigest(),
+                     hashlib.sha1(target_bytes).hexdigest(), int(intent))
+
+    def apply_barrier(self, array):
+        from PIL import Image, ImageCms
+
+        if array.ndim != 3 or array.shape[2] < 3:
+            return array
+        if array.dtype == np.uint8:
+            bgr = array[..., :3]
+        elif np.issubdtype(array.dtype, np.integer):
+            scale = 255.0 / np.iinfo(array.dtype).max
+            bgr = np.clip(np.rint(array[..., :3] * scale), 0, 255).astype(np.uint8)
+        else:
+            bgr = np.clip(np.rint(array[..., :3] * 255.0), 0, 255).astype(np.uint8)
+        rgb = Image.fromarray(np.ascontiguousarray(bgr[..., ::-1]))
+        ImageCms.applyTransform(rgb, self._transform, inPlace=True)
+        converted = np.asarray(rgb)[..., ::-1]
+        out = array.copy()
+        if array.dtype == np.uint8:
+            out[..., :3] = converted
+        elif np.issubdtype(array.dtype, np.integer):
+            out[..., :3] = np.rint(converted / scale).astype(array.dtype)
+        else:
+            out[..., :3] = converted / 255.0
+        return out
+
+    def describe(self) -> Hashable:
+        return (self.name, self._key)
+
+
+class _Pass:
+    """컴파일된 단일 메모리 패스의 기반 클래스입니다."""
+
+    def run(self, array: np.ndarray) -> np.ndarray:
+        raise NotImplementedError
+
+
+class _LutPass(_Pass):
+    """채널별 LUT 패스입니다. lut는 (항목 수, 채널) 형태입니다."""
+
+    def __init__(self, lut: np.ndarray, dtype: np.dtype):
+        maxv = np.iinfo(dtype).max
+        self.lut = np.clip(np.rint(lut * maxv), 0, maxv).astype(dtype)
+        if dtype == np.uint8:
+            # cv2.LUT는 (1, 256, 채널) 형태의 테이블을 받는다
+            self._cv_lut = np.ascontiguousarray(
+                self.lut.reshape(1, 256, -1) if self.lut.shape[1] > 1 else self.lut[:, 0])
+        else:
+            self._cv_lut = None
+
+    def run(self, array):
+        if self._cv_lut is not None:
+            return cv2.LUT(array, self._cv_lut)
+        # 16비트는 네이티브 커널이 NumPy 팬시 인덱싱보다 몇 배 빠르다
+        out = native.apply_lut(array, self.lut)
+        if out is not None:
+            return out
+        if array.ndim == 2:
+            return self.lut[array, 0]
+        return self.lut[array, np.arange(array.shape[2])]
+
+
+class _MatrixPass(_Pass):
+    """선형 변환 패스입니다 (`cv2.transform`)."""
+
+    def __init__(self, matrix: np.ndarray):
+        self.matrix = matrix
+
+    def run(self, array):
+        out = cv2.transform(array, self.matrix)
+        if out.ndim == 3 and out.shape[2] == 1:
+            out = out[..., 0]
+        return out
+
+
+class _ColormapPass(_Pass):
+    """단일 채널 → BGR 컬러 테이블 조회 패스입니다."""
+
+    def __init__(self, table: np.ndarray, dtype: np.dtype):
+        self.table = np.clip(np.rint(table * 255), 0, 255).astype(np.uint8)
+
+    def run(self, array):
+        return self.table[array]
+
+
+class _BarrierPass(_Pass):
+    """융합할 수 없는 연산을 그대로 실행하는 패스입니다."""
+
+    def __init__(self, op: PointOp):
+        self.op = op
+
+    def run(self, array):
+        return self.op.apply_barrier(array)
+
+
+class _FloatPass(_Pass):
+    """정수형이 아닌 배열에 연산을 순차 적용하는 대체 패스입니다.
+
+    값은 [0, 1]로 정규화되어 있다고 보며, 결과도 float32로 반환합니다.
+    컬러 테이블은 256단계로 조회합니다.
+    """
+
+    def __init__(self, ops: List[PointOp]):
+        self.ops = ops
+
+    def run(self, array):
+        out = array.astype(np.float32, copy=True)
+        for op in self.ops:
+            channels = 1 if out.ndim == 2 else out.shape[2]
+            if op.kind == "curve":
+                if channels == 1:
+                    out = op.curve(out, 0).astype(np.float32)
+                else:
+                    for c in range(channels):
+                        out[..., c] = op.curve(out[..., c], c)
+            elif op.kind == "matrix":
+                matrix = op.matrix(channels)
+                if matrix is not None:
+                    out = _MatrixPass(matrix.astype(np.float32)).run(out)
+            elif op.kind == "colormap":
+                if channels > 1:
+                    # 다채널 입력은 휘도로 축소한 뒤 테이블을 조회한다
+                    luma = np.zeros((1, channels), dtype=np.float32)
+                    luma[0, :3] = LUMA_BGR
+                    out = _MatrixPass(luma).run(out)
+                table = op.table(256).astype(np.float32)
+                indices = np.clip(np.rint(out * 255.0), 0, 255).astype(np.intp)
+                out = table[indices]
+            elif op.kind == "barrier":
+                out = op.apply_barrier(out).astype(np.float32, copy=False)
+            else:
+                raise ValueError(f"실수 영상에 적용할 수 없는 점 연산입니다: {op.kind}")
+        return out
+
+
+class PointProgram:
+    """`compile_point_ops()`가 만든 패스 목록입니다.
+
+    속성:
+        passes (List[_Pass]): 순서대로 실행할 메모리 패스 목록
+    """
+
+    def __init__(self, passes: List[_Pass]):
+        self.passes = passes
+
+    def apply(self, array: np.ndarray) -> np.ndarray:
+        """모든 패스를 순서대로 적용합니다."""
+        for step in self.passes:
+            array = step.run(array)
+        return array
+
+    def __len__(self) -> int:
+        return len(self.passes)
+
+
+def compile_point_ops(ops: Sequence[PointOp], dtype, channels: int) -> PointProgram:
+    """점 연산 목록을 최소 패스 수의 프로그램으로 컴파일합니다.
+
+    Args:
+        ops: 적용 순서대로 나열된 점 연산
+        dtype: 입력 배열 자료형
+        channels: 입력 채널 수
+
+    Returns:
+        PointProgram: 컴파일된 프로그램
+    """
+    dtype = np.dtype(dtype)
+    if dtype not in (np.uint8, np.uint16):
+        return PointProgram([_FloatPass(list(ops))])
+
+    # 하나의 융합 구간은 [LUT] → [행렬] → [컬러 테이블] 순서의 최대 3패스로 구성된다
+    passes: List[_Pass] = []
+    lut: Optional[np.ndarray] = None        # 누적 중인 (size, channels) 실수 LUT
+    matrix: Optional[np.ndarray] = None     # 누적 중인 변환 행렬
+    table: Optional[np.ndarray] = None      # 누적 중인 (size, 3) 컬러 테이블
+
+    def size() -> int:
+        return 256 if dtype == np.uint8 else 65536
+
+    def flush() -> None:
+        nonlocal lut, matrix, table, dtype, channels
+        if lut is not None:
+            passes.append(_LutPass(lut, dtype))
+        if matrix is not None:
+            passes.append(_MatrixPass(matrix))
+            channels = matrix.shape[0]
+        if table is not None:
+            passes.append(_ColormapPass(table, dtype))
+            # 컬러 테이블 출력은 항상 8비트 BGR이다
+            dtype, channels = np.dtype(np.uint8), 3
+        lut = matrix = table = None
+
+    for op in ops:
+        if op.kind == "curve":
+            if table is not None:
+                # 컬러 테이블 값에 곡선을 합성한다
+                table = np.clip(np.stack([op.curve(table[:, c], c) for c in range(3)],
+                                         axis=1), 0.0, 1.0)
+                continue
+            if matrix is not None:
+                flush()
+            if lut is None:
+                lut = np.tile(np.linspace(0.0, 1.0, size())[:, None], (1, channels))
+            lut = np.clip(np.stack([op.curve(lut[:, c], c) for c in range(channels)],
+                                   axis=1), 0.0, 1.0)
+        elif op.kind == "matrix":
+            if table is not None:
+                flush()
+            in_channels = matrix.shape[0] if matrix is not None else channels
+            step = op.matrix(in_channels)
+            if step is None:
+                continue
+            matrix = step if matrix is None else step @ matrix
+        elif op.kind == "colormap":
+            if table is not None:
+                flush()
+            in_channels = matrix.shape[0] if matrix is not None else channels
+            if in_channels > 1:
+                # 다채널 입력은 휘도로 축소한 뒤 테이블을 조회한다
+                luma = np.zeros((1, in_channels))
+                luma[0, :3] = LUMA_BGR
+                matrix = luma if matrix is None else luma @ matrix
+                table = op.table(size())
+            elif lut is not None and matrix is None:
+                # 단일 채널 LUT 뒤의 컬러 테이블은 LUT를 미리 조회해 하나로 합성한다
+                indices = np.rint(lut[:, 0] * (size() - 1)).astype(np.intp)
+                table = op.table(size())[indices]
+                lut = None
+            else:
+                table = op.table(size())
+        else:
+            flush()
+            passes.append(_BarrierPass(op))
+    flush()
+    return PointProgram(passes)
+
+
+class FusedPointStage(FilterStage):
+    """연속된 점 연산을 하나로 묶은 필터 단계입니다.
+
+    입력 자료형/채널 수별로 컴파일 결과를 보관합니다.
+
+    속성:
+        ops (List[PointOp]): 묶인 점 연산 목록
+    """
+    name = "fused_point_ops"
+    radius = 0
+
+    def __init__(self, ops: Sequence[PointOp]):
+        self.ops = list(ops)
+        self._programs = {}
+
+    def program(self, dtype, channels: int) -> PointProgram:
+        """자료형과 채널 수에 맞는 컴파일된 프로그램을 반환합니다."""
+        key = (np.dtype(dtype).str, channels)
+        program = self._programs.get(key)
+        if program is None:
+            program = compile_point_ops(self.ops, dtype, channels)
+            self._programs[key] = program
+        return program
+
+    def apply(self, array: np.ndarray) -> np.ndarray:
+        channels = 1 if array.ndim == 2 else array.shape[2]
+        return self.program(array.dtype, channels).apply(array)
+
+    def describe(self) -> Hashable:
+        return (self.name,) + tuple(op.describe() for op in self.ops)
+
+
+def fuse_stages(stages: Sequence[FilterStage]) -> List[FilterStage]:
+    """필터 단계 목록에서 연속된 점 연산을 `FusedPointStage`로 묶습니다.
+
+    Args:
+        stages: 원래 필터 단계 목록
+
+    Returns:
+        List[FilterStage]: 점 연산이 융합된 단계 목록
+    """
+    fused: List[FilterStage] = []
+    run: List[PointOp] = []
+    for stage in stages:
+        if isinstance(stage, PointOp):
+            run.append(stage)
+            continue
+        if run:
+            fused.append(FusedPointStage(run))
+            run = []
+        fused.append(stage)
+    if run:
+        fused.append(FusedPointStage(run))
+    return fused
@@ -0,0 +1,209 @@
+"""
+이미지 피라미드(다중 해상도) 타일 소스 모듈입니다.
+
+레벨 0은 `ImageData`의 원본 배열을 그대로 사용하고, 거친 레벨은
+처음 요청될 때 바로 윗 레벨을 INTER_AREA로 1/2 축소하여 생성합니다.
+`release()`로 원본 픽셀을 내린 뒤에도 다음 요청 시 파일에서 다시 읽으므로,
+이미 캐시된 타일은 같은 키로 계속 사용할 수 있습니다. 원본 파일이 다시 쓰이면
+`replace_data()`로 새 픽셀을 넣고 바뀐 영역과 겹치는 캐시 타일만 무효화합니다.
+"""
+
+import threading
+from typing import Callable, Dict, Hashable, Iterable, Optional, Set, Tuple
+
+import cv2
+import numpy as np
+
+from ...utils import native
+from ...utils.buffer_view import pinned_view
+from ..image.image_data import ImageData
+from .tile_cache import TileCache, _contains_key
+from .tile_source import TileSource
+
+# 피라미드와 같은 타일 격자를 쓰는 파생 소스 종류 (키의 두 번째 원소가 입력 소스 키)
+SAME_GRID_KINDS = ("filter", "composite", "index")
+
+
+def downsample(array: np.ndarray, size) -> np.ndarray:
+    """INTER_AREA로 배열을 축소합니다.
+
+    OpenCV resize는 4채널까지만 지원하므로 다중분광 배열은 네이티브 확장으로
+    한 번에 축소하고, 확장이 없으면 4채널씩 나누어 처리합니다.
+
+    Args:
+        array: 입력 배열
+        size: 출력 (너비, 높이)
+    """
+    if array.ndim == 2 or array.shape[2] <= 4:
+        return cv2.resize(array, size, interpolation=cv2.INTER_AREA)
+    out = native.area_resize(array, size)
+    if out is not None:
+        return out
+    out = np.empty((size[1], size[0], array.shape[2]), dtype=array.dtype)
+    for start in range(0, array.shape[2], 4):
+        chunk = cv2.resize(np.ascontiguousarray(array[..., start:start + 4]), size,
+                           interpolation=cv2.INTER_AREA)
+        out[..., start:start + 4] = chunk.reshape(size[1], size[0], -1)
+    return out
+
+
+class ImagePyramid(TileSource):
+    """`ImageData`를 레벨별 타일로 제공하는 피라미드입니다.
+
+    속성:
+        image_data (ImageData): 원본 이미지 데이터
+    """
+
+    def __init__(self, image_data: ImageData, tile_size: int = 256,
+                 cache: Optional[TileCache] = None):
+        """ImagePyramid 인스턴스를 초기화합니다.
+
+        Args:
+            image_data: 로드된 이미지 데이터
+            tile_size: 타일 한 변의 픽셀 수
+            cache: 사용할 타일 캐시. None인 경우 공유 캐시 사용
+
+        Raises:
+            ValueError: 이미지가 로드되지 않은 경우
+        """
+        if not image_data.is_loaded:
+            raise ValueError("로드되지 않은 이미지로 피라미드를 만들 수 없습니다.")
+        data = image_data.data
+        height, width = data.shape[:2]
+        channels = 1 if data.ndim == 2 else data.shape[2]
+        super().__init__(width, height, channels, data.dtype, tile_size, cache)
+        self.image_data = image_data
+        self._levels: Dict[int, np.ndarray] = {0: data}
+        self._lock = threading.Lock()
+
+    @property
+    def cache_key(self) -> Hashable:
+        return ("pyramid", self.token)
+
+    def level_array(self, level: int) -> np.ndarray:
+        """레벨 전체 배열을 반환합니다. 없으면 윗 레벨에서 생성합니다.
+
+        Args:
+            level: 피라미드 레벨
+
+        Raises:
+            ValueError: 레벨이 범위를 벗어난 경우
+        """
+        if not 0 <= level < self.num_levels:
+            raise ValueError(f"잘못된 피라미드 레벨입니다: {level}")
+        array = self._levels.get(level)
+        if array is not None:
+            return array
+        if level == 0:
+            with self._lock:
+                if 0 not in self._levels:
+                    # release() 이후 첫 요청: 원본을 다시 읽는다
+                    self.image_data.load()
+                    self._levels[0] = self.image_data.data
+                return self._levels[0]
+        finer = self.level_array(level - 1)
+        with self._lock:
+            array = self._levels.get(level)
+            if array is None:
+                w, h = self.level_size(level)
+                array = downsample(finer, (w, h))
+                self._levels[level] = array
+        return array
+
+    def read_region(self, level: int, x: int, y: int, w: int, h: int) -> np.ndarray:
+        # 잘라낸 뷰가 캐시에 들어가면 레벨 배열 전체가 해제되지 않으므로 복사한다
+        return self.level_array(level)[y:y + h, x:x + w].copy()
+
+    def region_view(self, level: int, x: int, y: int, w: int, h: int) -> np.ndarray:
+        # 명시적인 읽기 전용 경로만 레벨 배열을 복사 없이 가리킨다
+        self.check_region(level, x, y, w, h)
+        return pinned_view(self.level_array(level)[y:y + h, x:x + w])
+
+    def release_levels(self) -> None:
+        """생성해 둔 축소 레벨 배열을 해제합니다."""
+        with self._lock:
+            self._levels = {k: v for k, v in self._levels.items() if k == 0}
+
+    def release(self) -> None:
+        """원본 픽셀과 축소 레벨 배열을 모두 해제합니다 (필요 시 다시 읽음)."""
+        with self._lock:
+            self._levels = {}
+            self.image_data.unload()
+
+    def replace_data(self, image_data: ImageData,
+                     rects: Iterable[Tuple[int, int, int, int]], margin: int = 1) -> int:
+        """원본을 같은 형태의 새 이미지 데이터로 바꾸고 바뀐 영역의 캐시 타일만 제거합니다.
+
+        축소 레벨 배열은 다음 요청 시 새 원본에서 다시 만들어집니다. 바뀌지 않은
+        영역의 타일(파생 소스 타일 포함)은 새 원본으로 계산해도 같으므로 유지됩니다.
+
+        Args:
+            image_data: 다시 읽은 이미지 데이터
+            rects: 바뀐 영역 사각형 (레벨 0 좌표 x, y, 너비, 높이)
+            margin: 바뀐 영역 주변에 함께 제거할 레벨 픽셀 수 (필터 헤일로 등)
+
+        Returns:
+            int: 제거된 타일 수
+
+        Raises:
+            ValueError: 새 데이터의 크기, 채널 수, 자료형이 다른 경우
+        """
+        data = image_data.data
+        channels = 1 if data is None or data.ndim == 2 else data.shape[2]
+        if (data is None or data.shape[:2] != (self.height, self.width)
+                or channels != self.channels or data.dtype != self.dtype):
+            raise ValueError("형태가 다른 영상으로는 피라미드를 갱신할 수 없습니다.")
+        with self._lock:
+            self.image_data = image_data
+            self._levels = {0: data}
+        return self.cache.invalidate(self.changed_tile_predicate(rects, margin))
+
+    def changed_tile_predicate(self, rects: Iterable[Tuple[int, int, int, int]],
+                               margin: int = 1) -> Callable[[Hashable], bool]:
+        """바뀐 영역의 영향을 받는 타일 키를 판별하는 함수를 만듭니다.
+
+        이 피라미드와 같은 격자의 파생 소스(필터, 밴드 합성/지수) 타일은 영역과
+        겹칠 때만, 좌표가 다른 파생 소스(재투영 등)의 타일은 모두 해당됩니다.
+        축소 레벨은 INTER_AREA 경계가 이웃 픽셀에 걸칠 수 있으므로 margin은
+        최소 1로 둡니다.
+
+        Args:
+            rects: 바뀐 영역 사각형 (레벨 0 좌표 x, y, 너비, 높이)
+            margin: 바뀐 영역 주변에 함께 포함할 레벨 픽셀 수
+
+        Returns:
+            Callable[[Hashable], bool]: 캐시 키를 받아 영향 여부를 반환하는 함수
+        """
+        dirty = self._dirty_tiles(rects, max(1, margin))
+        own = self.cache_key
+
+        def affected(key: Hashable) -> bool:
+            if not _contains_key(key, own):
+                return False
+            prefix = key[0]
+            while prefix != own:
+                if not (isinstance(prefix, tuple) and prefix and prefix[0] in SAME_GRID_KINDS):
+                    return True
+                prefix = prefix[1]
+            return key[1:4] in dirty
+
+        return affected
+
+    def _dirty_tiles(self, rects: Iterable[Tuple[int, int, int, int]],
+                     margin: int) -> Set[Tuple[int, int, int]]:
+        """바뀐 영역과 겹치는 (레벨, 열, 행) 집합을 계산합니다."""
+        dirty = set()
+        rects = list(rects)
+        size = self.tile_size
+        for level in range(self.num_levels):
+            scale = 1 << level
+            columns, rows = self.tile_grid(level)
+            for x, y, w, h in rects:
+                col0 = max(0, (x // scale - margin) // size)
+                row0 = max(0, (y // scale - margin) // size)
+                col1 = min(columns - 1, (-(-(x + w) // scale) + margin - 1) // size)
+                row1 = min(rows - 1, (-(-(y + h) // scale) + margin - 1) // size)
+                for row in range(row0, row1 + 1):
+                    for col in range(col0, col1 + 1):
+                        dirty.add((level, col, row))
+        return dirty
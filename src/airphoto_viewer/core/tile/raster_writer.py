@@ -0,0 +1,478 @@
+"""
+행 띠(row band) 단위로 래스터를 스트리밍 저장하는 파일 작성기 모듈입니다.
+
+모든 작성기는 같은 두 단계 인터페이스를 가집니다.
+
+* `encode_band(index, band)`: 띠 하나를 압축합니다. 다른 띠와 독립적이므로
+  여러 작업자 스레드에서 동시에 호출할 수 있습니다 (zlib, libjpeg는 GIL 해제).
+* `write_payload(payload)`: 압축된 띠를 띠 순서대로 파일에 씁니다.
+
+메모리에는 처리 중인 띠만 올라가므로 출력 크기와 무관하게 사용량이 제한됩니다.
+
+* `TiledTiffWriter`: 타일 TIFF/BigTIFF (`TileEncoder`로 압축), 선택적으로 GeoTIFF 태그
+* `PngStreamWriter`: 띠마다 독립 Deflate 블록을 만들어 이어 붙이는 PNG
+* `JpegStreamWriter`: MCU 행마다 따로 인코딩해 재시작 마커로 이어 붙이는 JPEG
+"""
+
+import io
+import struct
+import zlib
+from typing import List, Optional, Sequence, Tuple
+
+import numpy as np
+from PIL import Image
+
+from ..image.georef import GeoTransform
+from ..image.tiff_ifd import TIFF_DOUBLE, TIFF_LONG, TIFF_LONG8, TIFF_SHORT, encode_ifd
+
+# TIFF 압축 코드
+COMPRESSION_CODES = {"none": 1, "jpeg": 7, "deflate": 8, "zstd": 50000, "webp": 50001}
+
+# numpy 자료형 → TIFF SampleFormat (1: 부호 없음, 2: 부호 있음, 3: 실수)
+_SAMPLE_FORMATS = {"u": 1, "i": 2, "f": 3}
+
+# 클래식 TIFF 한계 (이보다 크면 BigTIFF로 저장)
+CLASSIC_TIFF_LIMIT = 2 ** 32 - 2 ** 26
+
+
+def geotiff_entries(geotransform: Optional[GeoTransform],
+                    crs: Optional[str]) -> List[Tuple[int, tuple, Sequence]]:
+    """GeoTIFF 태그 항목(모델 변환과 GeoKey)을 만듭니다.
+
+    Args:
+        geotransform: 픽셀 → 지상 변환. None이면 빈 목록
+        crs: 좌표계. EPSG 코드로 표현할 수 있을 때만 GeoKey를 씁니다
+    """
+    if geotransform is None:
+        return []
+    c = geotransform.coefficients
+    entries = []
+    if c[2] == 0 and c[4] == 0:
+        entries.append((33550, TIFF_DOUBLE, (c[1], -c[5], 0.0)))
+        entries.append((33922, TIFF_DOUBLE, (0.0, 0.0, 0.0, c[0], c[3], 0.0)))
+    else:
+        entries.append((34264, TIFF_DOUBLE, (c[1], c[2], 0.0, c[0], c[4], c[5], 0.0, c[3],
+                                             0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0)))
+    code, geographic = _epsg_code(crs)
+    if code is not None:
+        keys = [1, 1, 0, 3,
+                1024, 0, 1, 2 if geographic else 1,
+                1025, 0, 1, 1,
+                2048 if geographic else 3072, 0, 1, code]
+        entries.append((34735, TIFF_SHORT, keys))
+    return entries
+
+
+def _epsg_code(crs: Optional[str]) -> Tuple[Optional[int], bool]:
+    """좌표계의 (EPSG 코드, 지리 좌표계 여부)를 반환합니다."""
+    if not crs:
+        return None, False
+    from pyproj import CRS
+    try:
+        parsed = CRS.from_user_input(crs)
+    except Exception:
+        return None, False
+    code = parsed.to_epsg()
+    return (code if code is not None and code < 32767 else None), parsed.is_geographic
+
+
+def world_file_text(geotransform: GeoTransform) -> str:
+    """월드 파일 6줄(좌상단 픽셀 중심 기준)을 만듭니다."""
+    c0, c1, c2, c3, c4, c5 = geotransform.coefficients
+    values = (c1, c4, c2, c5, c0 + 0.5 * (c1 + c2), c3 + 0.5 * (c4 + c5))
+    return "".join(f"{v:.12f}\n" for v in values)
+
+
+class TileEncoder:
+    """TIFF 타일 압축기입니다. 타일 TIFF와 COG 작성기가 함께 사용합니다.
+
+    정수 영상의 Deflate/ZSTD 압축에는 수평 차분 예측기(Predictor=2)를
+    적용합니다. JPEG 타일은 4:2:0 YCbCr, WebP 타일은 품질 100이면 무손실로
+    인코딩합니다. 타일마다 독립적이므로 여러 스레드에서 동시에 호출할 수 있습니다.
+
+    속성:
+        compression (str): 압축 방식
+        code (int): TIFF 압축 코드
+        predictor (bool): 수평 차분 예측기 사용 여부
+    """
+
+    def __init__(self, compression: str, dtype, channels: int, tile_size: int,
+                 level: Optional[int] = None, quality: int = 75):
+        """TileEncoder 인스턴스를 초기화합니다.
+
+        Args:
+            compression: 'none', 'deflate', 'zstd', 'jpeg', 'webp'
+            dtype: 픽셀 자료형
+            channels: 채널 수
+            tile_size: 타일 크기 (16의 배수)
+            level: Deflate/ZSTD 압축 수준. None이면 각 방식의 기본값 (6/9)
+            quality: JPEG/WebP 품질
+
+        Raises:
+            ValueError: 지원하지 않는 압축 방식, 형식, 타일 크기인 경우
+        """
+        if compression not in COMPRESSION_CODES:
+            raise ValueError(f"지원하지 않는 TIFF 압축 방식입니다: {compression}")
+        if tile_size % 16:
+            raise ValueError(f"타일 크기는 16의 배수여야 합니다: {tile_size}")
+        self.dtype = np.dtype(dtype).newbyteorder("<")
+        self.channels, self.tile_size = channels, tile_size
+        self.compression = compression
+        self.code = COMPRESSION_CODES[compression]
+        self.quality = quality
+        lossy_channels = {"jpeg": (1, 3), "webp": (3, 4)}.get(compression)
+        if lossy_channels and (self.dtype != np.uint8 or channels not in lossy_channels):
+            raise ValueError(f"{compression.upper()} 타일로 저장할 수 없는 형식입니다: "
+                             f"{channels}채널 {self.dtype}")
+        self._zstd = None
+        if compression == "zstd":
+            try:
+                import zstandard
+            except ImportError:
+                raise ValueError("ZSTD 압축에 필요한 zstandard 모듈이 없습니다.")
+            self._zstd = zstandard
+        self.level = level if level is not None else (9 if compression == "zstd" else 6)
+        # 정수 영상은 수평 차분 후 압축하면 더 작고 빠르다
+        self.predictor = compression in ("deflate", "zstd") and self.dtype.kind in "ui"
+
+    def encode_band(self, band: np.ndarray, width: int) -> List[bytes]:
+        """타일 높이 이하의 띠 하나를 타일로 잘라 압축합니다.
+
+        Args:
+            band: (행, 열[, 채널]) 띠. 파일 채널 순서(RGB)
+            width: 영상 너비 (오른쪽 끝 타일은 0으로 채움)
+        """
+        t = self.tile_size
+        cols = -(-width // t)
+        band = band.reshape(band.shape[0], band.shape[1], -1).astype(self.dtype, copy=False)
+        padded = np.zeros((t, cols * t, band.shape[2]), dtype=self.dtype)
+        padded[:band.shape[0], :band.shape[1]] = band
+        if self.predictor:
+            # 수평 차분 예측기 (Predictor=2): 타일마다 왼쪽 픽셀과의 차이를 저장
+            padded = padded.reshape(t, cols, t, -1)
+            padded[:, :, 1:] -= padded[:, :, :-1].copy()
+            padded = padded.reshape(t, cols * t, -1)
+        return [self.encode_tile(np.ascontiguousarray(padded[:, col * t:(col + 1) * t]))
+                for col in range(cols)]
+
+    def encode_tile(self, tile: np.ndarray) -> bytes:
+        """(예측기를 적용한) 타일 하나를 압축합니다."""
+        if self.compression == "deflate":
+            return zlib.compress(tile.tobytes(), self.level)
+        if self.compression == "zstd":
+            return self._zstd.ZstdCompressor(level=self.level).compress(tile.tobytes())
+        if self.compression in ("jpeg", "webp"):
+            buffer = io.BytesIO()
+            image = Image.fromarray(tile[..., 0] if self.channels == 1 else tile)
+            if self.compression == "jpeg":
+                options = {"quality": self.quality}
+                if self.channels == 3:
+                    options["subsampling"] = 2
+                image.save(buffer, "JPEG", **options)
+            else:
+                image.save(buffer, "WEBP", quality=self.quality,
+                           lossless=self.quality >= 100, method=4)
+            return buffer.getvalue()
+        return tile.tobytes()
+
+    def tags(self, width: int, height: int) -> List[Tuple[int, tuple, Sequence]]:
+        """영상 구조 IFD 태그 항목을 반환합니다 (타일 위치 제외)."""
+        bits = self.dtype.itemsize * 8
+        # 3채널 정수 영상은 RGB로 기록한다. 4채널은 8비트만 RGBA로 보고,
+        # 16비트 4채널(RGB+NIR 등)은 알파로 오해되지 않도록 일반 밴드로 둔다
+        rgb = ((self.channels == 3 and self.dtype.kind in "ui")
+               or (self.channels == 4 and self.dtype == np.uint8))
+        photometric = 2 if rgb else 1
+        if self.compression == "jpeg" and self.channels == 3:
+            # JPEG 타일은 4:2:0 YCbCr로 압축되어 있다
+            photometric = 6
+        entries = [
+            (256, TIFF_LONG, (width,)),
+            (257, TIFF_LONG, (height,)),
+            (258, TIFF_SHORT, (bits,) * self.channels),
+            (259, TIFF_SHORT, (self.code,)),
+            (262, TIFF_SHORT, (photometric,)),
+            (277, TIFF_SHORT, (self.channels,)),
+            (284, TIFF_SHORT, (1,)),
+            (322, TIFF_LONG, (self.tile_size,)),
+            (323, TIFF_LONG, (self.tile_size,)),
+            (339, TIFF_SHORT, (_SAMPLE_FORMATS.get(self.dtype.kind, 1),) * self.channels),
+        ]
+        if self.predictor:
+            entries.append((317, TIFF_SHORT, (2,)))
+        if photometric == 6:
+            entries.append((530, TIFF_SHORT, (2, 2)))
+        extra = self.channels - (3 if rgb else 1)
+        if extra > 0:
+            # RGBA의 네 번째 채널은 알파, 다중밴드의 나머지 채널은 일반 밴드
+            alpha = rgb and self.channels == 4
+            entries.append((338, TIFF_SHORT, (2,) if alpha else (0,) * extra))
+        return entries
+
+
+class TiledTiffWriter:
+    """타일 TIFF를 띠 단위로 스트리밍 저장합니다.
+
+    타일 압축은 `TileEncoder`가 맡습니다. 타일을 압축되는 대로 파일 앞쪽부터
+    쓰고, 마지막에 IFD를 붙인 뒤 헤더의 첫 IFD 위치를 고칩니다. 예상 크기가
+    4GB에 가까우면 BigTIFF로 씁니다.
+
+    속성:
+        band_rows (int): `encode_band()`가 받는 띠 높이 (= 타일 크기)
+    """
+
+    def __init__(self, path: str, width: int, height: int, channels: int, dtype,
+                 tile_size: int = 256, compression: str = "deflate",
+                 level: Optional[int] = None, quality: int = 75,
+                 geotransform: Optional[GeoTransform] = None, crs: Optional[str] = None,
+                 bigtiff: Optional[bool] = None):
+        """TiledTiffWriter 인스턴스를 초기화합니다.
+
+        Args:
+            path: 출력 경로
+            width, height: 영상 크기
+            channels: 채널 수 (3/4채널은 RGB/RGBA로 기록)
+            dtype: 픽셀 자료형
+            tile_size: 타일 크기 (16의 배수)
+            compression: 'deflate', 'zstd', 'jpeg', 'webp', 'none'
+            level: Deflate/ZSTD 압축 수준
+            quality: JPEG/WebP 품질
+            geotransform: GeoTIFF 태그로 기록할 지오트랜스폼
+            crs: GeoTIFF 태그로 기록할 좌표계
+            bigtiff: BigTIFF 사용 여부. None이면 예상 크기로 결정
+
+        Raises:
+            ValueError: 지원하지 않는 압축 방식이나 타일 크기인 경우
+        """
+        self.encoder = TileEncoder(compression, dtype, channels, tile_size, level, quality)
+        self.width, self.height, self.channels = width, height, channels
+        self.dtype = self.encoder.dtype
+        self.tile_size = self.band_rows = tile_size
+        self.geotransform, self.crs = geotransform, crs
+        if bigtiff is None:
+            bigtiff = width * height * channels * self.dtype.itemsize > CLASSIC_TIFF_LIMIT
+        self.bigtiff = bigtiff
+        self._offsets: List[int] = []
+        self._counts: List[int] = []
+        self._file = open(path, "wb")
+        # 첫 IFD 위치는 닫을 때 채운다
+        self._file.write(b"II" + (struct.pack("<HHHQ", 43, 8, 0, 0) if bigtiff
+                                  else struct.pack("<HI", 42, 0)))
+
+    def encode_band(self, index: int, band: np.ndarray) -> List[bytes]:
+        """띠 하나를 타일로 잘라 압축합니다 (스레드 안전)."""
+        return self.encoder.encode_band(band, self.width)
+
+    def write_payload(self, payload: List[bytes]) -> None:
+        """압축된 타일을 순서대로 씁니다."""
+        for data in payload:
+            self._offsets.append(self._file.tell())
+            self._counts.append(len(data))
+            self._file.write(data)
+
+    def tags(self) -> List[Tuple[int, tuple, Sequence]]:
+        """기본 IFD 태그 항목을 반환합니다 (타일 위치 제외)."""
+        return (self.encoder.tags(self.width, self.height)
+                + geotiff_entries(self.geotransform, self.crs))
+
+    def close(self) -> None:
+        """IFD를 쓰고 파일을 닫습니다."""
+        if self._file.closed:
+            return
+        location = TIFF_LONG8 if self.bigtiff else TIFF_LONG
+        entries = self.tags() + [(324, location, self._offsets), (325, location, self._counts)]
+        offset = self._file.seek(0, io.SEEK_END)
+        if offset % 2:
+            self._file.write(b"\x00")
+            offset += 1
+        self._file.write(encode_ifd(entries, offset, self.bigtiff))
+        self._file.seek(8 if self.bigtiff else 4)
+        self._file.write(struct.pack("<Q" if self.bigtiff else "<I", offset))
+        self._file.close()
+
+    def abort(self) -> None:
+        """쓰기를 중단하고 파일을 닫습니다."""
+        self._file.close()
+
+
+def adler32_combine(adler1: int, adler2: int, length2: int) -> int:
+    """두 구간의 Adler-32 값을 이어 붙인 값을 계산합니다 (zlib adler32_combine)."""
+    base = 65521
+    rem = length2 % base
+    sum1 = adler1 & 0xFFFF
+    sum2 = (rem * sum1) % base
+    sum1 += (adler2 & 0xFFFF) + base - 1
+    sum2 += ((adler1 >> 16) & 0xFFFF) + ((adler2 >> 16) & 0xFFFF) + base - rem
+    sum1 %= base
+    sum2 %= base
+    return sum1 | (sum2 << 16)
+
+
+def _png_chunk(kind: bytes, data: bytes) -> bytes:
+    """PNG 청크 하나(길이, 종류, 내용, CRC)를 만듭니다."""
+    return (struct.pack(">I", len(data)) + kind + data
+            + struct.pack(">I", zlib.crc32(kind + data) & 0xFFFFFFFF))
+
+
+class PngStreamWriter:
+    """PNG를 띠 단위로 병렬 압축해 스트리밍 저장합니다.
+
+    띠마다 독립된 raw Deflate 스트림을 동기 플러시로 끝내 이어 붙이므로
+    (pigz 방식) 하나의 올바른 zlib 스트림이 됩니다. 행 필터는 띠 안에서만
+    계산되는 Sub(1) 필터를 사용합니다.
+
+    속성:
+        band_rows (int): 띠 높이
+    """
+
+    _COLOR_TYPES = {1: 0, 2: 4, 3: 2, 4: 6}
+
+    def __init__(self, path: str, width: int, height: int, channels: int, dtype,
+                 level: int = 6, band_rows: int = 256):
+        """PngStreamWriter 인스턴스를 초기화합니다.
+
+        Raises:
+            ValueError: PNG로 저장할 수 없는 채널 수나 자료형인 경우
+        """
+        dtype = np.dtype(dtype)
+        if channels not in self._COLOR_TYPES or dtype not in (np.uint8, np.uint16):
+            raise ValueError(f"PNG로 저장할 수 없는 형식입니다: {channels}채널 {dtype}")
+        self.width, self.height, self.channels = width, height, channels
+        self.dtype = dtype.newbyteorder(">")
+        self.level = level
+        self.band_rows = band_rows
+        self._last_index = -(-height // band_rows) - 1
+        self._adler = 1
+        self._file = open(path, "wb")
+        header = struct.pack(">IIBBBBB", width, height, self.dtype.itemsize * 8,
+                             self._COLOR_TYPES[channels], 0, 0, 0)
+        self._file.write(b"\x89PNG\r\n\x1a\n" + _png_chunk(b"IHDR", header))
+        # zlib 헤더 (deflate, 32K 창, 기본 압축)
+        self._file.write(_png_chunk(b"IDAT", b"\x78\x9c"))
+
+    def encode_band(self, index: int, band: np.ndarray) -> Tuple[bytes, int, int]:
+        """띠를 Sub 필터 후 raw Deflate로 압축합니다 (스레드 안전)."""
+        rows = band.reshape(band.shape[0], -1).astype(self.dtype, copy=False)
+        raw = rows.view(np.uint8).reshape(band.shape[0], -1)
+        bpp = self.channels * self.dtype.itemsize
+        filtered = np.empty((raw.shape[0], raw.shape[1] + 1), dtype=np.uint8)
+        filtered[:, 0] = 1
+        filtered[:, 1:bpp + 1] = raw[:, :bpp]
+        np.subtract(raw[:, bpp:], raw[:, :-bpp], out=filtered[:, bpp + 1:])
+        data = filtered.tobytes()
+        compressor = zlib.compressobj(self.level, zlib.DEFLATED, -15)
+        flush = zlib.Z_FINISH if index == self._last_index else zlib.Z_SYNC_FLUSH
+        return compressor.compress(data) + compressor.flush(flush), zlib.adler32(data), len(data)
+
+    def write_payload(self, payload: Tuple[bytes, int, int]) -> None:
+        """압축된 띠를 IDAT 청크로 씁니다."""
+        data, adler, length = payload
+        self._adler = adler32_combine(self._adler, adler, length)
+        self._file.write(_png_chunk(b"IDAT", data))
+
+    def close(self) -> None:
+        """Adler-32 체크섬과 IEND를 쓰고 파일을 닫습니다."""
+        if self._file.closed:
+            return
+        self._file.write(_png_chunk(b"IDAT", struct.pack(">I", self._adler)))
+        self._file.write(_png_chunk(b"IEND", b""))
+        self._file.close()
+
+    def abort(self) -> None:
+        """쓰기를 중단하고 파일을 닫습니다."""
+        self._file.close()
+
+
+class JpegStreamWriter:
+    """JPEG를 MCU 행 단위로 병렬 인코딩해 스트리밍 저장합니다.
+
+    MCU 행마다 표준 허프만 표로 따로 인코딩한 엔트로피 데이터를 재시작
+    마커(RST0~7)로 이어 붙입니다. 재시작 시 DC 예측값이 0으로 돌아가므로
+    독립 인코딩 결과와 같아집니다. 헤더는 첫 행의 헤더에서 높이만 고치고
+    재시작 간격(DRI)을 넣어 씁니다.
+
+    속성:
+        band_rows (int): 띠 높이 (MCU 높이의 배수)
+    """
+
+    def __init__(self, path: str, width: int, height: int, channels: int,
+                 quality: int = 90, band_rows: int = 256):
+        """JpegStreamWriter 인스턴스를 초기화합니다.
+
+        Raises:
+            ValueError: 1/3채널이 아니거나 JPEG 최대 크기를 넘는 경우
+        """
+        if channels not in (1, 3):
+            raise ValueError(f"JPEG로 저장할 수 없는 채널 수입니다: {channels}")
+        if width > 65535 or height > 65535:
+            raise ValueError(f"JPEG 최대 크기(65535)를 넘습니다: {width}x{height}")
+        self.width, self.height, self.channels = width, height, channels
+        self.quality = quality
+        # 4:2:0 컬러는 16x16, 회색조는 8x8 MCU
+        self.mcu = 16 if channels == 3 else 8
+        self.band_rows = max(self.mcu, band_rows // self.mcu * self.mcu)
+        self._file = open(path, "wb")
+        self._header_written = False
+
+    def _encode_strip(self, strip: np.ndarray) -> bytes:
+        """MCU 행 하나를 독립 JPEG로 인코딩합니다."""
+        buffer = io.BytesIO()
+        options = {"quality": self.quality, "optimize": False}
+        if self.channels == 3:
+            options["subsampling"] = 2
+        Image.fromarray(strip).save(buffer, "JPEG", **options)
+        return buffer.getvalue()
+
+    def encode_band(self, index: int, band: np.ndarray) -> Tuple[Optional[bytes], bytes]:
+        """띠의 MCU 행들을 인코딩해 (첫 띠의 헤더, 엔트로피 데이터)를 반환합니다."""
+        band = np.ascontiguousarray(band.reshape(band.shape[0], band.shape[1], -1)
+                                    if self.channels == 3 else band.reshape(band.shape[:2]))
+        first_strip = index * self.band_rows // self.mcu
+        header = None
+        parts = []
+        for offset in range(0, band.shape[0], self.mcu):
+            encoded = self._encode_strip(band[offset:offset + self.mcu])
+            sos = encoded.index(b"\xff\xda")
+            scan = sos + 2 + struct.unpack(">H", encoded[sos + 2:sos + 4])[0]
+            strip = first_strip + offset // self.mcu
+            if strip == 0:
+                header = encoded[:scan]
+            else:
+                parts.append(bytes((0xFF, 0xD0 + (strip - 1) % 8)))
+            parts.append(encoded[scan:-2])
+        return header, b"".join(parts)
+
+    def write_payload(self, payload: Tuple[Optional[bytes], bytes]) -> None:
+        """첫 띠에서 헤더를 고쳐 쓰고, 엔트로피 데이터를 이어 씁니다."""
+        header, data = payload
+        if not self._header_written:
+            self._file.write(self._patch_header(header))
+            self._header_written = True
+        self._file.write(data)
+
+    def _patch_header(self, header: bytes) -> bytes:
+        """SOF의 높이를 전체 높이로 고치고 SOS 앞에 재시작 간격을 넣습니다."""
+        header = bytearray(header)
+        position = 2
+        while position < len(header):
+            marker = header[position + 1]
+            length = struct.unpack(">H", header[position + 2:position + 4])[0]
+            if marker in (0xC0, 0xC1):
+                header[position + 5:position + 7] = struct.pack(">H", self.height)
+            elif marker == 0xDA:
+                interval = -(-self.width // self.mcu)
+                header[position:position] = b"\xff\xdd" + struct.pack(">HH", 4, interval)
+                break
+            position += 2 + length
+        return bytes(header)
+
+    def close(self) -> None:
+        """EOI 마커를 쓰고 파일을 닫습니다."""
+        if self._file.closed:
+            return
+        self._file.write(b"\xff\xd9")
+        self._file.close()
+
+    def abort(self) -> None:
+        """쓰기를 중단하고 파일을 닫습니다."""
+        self._file.close()
@@ -0,0 +1,284 @@
+"""
+선택 영역을 원하는 해상도로 파일에 내보내는 모듈입니다.
+
+영역은 타일 소스(필터 파이프라인이면 현재 조정/필터 포함)에서 출력 행 띠
+단위로 렌더링됩니다. 띠마다 출력 해상도에 맞는 피라미드 레벨에서 필요한
+행만 읽어 아핀 재표본화하므로 원본 전체를 메모리에 올리지 않습니다.
+렌더링과 압축은 작업자 스레드에서 병렬로, 파일 쓰기는 띠 순서대로 진행되며
+동시에 처리 중인 띠 수가 제한되어 메모리 사용량이 일정합니다.
+
+COG 형식은 잘라내고 배율을 적용한 영역을 `RegionSource`로 감싸
+`write_cog`에 넘기며, 내부 오버뷰도 원본에서 직접 재표본화합니다.
+"""
+
+import math
+import os
+from collections import deque
+from concurrent.futures import ThreadPoolExecutor
+from typing import Callable, Hashable, Optional, Tuple
+
+import cv2
+import numpy as np
+
+from ..image.georef import GeoTransform
+from .raster_writer import (JpegStreamWriter, PngStreamWriter, TiledTiffWriter,
+                            world_file_text)
+from .tile_source import TileSource
+
+# 확장자 → 내보내기 형식 (COG는 .tif 확장자에 format='cog'로 지정)
+EXPORT_FORMATS = {
+    ".tif": "tiff", ".tiff": "tiff",
+    ".png": "png",
+    ".jpg": "jpeg", ".jpeg": "jpeg",
+}
+
+# warpAffine 좌표 한계를 피하기 위한 열 조각 너비
+_WARP_CHUNK = 8192
+
+
+def export_region(source: TileSource, path: str,
+                  rect: Optional[Tuple[int, int, int, int]] = None,
+                  scale: float = 1.0, format: Optional[str] = None,
+                  quality: int = 90, compression: str = "deflate",
+                  workers: Optional[int] = None,
+                  geotransform: Optional[GeoTransform] = None, crs: Optional[str] = None,
+                  progress: Optional[Callable[[int, int], None]] = None,
+                  cancelled: Optional[Callable[[], bool]] = None) -> Tuple[int, int]:
+    """레벨 0 사각형 영역을 배율 `scale`로 렌더링해 파일로 저장합니다.
+
+    Args:
+        source: 타일 소스 (현재 조정을 반영하려면 필터 파이프라인)
+        path: 출력 경로
+        rect: 레벨 0 (x, y, w, h). None이면 전체 영상
+        scale: 출력 배율 (0.5이면 가로세로 절반)
+        format: 'tiff', 'cog', 'png', 'jpeg'. None이면 확장자로 결정 (.tif는 'tiff')
+        quality: JPEG 품질 (COG는 JPEG/WebP 품질)
+        compression: COG 압축 방식 ('deflate', 'zstd', 'jpeg', 'webp', 'none')
+        workers: 렌더링/압축 작업자 수. None이면 CPU 코어 수
+        geotransform: 원본 레벨 0 지오트랜스폼 (GeoTIFF 태그/월드 파일로 기록)
+        crs: 좌표계
+        progress: (완료 행 수, 전체 행 수)로 호출되는 함수
+        cancelled: True를 반환하면 중단하는 함수
+
+    Returns:
+        Tuple[int, int]: 출력 (너비, 높이)
+
+    Raises:
+        ValueError: 영역이 비었거나 형식을 지원하지 않는 경우
+        IOError: 파일 쓰기에 실패했거나 중단된 경우
+    """
+    x, y, w, h = _clip_rect(source, rect)
+    if scale <= 0:
+        raise ValueError(f"배율은 양수여야 합니다: {scale}")
+    out_w, out_h = max(1, round(w * scale)), max(1, round(h * scale))
+    if format is None:
+        format = EXPORT_FORMATS.get(os.path.splitext(path)[1].lower())
+    if format not in ("tiff", "cog", "png", "jpeg"):
+        raise ValueError(f"지원하지 않는 내보내기 형식입니다: {path}")
+
+    level = _source_level(source, w, out_w)
+    out_geotransform = _scaled_geotransform(geotransform, x, y, w / out_w, h / out_h)
+    if format == "cog":
+        from .cog_writer import write_cog  # cog_writer가 이 모듈을 가져오므로 지연 임포트
+
+        write_cog(RegionSource(source, (x, y, w, h), (out_w, out_h)), path, compression,
+                  quality=quality, geotransform=out_geotransform, crs=crs,
+                  workers=workers, progress=progress, cancelled=cancelled)
+        return out_w, out_h
+    channels = source.channels
+    if format == "tiff":
+        writer = TiledTiffWriter(path, out_w, out_h, channels, source.dtype,
+                                 tile_size=source.tile_size,
+                                 geotransform=out_geotransform, crs=crs)
+    elif format == "png":
+        writer = PngStreamWriter(path, out_w, out_h, channels, source.dtype)
+    else:
+        if source.dtype != np.uint8:
+            raise ValueError(f"JPEG로 저장할 수 없는 자료형입니다: {source.dtype}")
+        writer = JpegStreamWriter(path, out_w, out_h, channels, quality)
+
+    def render(index: int):
+        r0 = index * writer.band_rows
+        r1 = min(out_h, r0 + writer.band_rows)
+        band = render_band(source, (x, y, w, h), (out_w, out_h), level, r0, r1)
+        return writer.encode_band(index, to_rgb(band))
+
+    bands = -(-out_h // writer.band_rows)
+    workers = workers or os.cpu_count() or 4
+    try:
+        with ThreadPoolExecutor(max_workers=workers, thread_name_prefix="export") as pool:
+            queue = deque()
+            submitted = 0
+            for index in range(bands):
+                # 처리 중인 띠 수를 제한해 메모리를 일정하게 유지한다
+                while submitted < bands and len(queue) < 2 * workers:
+                    queue.append(pool.submit(render, submitted))
+                    submitted += 1
+                if cancelled is not None and cancelled():
+                    for future in queue:
+                        future.cancel()
+                    raise IOError("내보내기가 취소되었습니다.")
+                writer.write_payload(queue.popleft().result())
+                if progress is not None:
+                    progress(min(out_h, (index + 1) * writer.band_rows), out_h)
+        writer.close()
+    except Exception:
+        writer.abort()
+        if os.path.exists(path):
+            os.remove(path)
+        raise
+
+    if format != "tiff" and out_geotransform is not None:
+        _write_sidecars(path, out_geotransform, crs)
+    return out_w, out_h
+
+
+class RegionSource(TileSource):
+    """원본 사각형 영역을 출력 크기로 재표본화해 제공하는 타일 소스입니다.
+
+    레벨 n은 영역 전체를 출력 크기의 1/2^n 크기로 원본의 알맞은 레벨에서
+    직접 재표본화하므로, COG 오버뷰를 레벨 0에서 다시 줄이지 않습니다.
+
+    속성:
+        source (TileSource): 원본 타일 소스
+        rect (Tuple[int, int, int, int]): 원본 레벨 0 (x, y, w, h)
+    """
+
+    def __init__(self, source: TileSource, rect: Tuple[int, int, int, int],
+                 size: Tuple[int, int], tile_size: Optional[int] = None):
+        """RegionSource 인스턴스를 초기화합니다.
+
+        Args:
+            source: 원본 타일 소스
+            rect: 원본 레벨 0 (x, y, w, h). 영상 경계 안이어야 함
+            size: 출력 (너비, 높이)
+            tile_size: 타일 크기. None이면 원본과 같음
+        """
+        super().__init__(size[0], size[1], source.channels, source.dtype,
+                         tile_size or source.tile_size, source.cache)
+        self.source = source
+        self.rect = tuple(rect)
+
+    @property
+    def cache_key(self) -> Hashable:
+        return ("region", self.source.cache_key, self.rect, (self.width, self.height))
+
+    def read_region(self, level: int, x: int, y: int, w: int, h: int) -> np.ndarray:
+        size = self.level_size(level)
+        return render_band(self.source, self.rect, size,
+                           _source_level(self.source, self.rect[2], size[0]),
+                           y, y + h, x, x + w)
+
+
+def render_band(source: TileSource, rect: Tuple[int, int, int, int],
+                size: Tuple[int, int], level: int, r0: int, r1: int,
+                c0: int = 0, c1: Optional[int] = None) -> np.ndarray:
+    """출력 영상의 행 [r0, r1), 열 [c0, c1) 띠를 렌더링합니다.
+
+    출력 픽셀 중심을 레벨 좌표로 정확히 옮기는 아핀 변환을 쓰므로 띠를
+    나누어 렌더링해도 이음매가 생기지 않습니다.
+
+    Args:
+        source: 타일 소스
+        rect: 레벨 0 (x, y, w, h)
+        size: 출력 (너비, 높이)
+        level: 읽을 피라미드 레벨
+        r0, r1: 출력 행 범위
+        c0, c1: 출력 열 범위. c1이 None이면 출력 너비까지
+    """
+    x, y, w, h = rect
+    out_w, out_h = size
+    c1 = out_w if c1 is None else c1
+    factor = 1 << level
+    sx, sy = w / out_w / factor, h / out_h / factor
+
+    # 배율이 정확히 레벨 배율이고 정렬되어 있으면 그대로 잘라 읽는다
+    if sx == 1.0 and sy == 1.0 and x % factor == 0 and y % factor == 0:
+        lw, lh = source.level_size(level)
+        x0, y0 = x // factor + c0, y // factor + r0
+        return source.read_region(level, x0, y0, min(c1 - c0, lw - x0), min(r1 - r0, lh - y0))
+
+    # 출력 (i, j) 중심 → 레벨 좌표: u = x/f + (i + 0.5) * sx - 0.5
+    u0 = x / factor + 0.5 * sx - 0.5
+    v0 = y / factor + 0.5 * sy - 0.5
+    lw, lh = source.level_size(level)
+    top = max(0, int(math.floor(v0 + r0 * sy)) - 1)
+    bottom = min(lh, int(math.ceil(v0 + (r1 - 1) * sy)) + 2)
+    left = max(0, int(math.floor(u0 + c0 * sx)) - 1)
+    right = min(lw, int(math.ceil(u0 + (c1 - 1) * sx)) + 2)
+    region = source.read_region(level, left, top, right - left, bottom - top)
+
+    out = np.empty((r1 - r0, c1 - c0) + region.shape[2:], dtype=region.dtype)
+    for start in range(c0, c1, _WARP_CHUNK):
+        end = min(c1, start + _WARP_CHUNK)
+        matrix = np.array([[sx, 0.0, u0 + start * sx - left],
+                           [0.0, sy, v0 + r0 * sy - top]])
+        out[:, start - c0:end - c0] = _warp(region, matrix, (end - start, r1 - r0))
+    return out
+
+
+def _source_level(source: TileSource, width: int, out_width: int) -> int:
+    """출력 픽셀이 레벨 픽셀 1~2개를 덮는 원본 레벨을 고릅니다 (선형 보간의 앨리어싱 방지)."""
+    return int(np.clip(math.floor(math.log2(max(width / out_width, 1.0))),
+                       0, source.num_levels - 1))
+
+
+def _warp(region: np.ndarray, matrix: np.ndarray, size: Tuple[int, int]) -> np.ndarray:
+    """출력 → 입력 아핀 행렬로 재표본화합니다 (4채널 초과는 나누어 처리)."""
+    flags = cv2.INTER_LINEAR | cv2.WARP_INVERSE_MAP
+    if region.ndim == 2 or region.shape[2] <= 4:
+        return cv2.warpAffine(region, matrix, size, flags=flags,
+                              borderMode=cv2.BORDER_REPLICATE).reshape(
+            (size[1], size[0]) + region.shape[2:])
+    out = np.empty((size[1], size[0], region.shape[2]), dtype=region.dtype)
+    for start in range(0, region.shape[2], 4):
+        chunk = cv2.warpAffine(np.ascontiguousarray(region[..., start:start + 4]), matrix,
+                               size, flags=flags, borderMode=cv2.BORDER_REPLICATE)
+        out[..., start:start + 4] = chunk.reshape(size[1], size[0], -1)
+    return out
+
+
+def to_rgb(band: np.ndarray) -> np.ndarray:
+    """OpenCV의 BGR/BGRA 순서를 파일 형식의 RGB/RGBA 순서로 바꿉니다."""
+    if band.ndim == 3 and band.shape[2] in (3, 4):
+        return band[..., [2, 1, 0] + ([3] if band.shape[2] == 4 else [])]
+    return band
+
+
+def _clip_rect(source: TileSource, rect) -> Tuple[int, int, int, int]:
+    """사각형을 영상 경계로 잘라 정수 (x, y, w, h)로 반환합니다."""
+    if rect is None:
+        return 0, 0, source.width, source.height
+    x, y, w, h = rect
+    x0, y0 = max(0, int(math.floor(x))), max(0, int(math.floor(y)))
+    x1 = min(source.width, int(math.ceil(x + w)))
+    y1 = min(source.height, int(math.ceil(y + h)))
+    if x1 <= x0 or y1 <= y0:
+        raise ValueError(f"내보낼 영역이 영상과 겹치지 않습니다: {rect}")
+    return x0, y0, x1 - x0, y1 - y0
+
+
+def _scaled_geotransform(geotransform: Optional[GeoTransform], x: int, y: int,
+                         step_x: float, step_y: float) -> Optional[GeoTransform]:
+    """잘라내고 크기를 바꾼 출력 영상의 지오트랜스폼을 계산합니다."""
+    if geotransform is None:
+        return None
+    c = geotransform.coefficients
+    return GeoTransform((c[0] + x * c[1] + y * c[2], c[1] * step_x, c[2] * step_y,
+                         c[3] + x * c[4] + y * c[5], c[4] * step_x, c[5] * step_y))
+
+
+def _write_sidecars(path: str, geotransform: GeoTransform, crs: Optional[str]) -> None:
+    """PNG/JPEG용 월드 파일과 .prj를 씁니다."""
+    stem, ext = os.path.splitext(path)
+    ext = ext.lstrip(".")
+    with open(f"{stem}.{ext[0]}{ext[-1]}w", "w", encoding="ascii") as f:
+        f.write(world_file_text(geotransform))
+    if crs:
+        from pyproj import CRS
+        try:
+            wkt = CRS.from_user_input(crs).to_wkt("WKT1_ESRI")
+        except Exception:
+            return
+        with open(f"{stem}.prj", "w", encoding="utf-8") as f:
+            f.write(wkt)
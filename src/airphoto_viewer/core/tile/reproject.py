@@ -0,0 +1,301 @@
+"""
+보이는 타일만 다른 좌표계로 재투영하는 타일 소스 모듈입니다.
+
+출력 타일마다 성긴 격자점에서만 정확한 pyproj 변환을 계산하고, 그 사이
+픽셀은 쌍선형 보간으로 원본 픽셀 좌표를 구합니다. 격자 칸 중점에서 보간
+오차가 허용치(`max_error`, 원본 픽셀 단위)를 넘으면 격자 간격을 절반으로
+줄여 다시 계산합니다(GDAL 근사 변환기와 같은 방식).
+
+원본 픽셀은 출력 해상도에 맞는 원본 피라미드 레벨의 캐시 타일에서 모아
+OpenCV `remap`(SIMD 최적화)으로 한 번에 재표본화합니다. 따라서 재투영 비용은
+화면에 보이는 타일 수에만 비례합니다.
+"""
+
+import math
+from typing import Hashable, Optional, Tuple
+
+import cv2
+import numpy as np
+
+from ..image.georef import GeoTransform
+from ..measure.coordinates import cached_transformer
+from .tile_cache import TileCache
+from .tile_source import TileSource
+
+# remap 보간 방법 (원본 레벨이 출력 해상도에 맞춰지므로 쌍선형이면 충분)
+_INTERPOLATION = cv2.INTER_LINEAR
+
+
+def suggest_warp_output(geotransform: GeoTransform, width: int, height: int,
+                        source_crs: str, target_crs: str,
+                        density: int = 21) -> Tuple[GeoTransform, int, int]:
+    """재투영 결과 영상의 지오트랜스폼과 크기를 추정합니다.
+
+    원본 경계를 촘촘히 변환해 대상 좌표계 경계를 구하고, 대각선 길이가
+    보존되도록 정사각 픽셀 크기를 정합니다.
+
+    Args:
+        geotransform: 원본 픽셀 → 지상 변환
+        width, height: 원본 크기
+        source_crs: 원본 좌표계
+        target_crs: 대상 좌표계
+        density: 변 하나당 변환할 점 수
+
+    Returns:
+        Tuple[GeoTransform, int, int]: (대상 지오트랜스폼, 너비, 높이)
+
+    Raises:
+        ValueError: 경계를 대상 좌표계로 변환할 수 없는 경우
+    """
+    t = np.linspace(0.0, 1.0, density)
+    edge = np.concatenate([
+        np.stack([t * width, np.zeros_like(t)], axis=1),
+        np.stack([t * width, np.full_like(t, height)], axis=1),
+        np.stack([np.zeros_like(t), t * height], axis=1),
+        np.stack([np.full_like(t, width), t * height], axis=1),
+    ])
+    ground = geotransform.pixel_to_ground(edge)
+    tx, ty = cached_transformer(source_crs, target_crs).transform(ground[:, 0], ground[:, 1])
+    tx, ty = np.asarray(tx), np.asarray(ty)
+    finite = np.isfinite(tx) & np.isfinite(ty)
+    if finite.sum() < 4:
+        raise ValueError(f"영상 경계를 {target_crs} 좌표계로 변환할 수 없습니다.")
+    tx, ty = tx[finite], ty[finite]
+
+    # 대각선 (0, 0) → (W, H)의 길이 비로 해상도를 정한다
+    corners = geotransform.pixel_to_ground([[0.0, 0.0], [width, height]])
+    cx, cy = cached_transformer(source_crs, target_crs).transform(corners[:, 0], corners[:, 1])
+    diagonal = math.hypot(cx[1] - cx[0], cy[1] - cy[0])
+    resolution = diagonal / math.hypot(width, height)
+    if not math.isfinite(resolution) or resolution <= 0:
+        raise ValueError(f"재투영 해상도를 계산할 수 없습니다: {target_crs}")
+
+    x0, x1, y0, y1 = float(tx.min()), float(tx.max()), float(ty.min()), float(ty.max())
+    out_width = max(1, int(math.ceil((x1 - x0) / resolution)))
+    out_height = max(1, int(math.ceil((y1 - y0) / resolution)))
+    return GeoTransform.from_origin(x0, y1, resolution, resolution), out_width, out_height
+
+
+def _interpolation_weights(nodes: np.ndarray, count: int) -> np.ndarray:
+    """정수 위치 0..count-1을 격자점 값에서 선형 보간하는 (count, 격자점 수) 가중치."""
+    if len(nodes) == 1:
+        return np.ones((count, 1), dtype=np.float64)
+    positions = np.arange(count, dtype=np.float64)
+    upper = np.clip(np.searchsorted(nodes, positions, side="right"), 1, len(nodes) - 1)
+    lower = upper - 1
+    t = (positions - nodes[lower]) / (nodes[upper] - nodes[lower])
+    weights = np.zeros((count, len(nodes)), dtype=np.float64)
+    rows = np.arange(count)
+    weights[rows, lower] = 1.0 - t
+    weights[rows, upper] += t
+    return weights
+
+
+def _grid_nodes(count: int, step: int) -> np.ndarray:
+    """0부터 count-1까지 step 간격의 격자점 위치 (양 끝 포함)."""
+    nodes = np.arange(0, count, step, dtype=np.float64)
+    if nodes[-1] != count - 1:
+        nodes = np.append(nodes, count - 1)
+    return nodes
+
+
+class ReprojectedSource(TileSource):
+    """원본 타일 소스를 다른 좌표계 격자로 재투영해 제공하는 타일 소스입니다.
+
+    속성:
+        source (TileSource): 원본 타일 소스
+        source_geotransform (GeoTransform): 원본 픽셀 → 지상 변환
+        source_crs (str): 원본 좌표계
+        geotransform (GeoTransform): 출력 픽셀 → 대상 좌표계 변환
+        crs (str): 대상 좌표계
+        max_error (float): 근사 변환의 허용 오차 (원본 픽셀)
+    """
+
+    def __init__(self, source: TileSource, source_geotransform: GeoTransform,
+                 source_crs: str, target_crs: str,
+                 target: Optional[Tuple[GeoTransform, int, int]] = None,
+                 max_error: float = 0.125, grid_step: int = 32,
+                 cache: Optional[TileCache] = None):
+        """ReprojectedSource 인스턴스를 초기화합니다.
+
+        Args:
+            source: 원본 타일 소스 (피라미드, 모자이크 등)
+            source_geotransform: 원본 레벨 0 픽셀 → 지상 변환
+            source_crs: 원본 좌표계
+            target_crs: 대상 좌표계
+            target: (지오트랜스폼, 너비, 높이). None이면 `suggest_warp_output()`으로 계산
+            max_error: 격자 보간의 허용 오차 (원본 레벨 0 픽셀)
+            grid_step: 처음 시도할 격자 간격 (출력 픽셀)
+            cache: 사용할 타일 캐시. None인 경우 원본 소스의 캐시 사용
+
+        Raises:
+            ValueError: 좌표계 변환이 불가능한 경우
+        """
+        if target is None:
+            target = suggest_warp_output(source_geotransform, source.width, source.height,
+                                         source_crs, target_crs)
+        geotransform, width, height = target
+        super().__init__(width, height, source.channels, source.dtype, source.tile_size,
+                         cache if cache is not None else source.cache)
+        self.source = source
+        self.source_geotransform = source_geotransform
+        self.source_crs = source_crs
+        self.geotransform = geotransform
+        self.crs = target_crs
+        self.max_error = max_error
+        self.grid_step = grid_step
+        self._transformer = cached_transformer(target_crs, source_crs)
+
+    @property
+    def cache_key(self) -> Hashable:
+        return ("reproject", self.source.cache_key, self.crs,
+                self.geotransform.coefficients, self.max_error)
+
+    def release(self) -> None:
+        """원본 소스의 픽셀 메모리를 해제합니다."""
+        release = getattr(self.source, "release", None)
+        if release is not None:
+            release()
+
+    def source_pixels(self, px: np.ndarray, py: np.ndarray) -> Tuple[np.ndarray, np.ndarray]:
+        """출력 레벨 0 픽셀 좌표를 원본 레벨 0 픽셀 좌표로 정확히 변환합니다.
+
+        변환할 수 없는 점은 무한대(inf)가 됩니다.
+        """
+        c = self.geotransform.coefficients
+        gx = c[0] + px * c[1] + py * c[2]
+        gy = c[3] + px * c[4] + py * c[5]
+        sx, sy = self._transformer.transform(gx, gy)
+        s = self.source_geotransform.inverse.coefficients
+        sx, sy = np.asarray(sx, dtype=np.float64), np.asarray(sy, dtype=np.float64)
+        return (s[0] + sx * s[1] + sy * s[2], s[3] + sx * s[4] + sy * s[5])
+
+    def warp_map(self, level: int, x: int, y: int, w: int, h: int
+                 ) -> Tuple[np.ndarray, np.ndarray]:
+        """출력 영역 각 픽셀 중심의 원본 레벨 0 픽셀 좌표 (map_x, map_y)를 계산합니다.
+
+        성긴 격자에서 정확히 변환한 뒤 쌍선형 보간하며, 격자 칸 중점의 보간
+        오차가 `max_error`를 넘으면 격자 간격을 절반으로 줄입니다. 변환할 수
+        없는 격자점이 모서리인 칸의 픽셀은 보간하지 않고 정확히 변환합니다.
+
+        Returns:
+            Tuple[np.ndarray, np.ndarray]: (h, w) 크기의 원본 좌표 배열
+        """
+        scale = float(1 << level)
+        step = max(1, self.grid_step)
+        while True:
+            nx, ny = _grid_nodes(w, step), _grid_nodes(h, step)
+            gx, gy = np.meshgrid((x + nx + 0.5) * scale, (y + ny + 0.5) * scale)
+            sx, sy = self.source_pixels(gx, gy)
+            if step == 1 or (len(nx) < 2 and len(ny) < 2):
+                break
+            # 격자 칸 중점에서 정확한 값과 네 모서리 평균(쌍선형 보간 값)을 비교한다
+            mx = 0.5 * (nx[:-1] + nx[1:]) if len(nx) > 1 else nx
+            my = 0.5 * (ny[:-1] + ny[1:]) if len(ny) > 1 else ny
+            cx, cy = np.meshgrid((x + mx + 0.5) * scale, (y + my + 0.5) * scale)
+            ex, ey = self.source_pixels(cx, cy)
+            error = max(_midpoint_error(sx, ex), _midpoint_error(sy, ey))
+            if error <= self.max_error:
+                break
+            step //= 2
+        wx = _interpolation_weights(nx, w)
+        wy = _interpolation_weights(ny, h)
+        finite = np.isfinite(sx) & np.isfinite(sy)
+        if finite.all():
+            return (wy @ sx @ wx.T, wy @ sy @ wx.T)
+
+        # 0·inf = NaN이 행렬곱 전체로 번지지 않도록 유한한 격자점만 보간하고,
+        # 유한하지 않은 모서리에 가중치가 걸린 픽셀(투영 영역 경계 칸)은 정확히 변환한다
+        map_x = wy @ np.where(finite, sx, 0.0) @ wx.T
+        map_y = wy @ np.where(finite, sy, 0.0) @ wx.T
+        touched = (wy != 0).astype(np.float64) @ (~finite).astype(np.float64) \
+            @ (wx != 0).T.astype(np.float64)
+        rows, cols = np.nonzero(touched > 0)
+        map_x[rows, cols], map_y[rows, cols] = self.source_pixels(
+            (x + cols + 0.5) * scale, (y + rows + 0.5) * scale)
+        return map_x, map_y
+
+    def read_region(self, level: int, x: int, y: int, w: int, h: int) -> np.ndarray:
+        shape = (h, w) if self.channels == 1 else (h, w, self.channels)
+        map_x, map_y = self.warp_map(level, x, y, w, h)
+        valid = np.isfinite(map_x) & np.isfinite(map_y)
+        if not valid.any():
+            return np.zeros(shape, dtype=self.dtype)
+
+        # 출력 픽셀 하나가 덮는 원본 픽셀 수에 맞는 원본 레벨을 고른다
+        footprint = _footprint(map_x, map_y, valid)
+        source_level = int(np.clip(math.floor(math.log2(max(footprint, 1.0))),
+                                   0, self.source.num_levels - 1))
+        factor = float(1 << source_level)
+        # 레벨 L 픽셀 k의 중심은 레벨 0 좌표 (k + 0.5) * 2^L
+        map_x = map_x / factor - 0.5
+        map_y = map_y / factor - 0.5
+
+        lw, lh = self.source.level_size(source_level)
+        x0 = int(max(0, math.floor(map_x[valid].min()) - 1))
+        y0 = int(max(0, math.floor(map_y[valid].min()) - 1))
+        x1 = int(min(lw, math.ceil(map_x[valid].max()) + 2))
+        y1 = int(min(lh, math.ceil(map_y[valid].max()) + 2))
+        if x0 >= x1 or y0 >= y1:
+            return np.zeros(shape, dtype=self.dtype)
+
+        region = self._read_source(source_level, x0, y0, x1, y1)
+        map_x = np.where(valid, map_x - x0, -1.0).astype(np.float32)
+        map_y = np.where(valid, map_y - y0, -1.0).astype(np.float32)
+        return _remap(region, map_x, map_y).reshape(shape)
+
+    def _read_source(self, level: int, x0: int, y0: int, x1: int, y1: int) -> np.ndarray:
+        """원본 레벨 사각형을 캐시된 원본 타일에서 모아 반환합니다."""
+        scale = 1 << level
+        out = None
+        for coord in self.source.tiles_in_rect(level, x0 * scale, y0 * scale,
+                                               x1 * scale, y1 * scale):
+            tile = self.source.get_tile(coord)
+            tx, ty, tw, th = self.source.tile_rect(coord)
+            if out is None:
+                out = np.zeros((y1 - y0, x1 - x0) + tile.shape[2:], dtype=tile.dtype)
+            ix0, iy0 = max(x0, tx), max(y0, ty)
+            ix1, iy1 = min(x1, tx + tw), min(y1, ty + th)
+            out[iy0 - y0:iy1 - y0, ix0 - x0:ix1 - x0] = \
+                tile[iy0 - ty:iy1 - ty, ix0 - tx:ix1 - tx]
+        return out
+
+
+def _midpoint_error(grid: np.ndarray, exact: np.ndarray) -> float:
+    """격자 칸 중점의 정확한 값과 쌍선형 보간 값의 최대 차이를 반환합니다."""
+    # 부호가 다른 무한대의 평균은 NaN이 되며, 아래에서 유한한 값만 비교한다
+    with np.errstate(invalid="ignore"):
+        if grid.shape[0] > 1:
+            grid = 0.5 * (grid[:-1] + grid[1:])
+        if grid.shape[1] > 1:
+            grid = 0.5 * (grid[:, :-1] + grid[:, 1:])
+    # 투영 영역 경계에 걸친 칸은 더 세분해도 나아지지 않으므로 제외한다
+    finite = np.isfinite(grid) & np.isfinite(exact)
+    diff = np.abs(grid[finite] - exact[finite])
+    return float(diff.max()) if diff.size else 0.0
+
+
+def _footprint(map_x: np.ndarray, map_y: np.ndarray, valid: np.ndarray) -> float:
+    """출력 한 픽셀당 원본 레벨 0 픽셀 이동량의 중앙값을 반환합니다."""
+    # 변환할 수 없는 픽셀(inf)끼리의 차는 쓰지 않으므로 0으로 바꿔 둔다
+    map_x = np.where(valid, map_x, 0.0)
+    map_y = np.where(valid, map_y, 0.0)
+    dx = np.hypot(np.diff(map_x, axis=1), np.diff(map_y, axis=1))
+    dx = dx[valid[:, 1:] & valid[:, :-1]]
+    if dx.size == 0:
+        dy = np.hypot(np.diff(map_x, axis=0), np.diff(map_y, axis=0))
+        dx = dy[valid[1:] & valid[:-1]]
+    return float(np.median(dx)) if dx.size else 1.0
+
+
+def _remap(region: np.ndarray, map_x: np.ndarray, map_y: np.ndarray) -> np.ndarray:
+    """remap을 적용합니다. 4채널을 넘는 배열은 4채널씩 나누어 처리합니다."""
+    if region.ndim == 2 or region.shape[2] <= 4:
+        return cv2.remap(region, map_x, map_y, _INTERPOLATION,
+                         borderMode=cv2.BORDER_CONSTANT, borderValue=0)
+    out = np.empty(map_x.shape + (region.shape[2],), dtype=region.dtype)
+    for start in range(0, region.shape[2], 4):
+        chunk = cv2.remap(np.ascontiguousarray(region[..., start:start + 4]), map_x, map_y,
+                          _INTERPOLATION, borderMode=cv2.BORDER_CONSTANT, borderValue=0)
+        out[..., start:start + 4] = chunk.reshape(map_x.shape + (-1,))
+    return out
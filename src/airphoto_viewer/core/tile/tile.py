@@ -0,0 +1,35 @@
+"""
+타일 좌표 및 타일 데이터를 정의하는 모듈입니다.
+"""
+
+from dataclasses import dataclass
+from typing import Tuple
+
+
+@dataclass(frozen=True, order=True)
+class TileCoord:
+    """피라미드 내 타일의 위치를 나타내는 불변 데이터 클래스입니다.
+
+    속성:
+        level (int): 피라미드 레벨 (0 = 원본 해상도, 1 = 1/2 축소, ...)
+        col (int): 타일 열 인덱스
+        row (int): 타일 행 인덱스
+    """
+    level: int
+    col: int
+    row: int
+
+    def parent(self) -> "TileCoord":
+        """한 단계 더 거친 레벨에서 이 타일을 포함하는 타일 좌표를 반환합니다."""
+        return TileCoord(self.level + 1, self.col // 2, self.row // 2)
+
+    def rect(self, tile_size: int) -> Tuple[int, int, int, int]:
+        """레벨 좌표계에서 타일의 (x, y, w, h) 사각형을 반환합니다.
+
+        가장자리 타일의 실제 크기는 레벨 크기로 잘라내야 하며,
+        이 함수는 잘라내기 전의 공칭 사각형을 반환합니다.
+
+        Args:
+            tile_size: 타일 한 변의 픽셀 수
+        """
+        return (self.col * tile_size, self.row * tile_size, tile_size, tile_size)
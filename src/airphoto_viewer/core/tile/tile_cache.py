@@ -0,0 +1,201 @@
+"""
+메모리 예산 기반의 LRU 타일 캐시 모듈입니다.
+
+여러 타일 소스(피라미드, 필터 파이프라인 등)가 하나의 캐시를 공유하며,
+키는 (소스 키, 레벨, 열, 행) 형태의 해시 가능한 튜플을 사용합니다.
+공유 캐시는 소스 객체보다 오래 살아 있으므로, 소스 키에는 재사용될 수 있는
+`id()` 대신 `next_cache_token()`이 발급하는 프로세스 내 고유 번호를 씁니다.
+"""
+
+import itertools
+import threading
+from collections import OrderedDict, deque
+from typing import Callable, Hashable, Optional
+
+import numpy as np
+
+
+class TileCache:
+    """스레드 안전한 바이트 예산 LRU 타일 캐시입니다.
+
+    화면에 표시 중인 타일은 `pin()`으로 고정하여 예산 초과 시에도
+    축출되지 않도록 할 수 있습니다.
+
+    속성:
+        max_bytes (int): 캐시가 사용할 수 있는 최대 바이트 수
+    """
+
+    def __init__(self, max_size_mb: int = 512):
+        """TileCache 인스턴스를 초기화합니다.
+
+        Args:
+            max_size_mb: 캐시 최대 크기 (MB 단위)
+        """
+        self.max_bytes = max_size_mb * 1024 * 1024
+        self._entries: "OrderedDict[Hashable, np.ndarray]" = OrderedDict()
+        self._pins: dict = {}
+        # unpin_deferred()로 예약된 고정 해제 (잠금 없이 추가, 다음 캐시 쓰기 때 반영)
+        self._released: deque = deque()
+        self._bytes = 0
+        self._lock = threading.Lock()
+        self.hits = 0
+        self.misses = 0
+
+    def get_tile(self, key: Hashable) -> Optional[np.ndarray]:
+        """캐시에서 타일을 조회하고 최근 사용으로 표시합니다.
+
+        Args:
+            key: 타일 키
+
+        Returns:
+            Optional[np.ndarray]: 캐시된 타일. 없으면 None
+        """
+        with self._lock:
+            tile = self._entries.get(key)
+            if tile is None:
+                self.misses += 1
+                return None
+            self._entries.move_to_end(key)
+            self.hits += 1
+            return tile
+
+    def peek(self, key: Hashable) -> Optional[np.ndarray]:
+        """LRU 순서와 통계를 바꾸지 않고 타일을 조회합니다."""
+        with self._lock:
+            return self._entries.get(key)
+
+    def put_tile(self, key: Hashable, tile: np.ndarray) -> None:
+        """타일을 캐시에 저장하고 예산을 초과하면 오래된 타일을 축출합니다.
+
+        Args:
+            key: 타일 키
+            tile: 저장할 타일 데이터
+        """
+        with self._lock:
+            old = self._entries.pop(key, None)
+            if old is not None:
+                self._bytes -= old.nbytes
+            self._entries[key] = tile
+            self._bytes += tile.nbytes
+            self._evict_locked()
+
+    def pin(self, key: Hashable) -> None:
+        """타일을 고정하여 축출 대상에서 제외합니다 (참조 카운트 방식)."""
+        with self._lock:
+            self._pins[key] = self._pins.get(key, 0) + 1
+
+    def unpin(self, key: Hashable) -> None:
+        """`pin()`으로 고정한 타일의 고정을 하나 해제합니다."""
+        with self._lock:
+            self._unpin_locked(key)
+            self._evict_locked()
+
+    def unpin_deferred(self, key: Hashable) -> None:
+        """잠금 없이 고정 해제를 예약합니다. 다음 타일 저장/고정 해제 때 반영됩니다.
+
+        가비지 수집 중에 불리는 해제 콜백처럼, 이 캐시의 잠금을 쥔 스레드에서
+        호출될 수 있는 곳에서 사용합니다.
+        """
+        self._released.append(key)
+
+    def _unpin_locked(self, key: Hashable) -> None:
+        count = self._pins.get(key, 0) - 1
+        if count > 0:
+            self._pins[key] = count
+        else:
+            self._pins.pop(key, None)
+
+    def invalidate(self, predicate: Callable[[Hashable], bool]) -> int:
+        """조건을 만족하는 타일을 모두 제거합니다.
+
+        Args:
+            predicate: 키를 받아 제거 여부를 반환하는 함수
+
+        Returns:
+            int: 제거된 타일 수
+        """
+        with self._lock:
+            doomed = [key for key in self._entries if predicate(key)]
+            for key in doomed:
+                self._bytes -= self._entries.pop(key).nbytes
+            return len(doomed)
+
+    def invalidate_source(self, source_key: Hashable) -> int:
+        """소스 키를 포함하는 모든 타일을 제거합니다.
+
+        파생 소스(필터, 밴드 합성 등)의 키는 입력 소스 키를 중첩해 포함하므로,
+        원본 피라미드 키를 넘기면 그로부터 만들어진 타일도 함께 제거됩니다.
+
+        Args:
+            source_key: 타일 소스의 `cache_key`
+
+        Returns:
+            int: 제거된 타일 수
+        """
+        return self.invalidate(lambda key: _contains_key(key, source_key))
+
+    def clear(self) -> None:
+        """모든 타일을 제거합니다. 고정 정보는 유지됩니다."""
+        with self._lock:
+            self._entries.clear()
+            self._bytes = 0
+
+    @property
+    def size_bytes(self) -> int:
+        """현재 캐시가 사용 중인 바이트 수를 반환합니다."""
+        return self._bytes
+
+    def __len__(self) -> int:
+        return len(self._entries)
+
+    def __contains__(self, key: Hashable) -> bool:
+        with self._lock:
+            return key in self._entries
+
+    def _evict_locked(self) -> None:
+        """락을 보유한 상태에서 예산 이하가 될 때까지 고정되지 않은 타일을 축출합니다."""
+        while self._released:
+            self._unpin_locked(self._released.popleft())
+        if self._bytes <= self.max_bytes:
+            return
+        for key in list(self._entries):
+            if self._bytes <= self.max_bytes:
+                break
+            if key in self._pins:
+                continue
+            self._bytes -= self._entries.pop(key).nbytes
+
+
+def _contains_key(key: Hashable, target: Hashable) -> bool:
+    """중첩 튜플 키 안에 target이 포함되어 있는지 재귀적으로 확인합니다."""
+    if key == target:
+        return True
+    if isinstance(key, tuple):
+        return any(_contains_key(part, target) for part in key)
+    return False
+
+
+# 캐시 키 고유 번호 발급기 (next()는 GIL 아래에서 원자적)
+_cache_tokens = itertools.count()
+
+
+def next_cache_token() -> int:
+    """캐시 키에 쓸 프로세스 내 고유 번호를 발급합니다.
+
+    `id()`는 객체가 해제된 뒤 새 객체에 다시 쓰일 수 있어, 해제된 소스의 캐시
+    타일이 새 소스의 타일로 조회될 수 있습니다. 발급된 번호는 재사용되지 않습니다.
+    """
+    return next(_cache_tokens)
+
+
+_shared_cache: Optional[TileCache] = None
+_shared_lock = threading.Lock()
+
+
+def get_shared_cache() -> TileCache:
+    """애플리케이션 전체가 공유하는 기본 타일 캐시를 반환합니다."""
+    global _shared_cache
+    with _shared_lock:
+        if _shared_cache is None:
+            _shared_cache = TileCache()
+        return _shared_cache
@@ -0,0 +1,188 @@
+"""
+타일 소스의 공통 인터페이스를 정의하는 모듈입니다.
+
+피라미드, 필터 파이프라인 등 타일 단위로 픽셀을 제공하는 모든 객체는
+`TileSource`를 상속하여 `read_region()`만 구현하면 캐시 연동과
+타일 격자 계산을 그대로 사용할 수 있습니다.
+"""
+
+import math
+from typing import Hashable, Iterator, Optional, Tuple
+
+import numpy as np
+
+from ...utils.buffer_view import pinned_view
+from .tile import TileCoord
+from .tile_cache import TileCache, get_shared_cache, next_cache_token
+
+
+class TileSource:
+    """레벨별 타일을 제공하는 추상 기반 클래스입니다.
+
+    레벨 n의 크기는 원본 크기를 2^n으로 나누어 올림한 값입니다.
+
+    속성:
+        width (int): 레벨 0 너비
+        height (int): 레벨 0 높이
+        channels (int): 채널 수
+        dtype (np.dtype): 픽셀 자료형
+        tile_size (int): 타일 한 변의 픽셀 수
+        cache (TileCache): 타일 캐시
+        token (int): 캐시 키에 쓰는 소스 고유 번호 (재사용되지 않음)
+    """
+
+    def __init__(self, width: int, height: int, channels: int, dtype,
+                 tile_size: int = 256, cache: Optional[TileCache] = None):
+        """TileSource 인스턴스를 초기화합니다.
+
+        Args:
+            width: 레벨 0 너비
+            height: 레벨 0 높이
+            channels: 채널 수
+            dtype: 픽셀 자료형
+            tile_size: 타일 한 변의 픽셀 수
+            cache: 사용할 타일 캐시. None인 경우 공유 캐시 사용
+        """
+        self.width = width
+        self.height = height
+        self.channels = channels
+        self.dtype = np.dtype(dtype)
+        self.tile_size = tile_size
+        self.cache = cache if cache is not None else get_shared_cache()
+        self.token = next_cache_token()
+
+    @property
+    def cache_key(self) -> Hashable:
+        """캐시 키 접두어를 반환합니다. 내용이 바뀌면 키도 바뀌어야 합니다."""
+        return ("source", self.token)
+
+    @property
+    def num_levels(self) -> int:
+        """가장 거친 레벨이 타일 하나에 들어갈 때까지의 레벨 수를 반환합니다."""
+        longest = max(self.width, self.height, 1)
+        return max(1, math.ceil(math.log2(longest / self.tile_size)) + 1)
+
+    def level_size(self, level: int) -> Tuple[int, int]:
+        """레벨의 (너비, 높이)를 반환합니다."""
+        scale = 1 << level
+        return (-(-self.width // scale), -(-self.height // scale))
+
+    def tile_grid(self, level: int) -> Tuple[int, int]:
+        """레벨의 타일 격자 (열 수, 행 수)를 반환합니다."""
+        w, h = self.level_size(level)
+        return (-(-w // self.tile_size), -(-h // self.tile_size))
+
+    def tile_rect(self, coord: TileCoord) -> Tuple[int, int, int, int]:
+        """레벨 경계로 잘라낸 타일의 (x, y, w, h)를 반환합니다."""
+        w, h = self.level_size(coord.level)
+        x, y, ts, _ = coord.rect(self.tile_size)
+        return (x, y, min(ts, w - x), min(ts, h - y))
+
+    def tiles_in_rect(self, level: int, x0: float, y0: float,
+                      x1: float, y1: float) -> Iterator[TileCoord]:
+        """레벨 0 좌표 사각형과 겹치는 레벨의 타일 좌표를 순회합니다.
+
+        Args:
+            level: 피라미드 레벨
+            x0, y0, x1, y1: 레벨 0 좌표계의 사각형 (좌상단, 우하단)
+        """
+        span = self.tile_size << level
+        cols, rows = self.tile_grid(level)
+        c0 = max(0, int(x0 // span))
+        r0 = max(0, int(y0 // span))
+        c1 = min(cols - 1, int(math.ceil(x1 / span)) - 1)
+        r1 = min(rows - 1, int(math.ceil(y1 / span)) - 1)
+        for row in range(r0, r1 + 1):
+            for col in range(c0, c1 + 1):
+                yield TileCoord(level, col, row)
+
+    def tile_key(self, coord: TileCoord) -> Hashable:
+        """타일의 캐시 키를 반환합니다."""
+        return (self.cache_key, coord.level, coord.col, coord.row)
+
+    def read_region(self, level: int, x: int, y: int, w: int, h: int) -> np.ndarray:
+        """레벨 좌표계의 사각형 영역 픽셀을 반환합니다.
+
+        영역은 레벨 경계 안에 있어야 합니다.
+
+        Args:
+            level: 피라미드 레벨
+            x, y: 좌상단 좌표
+            w, h: 영역 크기
+
+        Returns:
+            np.ndarray: (h, w[, channels]) 형태의 픽셀 배열
+        """
+        raise NotImplementedError
+
+    def get_tile(self, coord: TileCoord) -> np.ndarray:
+        """타일을 반환합니다. 캐시에 없으면 계산 후 캐시에 저장합니다.
+
+        Args:
+            coord: 타일 좌표
+
+        Returns:
+            np.ndarray: 타일 픽셀 배열
+        """
+        key = self.tile_key(coord)
+        tile = self.cache.get_tile(key)
+        if tile is None:
+            tile = self.read_region(coord.level, *self.tile_rect(coord))
+            if tile.base is not None:
+                # 더 큰 배열의 뷰를 캐시하면 예산에 잡히지 않는 메모리가 남는다
+                tile = tile.copy()
+            self.cache.put_tile(key, tile)
+        return tile
+
+    def tile_view(self, coord: TileCoord) -> np.ndarray:
+        """타일을 캐시 메모리 위의 읽기 전용 뷰로 반환합니다.
+
+        뷰(와 그 파생 뷰)가 살아 있는 동안 타일은 캐시에 고정되어 축출되지 않습니다.
+
+        Args:
+            coord: 타일 좌표
+
+        Returns:
+            np.ndarray: 버퍼 프로토콜을 구현하는 쓰기 불가 뷰
+        """
+        key = self.tile_key(coord)
+        cache = self.cache
+        cache.pin(key)
+        try:
+            tile = self.get_tile(coord)
+        except BaseException:
+            cache.unpin(key)
+            raise
+        # 해제 콜백은 가비지 수집 중 캐시 잠금을 쥔 스레드에서 불릴 수 있다
+        return pinned_view(tile, lambda: cache.unpin_deferred(key))
+
+    def region_view(self, level: int, x: int, y: int, w: int, h: int) -> np.ndarray:
+        """영역을 읽기 전용 뷰로 반환합니다.
+
+        피라미드처럼 레벨 배열을 보관하는 소스는 그 메모리를 복사 없이 가리킵니다.
+
+        Args:
+            level: 피라미드 레벨
+            x, y: 좌상단 좌표
+            w, h: 영역 크기
+
+        Raises:
+            ValueError: 영역이 레벨 경계를 벗어난 경우
+        """
+        self.check_region(level, x, y, w, h)
+        return pinned_view(self.read_region(level, x, y, w, h))
+
+    def check_region(self, level: int, x: int, y: int, w: int, h: int) -> None:
+        """영역이 레벨 경계 안에 있는지 확인합니다.
+
+        Raises:
+            ValueError: 영역이 레벨 경계를 벗어난 경우
+        """
+        level_w, level_h = self.level_size(level)
+        if x < 0 or y < 0 or w <= 0 or h <= 0 or x + w > level_w or y + h > level_h:
+            raise ValueError(f"영역이 레벨 {level} 경계({level_w}x{level_h})를 벗어났습니다: "
+                             f"({x}, {y}, {w}, {h})")
+
+    def cached_tile(self, coord: TileCoord) -> Optional[np.ndarray]:
+        """계산 없이 캐시에 있는 타일만 반환합니다."""
+        return self.cache.peek(self.tile_key(coord))
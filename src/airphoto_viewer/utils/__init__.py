@@ -4,4 +4,14 @@
 이 모듈은 프로젝트 전반에서 사용되는 유틸리티 함수를 제공합니다.
 """
 
-__all__ = []
+from .lazy_import import lazy_exports
+
+# 공개 이름은 처음 사용할 때 해당 하위 모듈만 가져온다 (시작 시간 단축)
+__getattr__, __dir__ = lazy_exports(__name__, {
+    'pinned_view': '.buffer_view',
+    'IncrementalRTree': '.spatial_index',
+    'PackedRTree': '.spatial_index',
+    'RTreeSnapshot': '.spatial_index',
+})
+
+__all__ = ['pinned_view', 'IncrementalRTree', 'PackedRTree', 'RTreeSnapshot']
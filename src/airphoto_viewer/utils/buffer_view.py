@@ -0,0 +1,53 @@
+"""
+배열 메모리를 복사 없이 공유하는 읽기 전용 뷰 모듈입니다.
+
+`pinned_view()`가 반환하는 NumPy 배열은 원본(캐시 타일, 레벨 배열, 메모리 맵)과
+같은 메모리를 가리키며 버퍼 프로토콜을 구현하므로 NumPy, OpenCV, Pillow
+(`Image.fromarray`)가 복사 없이 사용할 수 있습니다.
+
+뷰의 기반(base)은 원본 메모리 구간을 덮는 ctypes 버퍼이고, 이 버퍼가 원본
+배열과 해제 콜백을 붙잡습니다. NumPy는 배열이 아닌 기반에서 기반 축약을
+멈추므로 뷰에서 다시 자른 배열이나 `np.asarray()` 결과도 같은 버퍼를 참조하며,
+파생 뷰까지 모두 사라져야 해제 콜백이 호출됩니다. 콜백은 가비지 수집 중
+임의의 스레드에서 호출될 수 있으므로 잠금을 기다리지 않아야 합니다.
+"""
+
+import ctypes
+import weakref
+from typing import Callable, Optional
+
+import numpy as np
+
+
+def pinned_view(array: np.ndarray,
+                on_release: Optional[Callable[[], None]] = None) -> np.ndarray:
+    """배열과 메모리를 공유하는 읽기 전용 뷰를 반환합니다.
+
+    Args:
+        array: 원본 배열 (음수 stride는 지원하지 않음)
+        on_release: 뷰와 그 파생 뷰가 모두 사라지면 호출할 함수
+
+    Returns:
+        np.ndarray: 쓰기 불가 뷰. 뷰가 살아 있는 동안 원본 메모리도 유지됨
+
+    Raises:
+        ValueError: 음수 stride 배열인 경우
+    """
+    if any(stride < 0 for stride in array.strides):
+        raise ValueError("음수 stride 배열은 뷰로 만들 수 없습니다.")
+    if array.size == 0:
+        view = array.view()
+        view.flags.writeable = False
+        if on_release is not None:
+            on_release()
+        return view
+    # 뷰가 덮는 바이트 구간 (첫 원소부터 마지막 원소 끝까지)
+    span = array.itemsize + sum((n - 1) * s for n, s in zip(array.shape, array.strides))
+    address = array.__array_interface__["data"][0]
+    holder = (ctypes.c_ubyte * span).from_address(address)
+    holder._source = array
+    if on_release is not None:
+        weakref.finalize(holder, on_release)
+    view = np.ndarray(array.shape, array.dtype, buffer=holder, strides=array.strides)
+    view.flags.writeable = False
+    return view
@@ -0,0 +1,39 @@
+"""
+패키지 공개 이름을 처음 사용할 때 가져오는 지연 임포트 모듈입니다.
+
+패키지 `__init__`이 모든 하위 모듈을 미리 가져오면 OpenCV, NumPy, pyproj 같은
+무거운 의존성이 시작 시점에 한꺼번에 적재됩니다. `lazy_exports()`로 만든 모듈
+`__getattr__`(PEP 562)는 이름에 처음 접근할 때 해당 하위 모듈만 가져오고,
+결과를 패키지 네임스페이스에 저장해 이후 접근에는 비용이 없습니다.
+"""
+
+import importlib
+import sys
+from typing import Callable, Dict, List, Tuple
+
+
+def lazy_exports(package: str, exports: Dict[str, str]
+                 ) -> Tuple[Callable[[str], object], Callable[[], List[str]]]:
+    """패키지의 지연 `__getattr__`과 `__dir__`을 만듭니다.
+
+    Args:
+        package: 패키지 이름 (`__name__`)
+        exports: 공개 이름 → 하위 모듈 (".module" 또는 다른 이름으로 내보낼 때
+            ".module:원래이름")
+
+    Returns:
+        Tuple: (`__getattr__`, `__dir__`)
+    """
+    def __getattr__(name: str):
+        target = exports.get(name)
+        if target is None:
+            raise AttributeError(f"module {package!r} has no attribute {name!r}")
+        module_name, _, attribute = target.partition(":")
+        value = getattr(importlib.import_module(module_name, package), attribute or name)
+        setattr(sys.modules[package], name, value)
+        return value
+
+    def __dir__() -> List[str]:
+        return sorted(set(vars(sys.modules[package])) | set(exports))
+
+    return __getattr__, __dir__
@@ -0,0 +1,106 @@
+"""
+네이티브 확장(`airphoto_viewer._native`)을 감싸는 모듈입니다.
+
+확장은 `native/` 디렉토리의 C++17 코드를 CMake로 빌드한 것으로, 휠 설치 시
+함께 빌드되어 패키지 안에 설치됩니다. 소스 트리에서 실행할 때는
+`cmake -S native -B build/native && cmake --build build/native`로 빌드한 뒤
+`AIRPHOTO_NATIVE_DIR=build/native`를 설정하면 빌드 트리의 확장을 가져옵니다.
+확장이 없거나 `AIRPHOTO_DISABLE_NATIVE` 환경 변수가 설정되어 있으면 각 함수는
+None을 반환하고, 호출자는 OpenCV/NumPy 경로를 사용합니다.
+
+커널은 출력 배열을 여기서 할당해 버퍼 프로토콜로 넘기므로 복사가 없고,
+계산하는 동안 GIL을 해제합니다.
+"""
+
+import glob
+import importlib.machinery
+import importlib.util
+import os
+import threading
+from typing import Optional
+
+import numpy as np
+
+# 설정하면 네이티브 확장을 쓰지 않는다 (비교/문제 확인용)
+DISABLE_ENV = "AIRPHOTO_DISABLE_NATIVE"
+# 설치된 확장이 없을 때 찾아볼 개발 빌드 디렉토리
+DIR_ENV = "AIRPHOTO_NATIVE_DIR"
+
+# 네이티브 커널이 지원하는 자료형
+AREA_DTYPES = (np.dtype(np.uint8), np.dtype(np.uint16), np.dtype(np.float32))
+LUT_DTYPES = (np.dtype(np.uint8), np.dtype(np.uint16))
+
+_module = None
+_loaded = False
+_lock = threading.Lock()
+
+
+def get_native():
+    """네이티브 확장 모듈을 반환합니다. 사용할 수 없으면 None을 반환합니다."""
+    global _module, _loaded
+    if not _loaded:
+        with _lock:
+            if not _loaded:
+                if not os.environ.get(DISABLE_ENV):
+                    try:
+                        from .. import _native
+                        _module = _native
+                    except ImportError:
+                        _module = _load_from_build_dir(os.environ.get(DIR_ENV))
+                _loaded = True
+    return _module
+
+
+def _load_from_build_dir(directory: Optional[str]):
+    """개발 빌드 디렉토리에서 확장 모듈을 찾아 가져옵니다. 없으면 None"""
+    if not directory:
+        return None
+    name = "airphoto_viewer._native"
+    for suffix in importlib.machinery.EXTENSION_SUFFIXES:
+        for path in glob.glob(os.path.join(glob.escape(directory), "_native" + suffix)):
+            try:
+                spec = importlib.util.spec_from_file_location(name, path)
+                module = importlib.util.module_from_spec(spec)
+                spec.loader.exec_module(module)
+                return module
+            except ImportError:
+                continue
+    return None
+
+
+def area_resize(array: np.ndarray, size) -> Optional[np.ndarray]:
+    """면적 평균(INTER_AREA와 같은 정의)으로 배열을 축소합니다.
+
+    OpenCV와 달리 채널 수 제한이 없어 다중분광 배열도 한 번에 처리합니다.
+
+    Args:
+        array: (높이, 너비) 또는 (높이, 너비, 채널) 배열
+        size: 출력 (너비, 높이). 입력 크기 이하여야 함
+
+    Returns:
+        Optional[np.ndarray]: 축소된 배열. 확장이 없거나 자료형을 지원하지 않으면 None
+    """
+    module = get_native()
+    if module is None or array.dtype not in AREA_DTYPES:
+        return None
+    out = np.empty((size[1], size[0]) + array.shape[2:], dtype=array.dtype)
+    module.area_resize(np.ascontiguousarray(array), out)
+    return out
+
+
+def apply_lut(array: np.ndarray, lut: np.ndarray) -> Optional[np.ndarray]:
+    """채널별 LUT를 적용합니다.
+
+    Args:
+        array: uint8/uint16 배열 ((높이, 너비) 또는 (높이, 너비, 채널))
+        lut: (항목 수, 채널 수) 형태의 같은 자료형 테이블
+
+    Returns:
+        Optional[np.ndarray]: 변환된 배열. 확장이 없거나 자료형을 지원하지 않으면 None
+    """
+    module = get_native()
+    if module is None or array.dtype not in LUT_DTYPES or lut.dtype != array.dtype:
+        return None
+    out = np.empty_like(array, order="C")
+    module.apply_lut(np.ascontiguousarray(array), np.ascontiguousarray(lut), out)
+    return out
@@ -0,0 +1,351 @@
+"""
+사각형 경계(영상 풋프린트, 주석 등)에 대한 공간 색인 모듈입니다.
+
+`PackedRTree`는 STR(Sort-Tile-Recursive) 방식으로 한 번에 적재하는 불변
+R-트리로, 모든 노드 경계를 레벨 순서의 연속 배열 하나에 담습니다. 질의는
+레벨마다 후보 노드의 자식 경계를 NumPy로 한꺼번에 검사하므로 수백만 항목에서도
+파이썬 반복 없이 트리 높이(약 log16 N)만큼의 배열 연산으로 끝납니다.
+파일로 저장한 트리는 메모리 맵으로 열 수 있어 읽기 시 복사가 없습니다.
+
+`IncrementalRTree`는 편집이 잦은 레이어(주석 등)를 위한 변형으로, 불변 트리에
+추가/삭제 델타를 얹어 두었다가 델타가 커지면 다시 적재합니다. 편집은 한
+스레드에서만 해야 하며, 다른 스레드는 `snapshot()`으로 얻은 `RTreeSnapshot`을
+질의합니다.
+
+경계는 (x0, y0, x1, y1) 닫힌 구간이며, 경계가 맞닿기만 해도 겹친 것으로 봅니다.
+"""
+
+import math
+import os
+from typing import Dict, Iterable, Optional, Sequence, Tuple, Union
+
+import numpy as np
+
+# 저장 파일 머리말: 매직(버전 포함), 노드 크기, 항목 수, 레벨 수
+_MAGIC = b"APRTREE1"
+_HEADER = np.dtype([("magic", "S8"), ("node_size", "<i8"), ("num_items", "<i8"),
+                    ("num_levels", "<i8")])
+
+Box = Tuple[float, float, float, float]
+
+
+def _as_boxes(boxes) -> np.ndarray:
+    """입력을 (N, 4) float64 배열로 변환합니다."""
+    array = np.asarray(boxes, dtype=np.float64)
+    if array.size == 0:
+        return array.reshape(0, 4)
+    if array.ndim != 2 or array.shape[1] != 4:
+        raise ValueError(f"경계 배열은 (N, 4) 형태여야 합니다: {array.shape}")
+    return array
+
+
+class PackedRTree:
+    """STR로 일괄 적재한 불변 R-트리입니다.
+
+    속성:
+        node_size (int): 노드당 최대 자식 수
+        ids (np.ndarray): 잎 순서대로 정렬된 항목 ID (int64)
+        boxes (np.ndarray): 잎부터 루트까지 모든 노드 경계 (M, 4)
+        level_offsets (np.ndarray): 레벨별 `boxes` 시작 위치 (마지막은 끝 위치)
+    """
+
+    def __init__(self, boxes, ids: Optional[Sequence[int]] = None, node_size: int = 16):
+        """PackedRTree 인스턴스를 생성하고 항목을 일괄 적재합니다.
+
+        Args:
+            boxes: (N, 4) 경계 배열 (x0, y0, x1, y1)
+            ids: 항목 ID. None인 경우 0..N-1
+            node_size: 노드당 최대 자식 수
+
+        Raises:
+            ValueError: 경계 배열 형태나 ID 개수가 잘못된 경우
+        """
+        boxes = _as_boxes(boxes)
+        count = len(boxes)
+        ids = np.arange(count, dtype=np.int64) if ids is None else \
+            np.asarray(ids, dtype=np.int64)
+        if len(ids) != count:
+            raise ValueError("ID 개수가 경계 개수와 다릅니다.")
+        if node_size < 2:
+            raise ValueError(f"노드 크기는 2 이상이어야 합니다: {node_size}")
+        self.node_size = node_size
+
+        # 잎 정렬: 중심 x로 세로 띠를 나누고 띠 안에서 중심 y로 정렬 (STR)
+        order = np.arange(count)
+        if count > node_size:
+            cx = boxes[:, 0] + boxes[:, 2]
+            cy = boxes[:, 1] + boxes[:, 3]
+            leaves = math.ceil(count / node_size)
+            slice_items = math.ceil(math.sqrt(leaves)) * node_size
+            rank = np.empty(count, dtype=np.int64)
+            rank[np.argsort(cx, kind="stable")] = np.arange(count)
+            order = np.lexsort((cy, rank // slice_items))
+        levels = [boxes[order]]
+        self.ids = ids[order]
+
+        # 윗 레벨: 연속된 node_size개 자식의 경계를 합친다
+        while len(levels[-1]) > 1:
+            child = levels[-1]
+            starts = np.arange(0, len(child), node_size)
+            levels.append(np.column_stack([
+                np.minimum.reduceat(child[:, 0], starts),
+                np.minimum.reduceat(child[:, 1], starts),
+                np.maximum.reduceat(child[:, 2], starts),
+                np.maximum.reduceat(child[:, 3], starts),
+            ]))
+        self.level_offsets = np.cumsum([0] + [len(level) for level in levels]).astype(np.int64)
+        self.boxes = np.concatenate(levels) if count else np.empty((0, 4))
+
+    @classmethod
+    def _from_arrays(cls, node_size: int, ids: np.ndarray, boxes: np.ndarray,
+                     level_offsets: np.ndarray) -> "PackedRTree":
+        """이미 적재된 배열로 트리를 만듭니다 (복사 없음)."""
+        tree = cls.__new__(cls)
+        tree.node_size = node_size
+        tree.ids = ids
+        tree.boxes = boxes
+        tree.level_offsets = level_offsets
+        return tree
+
+    def __len__(self) -> int:
+        return len(self.ids)
+
+    @property
+    def bounds(self) -> Optional[Box]:
+        """전체 경계를 반환합니다. 비어 있으면 None"""
+        if not len(self.ids):
+            return None
+        return tuple(float(v) for v in self.boxes[-1])
+
+    def _level(self, level: int) -> np.ndarray:
+        return self.boxes[self.level_offsets[level]:self.level_offsets[level + 1]]
+
+    def query(self, x0: float, y0: float, x1: float, y1: float) -> np.ndarray:
+        """사각형과 겹치는 항목 ID를 반환합니다 (순서는 정해지지 않음).
+
+        Args:
+            x0, y0, x1, y1: 질의 사각형 (닫힌 구간)
+
+        Returns:
+            np.ndarray: 항목 ID 배열 (int64)
+        """
+        top = len(self.level_offsets) - 2
+        if not len(self.ids):
+            return np.empty(0, dtype=np.int64)
+        root = self._level(top)
+        if not (root[0, 0] <= x1 and root[0, 2] >= x0 and root[0, 1] <= y1 and root[0, 3] >= y0):
+            return np.empty(0, dtype=np.int64)
+        candidates = np.zeros(1, dtype=np.int64)
+        span = np.arange(self.node_size, dtype=np.int64)
+        for level in range(top, 0, -1):
+            child = self._level(level - 1)
+            index = (candidates[:, None] * self.node_size + span).ravel()
+            index = index[index < len(child)]
+            b = child[index]
+            candidates = index[(b[:, 0] <= x1) & (b[:, 2] >= x0) &
+                               (b[:, 1] <= y1) & (b[:, 3] >= y0)]
+            if not len(candidates):
+                break
+        return self.ids[candidates]
+
+    def query_point(self, x: float, y: float) -> np.ndarray:
+        """점을 포함하는 항목 ID를 반환합니다."""
+        return self.query(x, y, x, y)
+
+    def save(self, path: Union[str, os.PathLike]) -> None:
+        """트리를 메모리 맵으로 열 수 있는 파일로 저장합니다.
+
+        형식: 머리말, 레벨 오프셋(int64), 항목 ID(int64), 노드 경계(float64)
+        """
+        header = np.zeros(1, dtype=_HEADER)
+        header["magic"] = _MAGIC
+        header["node_size"] = self.node_size
+        header["num_items"] = len(self.ids)
+        header["num_levels"] = len(self.level_offsets) - 1
+        with open(path, "wb") as f:
+            f.write(header.tobytes())
+            f.write(np.ascontiguousarray(self.level_offsets, dtype="<i8").tobytes())
+            f.write(np.ascontiguousarray(self.ids, dtype="<i8").tobytes())
+            f.write(np.ascontiguousarray(self.boxes, dtype="<f8").tobytes())
+
+    @classmethod
+    def load(cls, path: Union[str, os.PathLike], mmap: bool = True) -> "PackedRTree":
+        """`save()`로 저장한 트리를 엽니다.
+
+        Args:
+            path: 파일 경로
+            mmap: True이면 배열을 읽기 전용 메모리 맵으로 연다
+
+        Raises:
+            FileNotFoundError: 파일이 존재하지 않는 경우
+            ValueError: R-트리 파일이 아닌 경우
+        """
+        if not os.path.exists(path):
+            raise FileNotFoundError(f"파일을 찾을 수 없습니다: {path}")
+        header = np.fromfile(path, dtype=_HEADER, count=1)
+        if not len(header) or header["magic"][0] != _MAGIC:
+            raise ValueError(f"R-트리 파일이 아닙니다: {path}")
+        node_size = int(header["node_size"][0])
+        count = int(header["num_items"][0])
+        num_levels = int(header["num_levels"][0])
+        offset = _HEADER.itemsize
+        level_offsets = np.fromfile(path, dtype="<i8", count=num_levels + 1, offset=offset)
+        num_nodes = int(level_offsets[-1]) if len(level_offsets) else 0
+        ids_offset = offset + level_offsets.nbytes
+        boxes_offset = ids_offset + count * 8
+        if mmap and count:
+            ids = np.memmap(path, dtype="<i8", mode="r", offset=ids_offset, shape=(count,))
+            boxes = np.memmap(path, dtype="<f8", mode="r", offset=boxes_offset,
+                              shape=(num_nodes, 4))
+        else:
+            ids = np.fromfile(path, dtype="<i8", count=count, offset=ids_offset)
+            boxes = np.fromfile(path, dtype="<f8", count=num_nodes * 4,
+                                offset=boxes_offset).reshape(num_nodes, 4)
+        return cls._from_arrays(node_size, ids, boxes, level_offsets)
+
+
+class IncrementalRTree:
+    """편집 가능한 R-트리입니다.
+
+    불변 `PackedRTree`에 추가/변경 델타와 삭제 표시를 얹어 질의하고, 델타가
+    `rebuild_ratio` 비율을 넘으면 전체를 다시 일괄 적재합니다.
+
+    속성:
+        node_size (int): 노드당 최대 자식 수
+        rebuild_ratio (float): 다시 적재할 델타 비율
+    """
+
+    # 델타가 이 개수 이하이면 비율과 무관하게 재적재하지 않는다
+    MIN_DELTA = 256
+
+    def __init__(self, node_size: int = 16, rebuild_ratio: float = 0.1):
+        """IncrementalRTree 인스턴스를 초기화합니다.
+
+        Args:
+            node_size: 노드당 최대 자식 수
+            rebuild_ratio: 전체 항목 대비 델타 비율이 이를 넘으면 재적재
+        """
+        self.node_size = node_size
+        self.rebuild_ratio = rebuild_ratio
+        self._items: Dict[int, Box] = {}
+        self._tree = PackedRTree(np.empty((0, 4)), node_size=node_size)
+        self._delta: Dict[int, Box] = {}
+        self._stale: set = set()
+        self._delta_boxes: Optional[np.ndarray] = None
+        self._delta_ids: Optional[np.ndarray] = None
+
+    @classmethod
+    def from_boxes(cls, boxes, ids: Optional[Sequence[int]] = None,
+                   node_size: int = 16) -> "IncrementalRTree":
+        """초기 항목을 일괄 적재한 트리를 만듭니다."""
+        tree = cls(node_size)
+        boxes = _as_boxes(boxes)
+        ids = range(len(boxes)) if ids is None else ids
+        tree._items = {int(i): tuple(map(float, b)) for i, b in zip(ids, boxes)}
+        tree.rebuild()
+        return tree
+
+    def __len__(self) -> int:
+        return len(self._items)
+
+    def __contains__(self, item_id: int) -> bool:
+        return item_id in self._items
+
+    def insert(self, item_id: int, box: Box) -> None:
+        """항목을 추가하거나 경계를 바꿉니다."""
+        self.update_many([(item_id, box)])
+
+    def remove(self, item_id: int) -> None:
+        """항목을 삭제합니다. 없는 ID는 무시합니다."""
+        if self._items.pop(item_id, None) is None:
+            return
+        self._stale.add(item_id)
+        if self._delta.pop(item_id, None) is not None:
+            self._delta_boxes = None
+        self._maybe_rebuild()
+
+    def update_many(self, items: Iterable[Tuple[int, Box]]) -> None:
+        """여러 항목을 한 번에 추가/변경합니다 (재적재 여부는 마지막에 한 번 판단)."""
+        for item_id, box in items:
+            box = tuple(map(float, box))
+            if item_id in self._items:
+                self._stale.add(item_id)
+            self._items[item_id] = box
+            self._delta[item_id] = box
+        self._delta_boxes = None
+        self._maybe_rebuild()
+
+    def rebuild(self) -> None:
+        """현재 항목 전체로 불변 트리를 다시 적재하고 델타를 비웁니다."""
+        ids = np.fromiter(self._items.keys(), dtype=np.int64, count=len(self._items))
+        boxes = np.array(list(self._items.values()), dtype=np.float64).reshape(-1, 4)
+        self._tree = PackedRTree(boxes, ids, self.node_size)
+        self._delta.clear()
+        self._stale.clear()
+        self._delta_boxes = None
+
+    def _maybe_rebuild(self) -> None:
+        pending = len(self._delta) + len(self._stale)
+        if pending > max(self.MIN_DELTA, self.rebuild_ratio * len(self._items)):
+            self.rebuild()
+
+    def snapshot(self) -> "RTreeSnapshot":
+        """현재 상태의 읽기 전용 사본을 반환합니다.
+
+        불변 트리는 공유하고 델타와 삭제 표시만 배열로 복사하므로 비용은
+        델타 크기(최대 재적재 기준)에 비례합니다. 사본은 이후 편집의 영향을
+        받지 않아 다른 스레드에서 질의해도 안전합니다.
+        """
+        if self._delta and self._delta_boxes is None:
+            self._delta_ids = np.fromiter(self._delta.keys(), dtype=np.int64)
+            self._delta_boxes = np.array(list(self._delta.values()), dtype=np.float64)
+        stale = np.fromiter(self._stale, dtype=np.int64, count=len(self._stale))
+        if not self._delta:
+            return RTreeSnapshot(self._tree, stale)
+        # 델타 배열은 제자리에서 바뀌지 않고 새로 만들어지므로 그대로 공유한다
+        return RTreeSnapshot(self._tree, stale, self._delta_ids, self._delta_boxes)
+
+    def query(self, x0: float, y0: float, x1: float, y1: float) -> np.ndarray:
+        """사각형과 겹치는 항목 ID를 반환합니다 (순서는 정해지지 않음)."""
+        return self.snapshot().query(x0, y0, x1, y1)
+
+    def query_point(self, x: float, y: float) -> np.ndarray:
+        """점을 포함하는 항목 ID를 반환합니다."""
+        return self.query(x, y, x, y)
+
+
+class RTreeSnapshot:
+    """`IncrementalRTree`의 특정 시점 상태를 질의하는 읽기 전용 사본입니다.
+
+    속성:
+        tree (PackedRTree): 적재된 불변 트리
+    """
+
+    __slots__ = ("tree", "_stale", "_delta_ids", "_delta_boxes")
+
+    def __init__(self, tree: PackedRTree, stale: np.ndarray,
+                 delta_ids: Optional[np.ndarray] = None,
+                 delta_boxes: Optional[np.ndarray] = None):
+        """RTreeSnapshot 인스턴스를 초기화합니다.
+
+        Args:
+            tree: 적재된 불변 트리
+            stale: 트리 안에서 삭제/변경된 항목 ID
+            delta_ids: 트리 밖에서 추가/변경된 항목 ID
+            delta_boxes: delta_ids의 경계
+        """
+        self.tree = tree
+        self._stale = stale
+        self._delta_ids = delta_ids
+        self._delta_boxes = delta_boxes
+
+    def query(self, x0: float, y0: float, x1: float, y1: float) -> np.ndarray:
+        """사각형과 겹치는 항목 ID를 반환합니다 (순서는 정해지지 않음)."""
+        found = self.tree.query(x0, y0, x1, y1)
+        if len(self._stale):
+            found = found[~np.isin(found, self._stale)]
+        if self._delta_ids is not None:
+            b = self._delta_boxes
+            mask = (b[:, 0] <= x1) & (b[:, 2] >= x0) & (b[:, 1] <= y1) & (b[:, 3] >= y0)
+            found = np.concatenate([found, self._delta_ids[mask]])
+        return found
@@ -0,0 +1,12 @@
+"""
+pytest 공통 설정입니다.
+
+설치하지 않은 작업 트리에서도 `src/` 레이아웃의 패키지를 가져올 수 있게 합니다.
+"""
+
+import sys
+from pathlib import Path
+
+SRC = Path(__file__).resolve().parent.parent / "src"
+if str(SRC) not in sys.path:
+    sys.path.insert(0, str(SRC))
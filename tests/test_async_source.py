@@ -0,0 +1,51 @@
+"""
+비동기 로딩 API가 스크립트에 캐시 메모리를 쓰기 가능한 배열로 넘기지 않는지 테스트합니다.
+"""
+
+import asyncio
+
+import cv2
+import numpy as np
+import pytest
+
+from airphoto_viewer.core.tile.async_source import open_image
+from airphoto_viewer.core.tile.tile import TileCoord
+from airphoto_viewer.core.tile.tile_cache import TileCache
+
+
+@pytest.fixture
+def image_path(tmp_path):
+    rng = np.random.default_rng(1)
+    path = tmp_path / "image.png"
+    cv2.imwrite(str(path), rng.integers(1, 256, (600, 700, 3), dtype=np.uint8))
+    return str(path)
+
+
+def test_read_region_and_get_tile_are_read_only(image_path):
+    async def run():
+        async with await open_image(image_path, cache=TileCache(16 << 20)) as image:
+            region = await image.read_region(0, 0, 0, 300, 300)
+            with pytest.raises(ValueError):
+                region[:] = 0
+            tile = await image.get_tile(TileCoord(0, 0, 0))
+            with pytest.raises(ValueError):
+                tile[:] = 0
+            # 복사본 수정은 캐시 타일에 영향을 주지 않는다
+            copy = np.array(region)
+            copy[:] = 0
+            again = await image.get_tile(TileCoord(0, 0, 0))
+            assert again.all()
+            assert np.array_equal(again, region[:256, :256])
+            async for _, tile in image.tiles(level=1):
+                assert not tile.flags.writeable
+
+    asyncio.run(run())
+
+
+def test_read_region_rejects_out_of_bounds(image_path):
+    async def run():
+        async with await open_image(image_path, cache=TileCache(16 << 20)) as image:
+            with pytest.raises(ValueError):
+                await image.read_region(0, 650, 0, 100, 10)
+
+    asyncio.run(run())
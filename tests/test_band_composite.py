@@ -0,0 +1,51 @@
+"""
+밴드 합성 소스의 스트레치 계산 시점과 결과 테스트입니다.
+"""
+
+import numpy as np
+
+from airphoto_viewer.core.tile.band_composite import (BandCompositeSource, BandStretch,
+                                                      band_statistics)
+from airphoto_viewer.core.tile.tile import TileCoord
+from airphoto_viewer.core.tile.tile_cache import TileCache
+from airphoto_viewer.core.tile.tile_source import TileSource
+
+
+class CountingSource(TileSource):
+    """읽기 횟수를 세는 5밴드 16비트 메모리 소스"""
+
+    def __init__(self, data: np.ndarray):
+        super().__init__(data.shape[1], data.shape[0], data.shape[2], data.dtype, 64,
+                         TileCache(16 << 20))
+        self.data = data
+        self.reads = 0
+
+    @property
+    def cache_key(self):
+        return ("counting", self.token)
+
+    def read_region(self, level, x, y, w, h):
+        self.reads += 1
+        s = 1 << level
+        return self.data[::s, ::s][y:y + h, x:x + w].copy()
+
+
+def test_composite_defers_statistics_until_first_tile():
+    rng = np.random.default_rng(2)
+    source = CountingSource(rng.integers(0, 4000, (200, 300, 5)).astype(np.uint16))
+    stretch = BandStretch(source)
+    composites = [BandCompositeSource(source, bands, stretch)
+                  for bands in ((2, 1, 0), (4, 3, 1))]
+    assert source.reads == 0
+
+    tile = composites[1].get_tile(TileCoord(0, 0, 0))
+    lo, hi = band_statistics(source)
+    order = [1, 3, 4]
+    expected = np.clip((source.data[:64, :64][..., order].astype(np.float32) - lo[order])
+                       * (255.0 / (hi[order] - lo[order])), 0, 255).astype(np.uint8)
+    assert np.array_equal(tile, expected)
+
+    # 두 번째 조합은 공유 스트레치를 다시 계산하지 않는다
+    reads = source.reads
+    composites[0].get_tile(TileCoord(0, 0, 0))
+    assert source.reads == reads + 1
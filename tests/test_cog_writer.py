@@ -0,0 +1,194 @@
+"""
+COG 작성기의 파일 배치와 왕복 테스트입니다.
+
+헤더와 GDAL 구조 메타데이터(ghost 영역), IFD가 모두 타일 데이터 앞에 있는지,
+타일이 작은 오버뷰부터 행 우선 순서로 놓였는지, 타일마다 크기 leader와
+마지막 4바이트 trailer가 붙었는지, 다시 쓴 IFD가 실제 타일 위치를 가리키는지를
+바이트 단위로 확인하고, OpenCV/PIL로 읽은 픽셀을 소스 레벨과 비교합니다.
+"""
+
+import struct
+import zlib
+
+import cv2
+import numpy as np
+import pytest
+from PIL import Image
+
+from airphoto_viewer.core.image.georef import GeoTransform
+from airphoto_viewer.core.tile.cog_writer import write_cog
+from airphoto_viewer.core.tile.pyramid import downsample
+from airphoto_viewer.core.tile.tile_cache import TileCache
+from airphoto_viewer.core.tile.tile_source import TileSource
+
+TYPE_FORMATS = {2: "s", 3: "H", 4: "I", 12: "d", 16: "Q"}
+
+
+class ArraySource(TileSource):
+    """메모리 배열(BGR)을 INTER_AREA 피라미드로 제공하는 타일 소스"""
+
+    def __init__(self, data: np.ndarray, tile_size: int = 64):
+        channels = 1 if data.ndim == 2 else data.shape[2]
+        super().__init__(data.shape[1], data.shape[0], channels, data.dtype, tile_size,
+                         TileCache(32 << 20))
+        self.levels = [data]
+        for level in range(1, self.num_levels):
+            self.levels.append(downsample(self.levels[-1], self.level_size(level)))
+
+    @property
+    def cache_key(self):
+        return ("array", self.token)
+
+    def read_region(self, level, x, y, w, h):
+        return self.levels[level][y:y + h, x:x + w].copy()
+
+
+def read_ifds(data: bytes):
+    """파일의 IFD 체인을 [(위치, {태그: 값 튜플})] 목록으로 읽습니다."""
+    bigtiff = data[2:4] == b"+\x00"
+    if bigtiff:
+        (position,) = struct.unpack_from("<Q", data, 8)
+        count_fmt, entry_size, slot, offset_fmt = "<Q", 20, 8, "<Q"
+    else:
+        (position,) = struct.unpack_from("<I", data, 4)
+        count_fmt, entry_size, slot, offset_fmt = "<H", 12, 4, "<I"
+    ifds = []
+    while position:
+        (count,) = struct.unpack_from(count_fmt, data, position)
+        at = position + struct.calcsize(count_fmt)
+        tags = {}
+        for index in range(count):
+            entry = at + index * entry_size
+            tag, code = struct.unpack_from("<HH", data, entry)
+            (n,) = struct.unpack_from(offset_fmt, data, entry + 4)
+            fmt = TYPE_FORMATS[code]
+            length = n * struct.calcsize(fmt if fmt != "s" else "c")
+            value_at = entry + 4 + struct.calcsize(offset_fmt)
+            if length > slot:
+                (value_at,) = struct.unpack_from(offset_fmt, data, value_at)
+            raw = data[value_at:value_at + length]
+            tags[tag] = (raw.rstrip(b"\x00").decode("ascii") if fmt == "s"
+                         else struct.unpack(f"<{n}{fmt}", raw))
+        ifds.append((position, tags))
+        (position,) = struct.unpack_from(offset_fmt, data, at + count * entry_size)
+    return ifds, bigtiff
+
+
+def write(tmp_path, source, **options):
+    path = tmp_path / "out.tif"
+    sizes = write_cog(source, str(path), block_size=64, workers=3, **options)
+    return path, sizes, path.read_bytes()
+
+
+def to_rgb(array: np.ndarray) -> np.ndarray:
+    return array[..., ::-1] if array.ndim == 3 else array
+
+
+@pytest.mark.parametrize("bigtiff", [False, True])
+@pytest.mark.parametrize("shape", [(301, 187, 3), (130, 200), (64, 64, 3), (97, 450, 3)])
+def test_layout_and_round_trip(tmp_path, bigtiff, shape):
+    rng = np.random.default_rng(sum(shape))
+    source = ArraySource(rng.integers(0, 256, shape, dtype=np.uint8))
+    path, sizes, data = write(tmp_path, source, compression="deflate", bigtiff=bigtiff)
+    ifds, is_bigtiff = read_ifds(data)
+    assert is_bigtiff == bigtiff
+    assert len(ifds) == len(sizes)
+
+    # ghost 영역은 헤더 바로 뒤, 크기 줄의 숫자가 뒤따르는 메타데이터 길이
+    header = 16 if bigtiff else 8
+    first_line = data[header:header + 43].decode("ascii")
+    assert first_line.startswith("GDAL_STRUCTURAL_METADATA_SIZE=")
+    ghost_size = int(first_line.split("=")[1][:6])
+    ghost = data[header + 43:header + 43 + ghost_size].decode("ascii")
+    assert "LAYOUT=IFDS_BEFORE_DATA" in ghost and "BLOCK_LEADER=SIZE_AS_UINT4" in ghost
+
+    # 모든 IFD는 첫 타일 앞에 해상도 순으로 있다
+    first_tile = min(min(tags[324]) for _, tags in ifds)
+    positions = [position for position, _ in ifds]
+    assert positions == sorted(positions) and positions[-1] < first_tile
+    for (width, height), (_, tags) in zip(sizes, ifds):
+        assert (tags[256][0], tags[257][0]) == (width, height)
+        assert len(tags[324]) == -(-width // 64) * -(-height // 64)
+    assert all(tags[254] == (1,) for _, tags in ifds[1:])
+
+    # 타일 데이터: 작은 오버뷰부터, 레벨 안에서는 행 우선으로 빈틈없이 이어진다
+    expected = header + 43 + ghost_size
+    ordered = []
+    for _, tags in reversed(ifds):
+        ordered += list(zip(tags[324], tags[325]))
+    cursor = None
+    for offset, count in ordered:
+        assert struct.unpack_from("<I", data, offset - 4) == (count,)
+        assert data[offset + count:offset + count + 4] == data[offset + count - 4:offset + count]
+        if cursor is not None:
+            assert offset == cursor + 4
+        cursor = offset + count + 4
+    assert cursor == len(data)
+    assert expected <= positions[0]
+
+    ok, pages = cv2.imreadmulti(str(path), flags=cv2.IMREAD_UNCHANGED)
+    assert ok and len(pages) == len(sizes)
+    for level, page in enumerate(pages):
+        assert np.array_equal(page, source.levels[level])
+
+
+@pytest.mark.parametrize("dtype,channels", [(np.uint16, 1), (np.uint16, 3), (np.float32, 1),
+                                            (np.uint16, 5)])
+def test_non_8bit_round_trip(tmp_path, dtype, channels):
+    rng = np.random.default_rng(7)
+    shape = (150, 170) if channels == 1 else (150, 170, channels)
+    array = (rng.random(shape) * 60000).astype(dtype)
+    source = ArraySource(array)
+    path, sizes, data = write(tmp_path, source, compression="deflate")
+    ifds, _ = read_ifds(data)
+    assert ifds[0][1][277] == (channels,)
+    assert ifds[0][1][258] == (np.dtype(dtype).itemsize * 8,) * channels
+    if channels <= 3:
+        ok, pages = cv2.imreadmulti(str(path), flags=cv2.IMREAD_UNCHANGED)
+        assert ok
+        assert np.array_equal(pages[0], array)
+        assert np.array_equal(pages[1], source.levels[1])
+    else:
+        # OpenCV는 4채널을 넘는 TIFF를 읽지 못하므로 첫 타일을 직접 풀어 비교한다
+        offset, count = ifds[0][1][324][0], ifds[0][1][325][0]
+        tile = np.frombuffer(zlib.decompress(data[offset:offset + count]), "<u2")
+        tile = np.cumsum(tile.reshape(64, 64, channels), axis=1, dtype=np.uint16)
+        assert ifds[0][1][317] == (2,)
+        assert np.array_equal(tile, array[:64, :64])
+
+
+def test_geotiff_and_nodata_tags(tmp_path):
+    source = ArraySource(np.full((200, 260, 3), 90, np.uint8))
+    geotransform = GeoTransform((500000.0, 0.25, 0.0, 4100000.0, 0.0, -0.25))
+    path, sizes, _ = write(tmp_path, source, compression="none",
+                           geotransform=geotransform, crs="EPSG:32652", nodata=0)
+    with Image.open(path) as image:
+        tags = image.tag_v2
+        assert tuple(tags[33550]) == (0.25, 0.25, 0.0)
+        assert tuple(tags[33922]) == (0.0, 0.0, 0.0, 500000.0, 4100000.0, 0.0)
+        assert tags[42113] == "0"
+        image.seek(1)
+        assert 33550 not in image.tag_v2
+        assert image.tag_v2[42113] == "0"
+        assert image.size == sizes[1]
+
+
+def test_jpeg_tiles(tmp_path):
+    rng = np.random.default_rng(9)
+    array = cv2.GaussianBlur(rng.integers(0, 256, (230, 190, 3), dtype=np.uint8), (0, 0), 8)
+    source = ArraySource(array)
+    path, sizes, data = write(tmp_path, source, compression="jpeg", quality=95)
+    ifds, _ = read_ifds(data)
+    assert ifds[0][1][262] == (6,) and ifds[0][1][530] == (2, 2)
+    ok, pages = cv2.imreadmulti(str(path), flags=cv2.IMREAD_UNCHANGED)
+    assert ok and len(pages) == len(sizes)
+    for level, page in enumerate(pages):
+        assert np.abs(page.astype(int) - source.levels[level]).mean() < 3
+
+
+def test_cancel_removes_partial_file(tmp_path):
+    source = ArraySource(np.zeros((300, 300, 3), np.uint8))
+    path = tmp_path / "cancel.tif"
+    with pytest.raises(IOError):
+        write_cog(source, str(path), block_size=64, cancelled=lambda: True)
+    assert not path.exists()
@@ -0,0 +1,183 @@
+"""
+파일 변경 감지(블록 서명 비교와 바뀐 블록만 다시 디코딩) 테스트입니다.
+
+같은 영상의 두 버전을 여러 TIFF 작성기로 저장하고, 블록 서명 비교로 찾은
+바뀐 블록만 덮어쓴 배열이 새 파일 전체를 디코딩한 배열과 같은지 확인합니다.
+"""
+
+import cv2
+import numpy as np
+import pytest
+from PIL import Image
+
+from airphoto_viewer.core.image.file_changes import (changed_block_indices, changed_blocks,
+                                                     changed_pixels, patch_blocks,
+                                                     read_tiff_blocks)
+from airphoto_viewer.core.tile.cog_writer import write_cog
+from airphoto_viewer.core.tile.pyramid import downsample
+from airphoto_viewer.core.tile.raster_writer import TiledTiffWriter
+from airphoto_viewer.core.tile.tile_cache import TileCache
+from airphoto_viewer.core.tile.tile_source import TileSource
+
+HEIGHT, WIDTH = 530, 610
+CHANGED = (slice(250, 280), slice(300, 420))
+
+
+class ArraySource(TileSource):
+    """메모리 배열(BGR)을 피라미드로 제공하는 타일 소스"""
+
+    def __init__(self, data: np.ndarray):
+        channels = 1 if data.ndim == 2 else data.shape[2]
+        super().__init__(data.shape[1], data.shape[0], channels, data.dtype, 64,
+                         TileCache(32 << 20))
+        self.levels = [data]
+        for level in range(1, self.num_levels):
+            self.levels.append(downsample(self.levels[-1], self.level_size(level)))
+
+    @property
+    def cache_key(self):
+        return ("array", self.token)
+
+    def read_region(self, level, x, y, w, h):
+        return self.levels[level][y:y + h, x:x + w].copy()
+
+
+def cv_writer(compression):
+    return lambda data, path: cv2.imwrite(path, data,
+                                          [cv2.IMWRITE_TIFF_COMPRESSION, compression])
+
+
+def pil_writer(compression):
+    def save(data, path):
+        Image.fromarray(data[..., ::-1] if data.ndim == 3 else data).save(
+            path, compression=compression)
+    return save
+
+
+def tiled_writer(compression):
+    def save(data, path):
+        channels = 1 if data.ndim == 2 else data.shape[2]
+        writer = TiledTiffWriter(path, data.shape[1], data.shape[0], channels, data.dtype,
+                                 tile_size=64, compression=compression)
+        rgb = data[..., ::-1] if channels == 3 else data
+        for index in range(-(-data.shape[0] // 64)):
+            writer.write_payload(writer.encode_band(index, rgb[index * 64:(index + 1) * 64]))
+        writer.close()
+    return save
+
+
+def cog_writer(compression):
+    return lambda data, path: write_cog(ArraySource(data), path, compression, block_size=64,
+                                        workers=2)
+
+
+def band_writer(data, path):
+    cv2.imwritemulti(path, [np.ascontiguousarray(data[..., i]) for i in range(data.shape[2])],
+                     [cv2.IMWRITE_TIFF_COMPRESSION, 5])
+
+
+def read_full(path, bands: bool) -> np.ndarray:
+    if bands:
+        ok, pages = cv2.imreadmulti(path, flags=cv2.IMREAD_UNCHANGED)
+        assert ok
+        return np.dstack(pages)
+    return cv2.imread(path, cv2.IMREAD_UNCHANGED)
+
+
+def base_image(kind: str) -> np.ndarray:
+    yy, xx = np.mgrid[0:HEIGHT, 0:WIDTH]
+    rgb = np.dstack([(xx * 3) % 256, (yy * 5) % 256, (xx + yy) % 256]).astype(np.uint8)
+    if kind == "gray16":
+        return rgb[..., 0].astype(np.uint16) * 200
+    if kind == "bands":
+        return np.dstack([rgb, rgb[..., :2]])
+    return rgb
+
+
+CASES = {
+    "cv-lzw": ("rgb", cv_writer(5)),
+    "cv-none": ("rgb", cv_writer(1)),
+    "cv-deflate": ("rgb", cv_writer(8)),
+    "cv-lzw-16bit": ("gray16", cv_writer(5)),
+    "pil-deflate": ("rgb", pil_writer("tiff_adobe_deflate")),
+    "pil-jpeg": ("rgb", pil_writer("jpeg")),
+    "tiled-deflate": ("rgb", tiled_writer("deflate")),
+    "tiled-none-16bit": ("gray16", tiled_writer("none")),
+    "cog-deflate": ("rgb", cog_writer("deflate")),
+    "cog-jpeg": ("rgb", cog_writer("jpeg")),
+    "band-pages": ("bands", band_writer),
+}
+
+
+@pytest.mark.parametrize("case", sorted(CASES))
+def test_patch_matches_full_decode(tmp_path, case):
+    kind, save = CASES[case]
+    old = base_image(kind)
+    new = old.copy()
+    new[CHANGED] = 7
+    old_path, new_path = str(tmp_path / "old.tif"), str(tmp_path / "new.tif")
+    save(old, old_path)
+    save(new, new_path)
+    bands = kind == "bands"
+    old_pixels = read_full(old_path, bands)
+
+    old_blocks = read_tiff_blocks(old_path)
+    new_blocks = read_tiff_blocks(new_path, old_blocks)
+    assert old_blocks is not None and new_blocks is not None
+    changed = changed_block_indices(old_blocks, new_blocks)
+    total = sum(len(page) for page in new_blocks.pages)
+    assert changed and len(changed) < total
+
+    # 바뀐 영역은 바뀐 블록 사각형 안에 모두 들어간다
+    mask = np.zeros((HEIGHT, WIDTH), bool)
+    for x, y, w, h in changed_blocks(old_blocks, new_blocks):
+        mask[y:y + h, x:x + w] = True
+    assert mask[CHANGED].all()
+
+    result = patch_blocks(new_path, new_blocks, changed, old_pixels)
+    assert result is not None
+    patched, filled = result
+    assert np.array_equal(patched, read_full(new_path, bands))
+    assert filled == read_tiff_blocks(new_path)
+    # 기준 배열은 바뀌지 않는다
+    assert np.array_equal(old_pixels, read_full(old_path, bands))
+
+
+def test_rewrite_without_changes(tmp_path):
+    data = base_image("rgb")
+    first, second = str(tmp_path / "a.tif"), str(tmp_path / "b.tif")
+    cv_writer(5)(data, first)
+    cv_writer(5)(data, second)
+    assert changed_block_indices(read_tiff_blocks(first), read_tiff_blocks(second)) == []
+
+
+def test_layout_change_is_not_comparable(tmp_path):
+    data = base_image("rgb")
+    first, second = str(tmp_path / "a.tif"), str(tmp_path / "b.tif")
+    cv_writer(5)(data, first)
+    cv_writer(1)(data, second)
+    assert changed_block_indices(read_tiff_blocks(first), read_tiff_blocks(second)) is None
+    tiled_writer("deflate")(data, second)
+    assert changed_blocks(read_tiff_blocks(first), read_tiff_blocks(second)) is None
+
+
+@pytest.mark.filterwarnings("ignore::UserWarning")
+def test_non_tiff_and_truncated_files(tmp_path):
+    png = str(tmp_path / "a.png")
+    cv2.imwrite(png, base_image("rgb"))
+    assert read_tiff_blocks(png) is None
+    tif = str(tmp_path / "a.tif")
+    cv_writer(1)(base_image("rgb"), tif)
+    with open(tif, "r+b") as f:
+        f.truncate(1000)
+    assert read_tiff_blocks(tif) is None
+
+
+def test_changed_pixels():
+    old = base_image("rgb")
+    new = old.copy()
+    new[CHANGED] = 7
+    assert changed_pixels(old, old) == []
+    assert changed_pixels(old, new, block=256) == [(256, 0, 256, 256), (256, 256, 256, 256)]
+    assert changed_pixels(old, new, block=100) == [(300, 200, 100, 100), (400, 200, 100, 100)]
+    assert changed_pixels(old, new[..., :2]) is None
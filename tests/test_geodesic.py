@@ -0,0 +1,28 @@
+"""
+측지 측정 엔진의 입력 검증과 기본 측정값 테스트입니다.
+"""
+
+import pytest
+
+from airphoto_viewer.core.image.georef import GeoTransform
+from airphoto_viewer.core.measure.geodesic import MeasurementEngine
+
+
+def test_crs_without_geotransform_is_rejected():
+    with pytest.raises(ValueError):
+        MeasurementEngine(crs="EPSG:32652")
+
+
+def test_pixel_plane_without_georeference():
+    engine = MeasurementEngine()
+    assert not engine.geodesic
+    assert engine.units == "px"
+    assert engine.length([(0, 0), (3, 4)]) == pytest.approx(5.0)
+
+
+def test_geodesic_length_in_utm():
+    geotransform = GeoTransform((500000.0, 1.0, 0.0, 4100000.0, 0.0, -1.0))
+    engine = MeasurementEngine(geotransform, "EPSG:32652")
+    assert engine.geodesic
+    # UTM 중앙 자오선 부근의 1km는 측지 길이와 축척 계수(0.9996)만큼 다르다
+    assert engine.length([(0, 0), (0, 1000)]) == pytest.approx(1000 / 0.9996, rel=1e-3)
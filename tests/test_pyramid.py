@@ -0,0 +1,86 @@
+"""
+이미지 피라미드의 타일 메모리 소유권 테스트입니다.
+
+캐시에 들어간 타일이 레벨 배열의 뷰이면 원본을 내려도 메모리가 해제되지
+않으므로, 타일이 소유 사본인지와 `release()` 뒤 원본이 실제로 사라지는지 확인합니다.
+"""
+
+import gc
+import weakref
+
+import cv2
+import numpy as np
+import pytest
+
+from airphoto_viewer.core.image.image_data import ImageData
+from airphoto_viewer.core.tile.pyramid import ImagePyramid
+from airphoto_viewer.core.tile.tile import TileCoord
+from airphoto_viewer.core.tile.tile_cache import TileCache
+
+
+@pytest.fixture
+def image_path(tmp_path):
+    """1300x1000 임의 RGB 영상 파일 경로"""
+    rng = np.random.default_rng(0)
+    path = tmp_path / "image.png"
+    cv2.imwrite(str(path), rng.integers(0, 256, (1000, 1300, 3), dtype=np.uint8))
+    return path
+
+
+def make_pyramid(path) -> ImagePyramid:
+    image_data = ImageData()
+    image_data.load(str(path))
+    return ImagePyramid(image_data, cache=TileCache(64 << 20))
+
+
+def test_cached_tile_owns_memory(image_path):
+    pyramid = make_pyramid(image_path)
+    tile = pyramid.get_tile(TileCoord(0, 0, 0))
+    assert tile.base is None
+    assert tile.flags.owndata
+    assert pyramid.cache.size_bytes == tile.nbytes
+    assert np.array_equal(tile, pyramid.image_data.data[:256, :256])
+
+
+def test_region_view_is_read_only_and_shares_level(image_path):
+    pyramid = make_pyramid(image_path)
+    view = pyramid.region_view(0, 10, 20, 30, 40)
+    assert not view.flags.writeable
+    assert np.shares_memory(view, pyramid.level_array(0))
+    with pytest.raises(ValueError):
+        pyramid.region_view(0, 1290, 0, 20, 10)
+
+
+def test_release_frees_level0_while_coarse_tiles_cached(image_path):
+    pyramid = make_pyramid(image_path)
+    coarse = [TileCoord(level, 0, 0) for level in range(1, pyramid.num_levels)]
+    for coord in [TileCoord(0, 0, 0), TileCoord(0, 1, 1)] + coarse:
+        pyramid.get_tile(coord)
+    level0 = weakref.ref(pyramid.image_data.data)
+    level1 = weakref.ref(pyramid.level_array(1))
+
+    pyramid.release()
+    gc.collect()
+
+    assert level0() is None
+    assert level1() is None
+    for coord in coarse:
+        assert pyramid.cached_tile(coord) is not None
+
+
+def test_replace_data_keeps_unchanged_tiles_without_old_raster(image_path):
+    pyramid = make_pyramid(image_path)
+    kept, changed = TileCoord(0, 0, 0), TileCoord(0, 4, 3)
+    pyramid.get_tile(kept)
+    pyramid.get_tile(changed)
+    old = weakref.ref(pyramid.image_data.data)
+
+    data = pyramid.image_data.data.copy()
+    data[900:, 1200:] = 0
+    pyramid.replace_data(ImageData.from_array(str(image_path), data), [(1200, 900, 100, 100)])
+    gc.collect()
+
+    assert old() is None
+    assert pyramid.cached_tile(kept) is not None
+    assert pyramid.cached_tile(changed) is None
+    assert not pyramid.get_tile(changed)[900 - 768:, 1200 - 1024:].any()
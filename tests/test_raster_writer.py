@@ -0,0 +1,234 @@
+"""
+띠 단위 스트리밍 작성기(타일 TIFF, PNG, JPEG)의 왕복 테스트입니다.
+
+작성기로 띠를 나눠 쓴 파일을 OpenCV/PIL로 다시 읽어 픽셀과 태그를 비교합니다.
+띠 경계와 타일 경계가 영상 끝과 맞지 않는 홀수 크기를 일부러 사용합니다.
+"""
+
+import struct
+import zlib
+
+import cv2
+import numpy as np
+import pytest
+from PIL import Image
+
+from airphoto_viewer.core.image.georef import GeoTransform
+from airphoto_viewer.core.tile.raster_writer import (JpegStreamWriter, PngStreamWriter,
+                                                     TiledTiffWriter, adler32_combine)
+from airphoto_viewer.core.tile.region_export import export_region
+from airphoto_viewer.core.tile.tile_cache import TileCache
+from airphoto_viewer.core.tile.tile_source import TileSource
+
+
+def write_bands(writer, pixels: np.ndarray) -> None:
+    """영상을 작성기의 띠 높이로 잘라 순서대로 씁니다 (파일 채널 순서)."""
+    rows = writer.band_rows
+    for index in range(-(-pixels.shape[0] // rows)):
+        writer.write_payload(writer.encode_band(index, pixels[index * rows:(index + 1) * rows]))
+    writer.close()
+
+
+def random_image(height, width, channels, dtype=np.uint8, seed=0) -> np.ndarray:
+    rng = np.random.default_rng(seed)
+    high = np.iinfo(dtype).max if np.dtype(dtype).kind in "ui" else 1.0
+    if np.dtype(dtype).kind == "f":
+        data = rng.random((height, width, channels)).astype(dtype)
+    else:
+        data = rng.integers(0, high, (height, width, channels), endpoint=True).astype(dtype)
+    return data[..., 0] if channels == 1 else data
+
+
+def read_unchanged(path) -> np.ndarray:
+    """파일 채널 순서(RGB)로 읽습니다.
+
+    OpenCV는 비연관 알파를 미리 곱해 읽으므로 RGBA는 PIL로 읽습니다.
+    """
+    data = cv2.imread(str(path), cv2.IMREAD_UNCHANGED)
+    assert data is not None
+    if data.ndim == 3 and data.shape[2] == 4 and data.dtype == np.uint8:
+        with Image.open(path) as image:
+            return np.asarray(image)
+    if data.ndim == 3 and data.shape[2] == 3:
+        return data[..., ::-1]
+    if data.ndim == 3 and data.shape[2] == 4:
+        return data[..., [2, 1, 0, 3]]
+    return data
+
+
+@pytest.mark.parametrize("compression", ["deflate", "none"])
+@pytest.mark.parametrize("channels,dtype", [(1, np.uint8), (3, np.uint8), (4, np.uint8),
+                                            (1, np.uint16), (3, np.uint16),
+                                            (1, np.float32)])
+@pytest.mark.parametrize("bigtiff", [False, True])
+def test_tiled_tiff_round_trip(tmp_path, compression, channels, dtype, bigtiff):
+    pixels = random_image(301, 187, channels, dtype)
+    path = tmp_path / "out.tif"
+    writer = TiledTiffWriter(str(path), 187, 301, channels, dtype, tile_size=64,
+                             compression=compression, bigtiff=bigtiff)
+    write_bands(writer, pixels)
+    with open(path, "rb") as f:
+        magic = f.read(4)
+    assert magic == (b"II+\x00" if bigtiff else b"II*\x00")
+    assert np.array_equal(read_unchanged(path), pixels)
+
+
+def test_tiled_tiff_jpeg_tiles(tmp_path):
+    pixels = cv2.GaussianBlur(random_image(150, 211, 3), (0, 0), 3)
+    path = tmp_path / "out.tif"
+    write_bands(TiledTiffWriter(str(path), 211, 150, 3, np.uint8, tile_size=32,
+                                compression="jpeg", quality=95), pixels)
+    decoded = read_unchanged(path)
+    assert decoded.shape == pixels.shape
+    assert np.abs(decoded.astype(int) - pixels).mean() < 3
+
+
+def test_tiled_tiff_geotiff_tags(tmp_path):
+    pixels = random_image(70, 90, 3)
+    geotransform = GeoTransform((500000.0, 0.5, 0.0, 4100000.0, 0.0, -0.5))
+    path = tmp_path / "geo.tif"
+    write_bands(TiledTiffWriter(str(path), 90, 70, 3, np.uint8, tile_size=32,
+                                geotransform=geotransform, crs="EPSG:32652"), pixels)
+    with Image.open(path) as image:
+        tags = image.tag_v2
+        assert tags[322] == 32 and tags[323] == 32
+        assert tags[317] == 2
+        assert tuple(tags[33550]) == (0.5, 0.5, 0.0)
+        assert tuple(tags[33922]) == (0.0, 0.0, 0.0, 500000.0, 4100000.0, 0.0)
+        keys = tags[34735]
+        assert 3072 in keys[4::4]
+        assert keys[4 * (keys[4::4].index(3072) + 1) + 3] == 32652
+        assert np.array_equal(np.asarray(image), pixels)
+
+
+def test_adler32_combine_matches_zlib():
+    rng = np.random.default_rng(3)
+    parts = [rng.integers(0, 256, n, dtype=np.uint8).tobytes() for n in (0, 1, 5552, 70000, 3)]
+    combined = 1
+    for part in parts:
+        combined = adler32_combine(combined, zlib.adler32(part), len(part))
+    assert combined == zlib.adler32(b"".join(parts))
+
+
+def idat_stream(path) -> bytes:
+    """PNG의 IDAT 청크를 이어 붙인 zlib 스트림을 반환합니다."""
+    data = open(path, "rb").read()
+    position, stream = 8, b""
+    while position < len(data):
+        length, kind = struct.unpack(">I4s", data[position:position + 8])
+        if kind == b"IDAT":
+            stream += data[position + 8:position + 8 + length]
+        position += 12 + length
+    return stream
+
+
+@pytest.mark.parametrize("channels", [1, 2, 3, 4])
+@pytest.mark.parametrize("dtype", [np.uint8, np.uint16])
+@pytest.mark.parametrize("band_rows", [1, 7, 64, 512])
+def test_png_stream_round_trip(tmp_path, channels, dtype, band_rows):
+    pixels = random_image(101, 53, channels, dtype, seed=channels)
+    path = tmp_path / "out.png"
+    write_bands(PngStreamWriter(str(path), 53, 101, channels, dtype, band_rows=band_rows),
+                pixels)
+    # zlib이 Adler-32까지 검증하도록 전체 스트림을 한 번에 푼다
+    raw = zlib.decompress(idat_stream(path))
+    assert len(raw) == 101 * (1 + 53 * channels * np.dtype(dtype).itemsize)
+    if dtype == np.uint8 or channels == 1:
+        with Image.open(path) as image:
+            decoded = np.asarray(image)
+    else:
+        # PIL은 16비트 컬러 PNG를 8비트로 줄이므로 OpenCV로 읽는다
+        decoded = cv2.imread(str(path), cv2.IMREAD_UNCHANGED)
+        decoded = decoded[..., [0, 3] if channels == 2 else [2, 1, 0, 3][:channels]]
+    assert np.array_equal(decoded, pixels)
+
+
+def test_png_rejects_unsupported_format(tmp_path):
+    with pytest.raises(ValueError):
+        PngStreamWriter(str(tmp_path / "x.png"), 4, 4, 5, np.uint8)
+    with pytest.raises(ValueError):
+        PngStreamWriter(str(tmp_path / "x.png"), 4, 4, 3, np.float32)
+
+
+def jpeg_markers(data: bytes):
+    """SOS 전까지의 헤더 마커와 엔트로피 구간의 RST 마커 목록을 반환합니다."""
+    position, header = 2, {}
+    while True:
+        marker = data[position + 1]
+        length = struct.unpack(">H", data[position + 2:position + 4])[0]
+        header.setdefault(marker, data[position + 4:position + 2 + length])
+        position += 2 + length
+        if marker == 0xDA:
+            break
+    entropy = data[position:-2]
+    restarts = [entropy[i + 1] for i in range(len(entropy) - 1)
+                if entropy[i] == 0xFF and 0xD0 <= entropy[i + 1] <= 0xD7]
+    return header, restarts
+
+
+@pytest.mark.parametrize("channels,width,height", [(3, 211, 150), (3, 64, 16),
+                                                   (1, 77, 45), (3, 33, 200)])
+def test_jpeg_stream_restart_splicing(tmp_path, channels, width, height):
+    pixels = cv2.GaussianBlur(random_image(height, width, channels, seed=4), (0, 0), 2)
+    path = tmp_path / "out.jpg"
+    writer = JpegStreamWriter(str(path), width, height, channels, quality=95, band_rows=48)
+    write_bands(writer, pixels)
+
+    data = open(path, "rb").read()
+    header, restarts = jpeg_markers(data)
+    assert struct.unpack(">H", header[0xC0][1:3])[0] == height
+    assert struct.unpack(">H", header[0xC0][3:5])[0] == width
+    assert struct.unpack(">H", header[0xDD])[0] == -(-width // writer.mcu)
+    strips = -(-height // writer.mcu)
+    assert restarts == [0xD0 + i % 8 for i in range(strips - 1)]
+
+    with Image.open(path) as image:
+        decoded = np.asarray(image)
+    assert decoded.shape == pixels.shape
+    assert np.abs(decoded.astype(int) - pixels).mean() < 3
+    # 띠별 독립 인코딩과 한 번에 인코딩한 결과의 차이는 띠 경계 업샘플링 정도다
+    reference = cv2.imdecode(cv2.imencode(".jpg", pixels[..., ::-1] if channels == 3
+                                          else pixels,
+                                          [cv2.IMWRITE_JPEG_QUALITY, 95])[1],
+                             cv2.IMREAD_UNCHANGED)
+    reference = reference[..., ::-1] if channels == 3 else reference
+    assert np.abs(decoded.astype(int) - reference).mean() < 2
+
+
+def test_jpeg_rejects_unsupported_format(tmp_path):
+    with pytest.raises(ValueError):
+        JpegStreamWriter(str(tmp_path / "x.jpg"), 10, 10, 4)
+    with pytest.raises(ValueError):
+        JpegStreamWriter(str(tmp_path / "x.jpg"), 70000, 10, 3)
+
+
+class ArraySource(TileSource):
+    """메모리 배열(BGR)을 레벨 0으로 제공하는 타일 소스"""
+
+    def __init__(self, data: np.ndarray, tile_size: int = 64):
+        channels = 1 if data.ndim == 2 else data.shape[2]
+        super().__init__(data.shape[1], data.shape[0], channels, data.dtype, tile_size,
+                         TileCache(16 << 20))
+        self.data = data
+
+    @property
+    def cache_key(self):
+        return ("array", self.token)
+
+    def read_region(self, level, x, y, w, h):
+        data = self.data
+        for _ in range(level):
+            data = cv2.resize(data, ((data.shape[1] + 1) // 2, (data.shape[0] + 1) // 2),
+                              interpolation=cv2.INTER_AREA)
+        return data[y:y + h, x:x + w].copy()
+
+
+@pytest.mark.parametrize("suffix", [".tif", ".png"])
+def test_export_region_crop_is_lossless(tmp_path, suffix):
+    data = random_image(333, 257, 3, seed=5)
+    source = ArraySource(data)
+    path = tmp_path / f"crop{suffix}"
+    size = export_region(source, str(path), rect=(17, 29, 201, 283), workers=3)
+    assert size == (201, 283)
+    assert np.array_equal(cv2.imread(str(path), cv2.IMREAD_UNCHANGED),
+                          data[29:29 + 283, 17:17 + 201])
@@ -0,0 +1,116 @@
+"""
+공간 색인 질의를 전수 검사 결과와 비교하는 테스트입니다.
+"""
+
+import numpy as np
+import pytest
+
+from airphoto_viewer.utils.spatial_index import IncrementalRTree, PackedRTree
+
+
+def random_boxes(rng, count: int, extent: float = 1000.0) -> np.ndarray:
+    x = rng.uniform(0, extent, count)
+    y = rng.uniform(0, extent, count)
+    w = rng.exponential(20, count) * (rng.random(count) > 0.1)  # 일부는 점
+    h = rng.exponential(20, count) * (rng.random(count) > 0.1)
+    return np.column_stack([x, y, x + w, y + h])
+
+
+def brute_force(boxes: np.ndarray, ids: np.ndarray, rect) -> set:
+    x0, y0, x1, y1 = rect
+    mask = ((boxes[:, 0] <= x1) & (boxes[:, 2] >= x0)
+            & (boxes[:, 1] <= y1) & (boxes[:, 3] >= y0))
+    return set(ids[mask].tolist())
+
+
+def random_rects(rng, count: int, extent: float = 1000.0):
+    for _ in range(count):
+        x, y = rng.uniform(-50, extent + 50, 2)
+        w, h = rng.exponential(60, 2)
+        yield x, y, x + w, y + h
+
+
+@pytest.mark.parametrize("count", [0, 1, 15, 16, 17, 256, 257, 5000])
+@pytest.mark.parametrize("node_size", [4, 16])
+def test_packed_query_matches_brute_force(count, node_size):
+    rng = np.random.default_rng(count * 31 + node_size)
+    boxes = random_boxes(rng, count)
+    ids = rng.permutation(count * 3)[:count].astype(np.int64)
+    tree = PackedRTree(boxes, ids, node_size)
+    assert len(tree) == count
+    for rect in random_rects(rng, 200):
+        found = tree.query(*rect)
+        assert len(found) == len(set(found.tolist()))
+        assert set(found.tolist()) == brute_force(boxes, ids, rect)
+    if count:
+        assert tree.bounds == (boxes[:, 0].min(), boxes[:, 1].min(),
+                               boxes[:, 2].max(), boxes[:, 3].max())
+
+
+def test_touching_boundaries_and_points():
+    boxes = np.array([[0, 0, 10, 10], [10, 10, 20, 20], [5, 5, 5, 5]], dtype=float)
+    tree = PackedRTree(boxes, node_size=2)
+    assert sorted(tree.query_point(10, 10).tolist()) == [0, 1]
+    assert tree.query_point(5, 5).tolist() in ([0, 2], [2, 0])
+    assert tree.query(20.5, 0, 30, 30).size == 0
+
+
+@pytest.mark.parametrize("mmap", [True, False])
+def test_save_and_load(tmp_path, mmap):
+    rng = np.random.default_rng(5)
+    boxes = random_boxes(rng, 3000)
+    ids = np.arange(3000, dtype=np.int64) * 7
+    path = tmp_path / "index.rtree"
+    PackedRTree(boxes, ids).save(path)
+    loaded = PackedRTree.load(path, mmap=mmap)
+    assert len(loaded) == 3000
+    for rect in random_rects(rng, 100):
+        assert set(loaded.query(*rect).tolist()) == brute_force(boxes, ids, rect)
+
+
+def test_rejects_bad_shape():
+    with pytest.raises(ValueError):
+        PackedRTree(np.zeros((3, 3)))
+
+
+def test_incremental_edits_match_brute_force():
+    rng = np.random.default_rng(11)
+    initial = random_boxes(rng, 2000)
+    tree = IncrementalRTree.from_boxes(initial)
+    items = {i: tuple(box) for i, box in enumerate(initial)}
+    next_id = len(items)
+    snapshots = []
+    for step in range(3000):
+        action = rng.random()
+        if action < 0.4:
+            box = tuple(random_boxes(rng, 1)[0])
+            tree.insert(next_id, box)
+            items[next_id] = box
+            next_id += 1
+        elif action < 0.7 and items:
+            item_id = int(rng.choice(list(items)))
+            box = tuple(random_boxes(rng, 1)[0])
+            tree.insert(item_id, box)
+            items[item_id] = box
+        elif items:
+            item_id = int(rng.choice(list(items)))
+            tree.remove(item_id)
+            del items[item_id]
+        tree.remove(-1)  # 없는 ID는 무시
+        if step % 500 == 0:
+            snapshots.append((tree.snapshot(), dict(items)))
+        if step % 100 == 0:
+            ids = np.fromiter(items, dtype=np.int64)
+            boxes = np.array(list(items.values())).reshape(-1, 4)
+            assert len(tree) == len(items)
+            for rect in random_rects(rng, 20):
+                found = tree.query(*rect).tolist()
+                assert len(found) == len(set(found))
+                assert set(found) == brute_force(boxes, ids, rect)
+
+    # 스냅숏은 찍은 뒤의 편집과 재적재의 영향을 받지 않는다
+    for snapshot, frozen in snapshots:
+        ids = np.fromiter(frozen, dtype=np.int64)
+        boxes = np.array(list(frozen.values())).reshape(-1, 4)
+        for rect in random_rects(rng, 20):
+            assert set(snapshot.query(*rect).tolist()) == brute_force(boxes, ids, rect)
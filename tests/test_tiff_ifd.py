@@ -0,0 +1,89 @@
+"""
+IFD 직렬화 테스트입니다.
+
+칸에 들어가지 않는 값이 IFD 뒤 짝수 위치로 넘어가고 항목이 그 위치를
+가리키는지, 만든 IFD로 조립한 TIFF를 PIL이 같은 태그로 읽는지 확인합니다.
+"""
+
+import io
+import struct
+
+import numpy as np
+import pytest
+from PIL import Image
+
+from airphoto_viewer.core.image.tiff_ifd import (TIFF_ASCII, TIFF_DOUBLE, TIFF_LONG,
+                                                 TIFF_LONG8, TIFF_SHORT, encode_ifd)
+
+
+def parse_ifd(data: bytes, offset: int, bigtiff: bool):
+    """encode_ifd 결과를 (태그 → (자료형 코드, 개수, 값 바이트)) 사전과 다음 IFD로 읽습니다."""
+    count_fmt, entry_size, slot, offset_fmt = (("<Q", 20, 8, "<Q") if bigtiff
+                                               else ("<H", 12, 4, "<I"))
+    head = struct.calcsize(count_fmt)
+    (count,) = struct.unpack_from(count_fmt, data, 0)
+    sizes = {2: 1, 3: 2, 4: 4, 12: 8, 16: 8}
+    entries = {}
+    for index in range(count):
+        at = head + index * entry_size
+        tag, code = struct.unpack_from("<HH", data, at)
+        (n,) = struct.unpack_from(offset_fmt, data, at + 4)
+        length = n * sizes[code]
+        value_at = at + 4 + struct.calcsize(offset_fmt)
+        if length <= slot:
+            raw = data[value_at:value_at + length]
+        else:
+            (pointer,) = struct.unpack_from(offset_fmt, data, value_at)
+            assert pointer % 2 == 0
+            raw = data[pointer - offset:pointer - offset + length]
+        entries[tag] = (code, n, raw)
+    (next_ifd,) = struct.unpack_from(offset_fmt, data, head + count * entry_size)
+    return entries, next_ifd
+
+
+@pytest.mark.parametrize("bigtiff", [False, True])
+@pytest.mark.parametrize("offset", [8, 1001, 4096])
+def test_overflow_values_are_addressed(bigtiff, offset):
+    entries = [
+        (305, TIFF_ASCII, "airphoto"),          # 9바이트: 넘침 (홀수 길이)
+        (256, TIFF_LONG, (123,)),               # 칸 안
+        (258, TIFF_SHORT, (8, 8, 8)),           # 6바이트: 클래식은 넘침
+        (33550, TIFF_DOUBLE, (0.5, 0.5, 0.0)),  # 넘침 (앞 값이 홀수 길이로 끝남)
+        (324, TIFF_LONG8 if bigtiff else TIFF_LONG, tuple(range(1000, 1010))),
+    ]
+    data = encode_ifd(entries, offset, bigtiff, next_ifd=77)
+    parsed, next_ifd = parse_ifd(data, offset, bigtiff)
+    assert next_ifd == 77
+    assert list(parsed) == sorted(parsed)
+    assert parsed[305][2] == b"airphoto\x00"
+    assert struct.unpack("<I", parsed[256][2]) == (123,)
+    assert struct.unpack("<3H", parsed[258][2]) == (8, 8, 8)
+    assert struct.unpack("<3d", parsed[33550][2]) == (0.5, 0.5, 0.0)
+    fmt = "<10Q" if bigtiff else "<10I"
+    assert struct.unpack(fmt, parsed[324][2]) == tuple(range(1000, 1010))
+
+
+def test_assembled_tiff_reads_back():
+    width, height = 37, 11
+    pixels = np.arange(width * height * 3, dtype=np.uint8).reshape(height, width, 3)
+    strip = pixels.tobytes()
+    strip_at = 8
+    ifd_at = strip_at + len(strip) + len(strip) % 2
+    entries = [
+        (256, TIFF_LONG, (width,)),
+        (257, TIFF_LONG, (height,)),
+        (258, TIFF_SHORT, (8, 8, 8)),
+        (259, TIFF_SHORT, (1,)),
+        (262, TIFF_SHORT, (2,)),
+        (273, TIFF_LONG, (strip_at,)),
+        (277, TIFF_SHORT, (3,)),
+        (278, TIFF_LONG, (height,)),
+        (279, TIFF_LONG, (len(strip),)),
+        (305, TIFF_ASCII, "airphoto-viewer test"),
+    ]
+    data = (b"II" + struct.pack("<HI", 42, ifd_at) + strip + b"\x00" * (len(strip) % 2)
+            + encode_ifd(entries, ifd_at, False))
+    with Image.open(io.BytesIO(data)) as image:
+        assert image.size == (width, height)
+        assert image.tag_v2[305] == "airphoto-viewer test"
+        assert np.array_equal(np.asarray(image), pixels)